@@ -0,0 +1,547 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Sweep the elementary operations and functions of decwide_t
+// over digit counts, limb types and storage modes. Report the time
+// per operation, the throughput in limbs per second and the speed
+// relative to Boost.Multiprecision's cpp_dec_float and cpp_bin_float.
+//
+// Usage: wide_decimal_bench [options]
+//   --min-digits=N  smallest digit count to run (default 20)
+//   --max-digits=N  largest digit count to run (default all compiled in)
+//   --ops=a,b,...   operations among add,sub,mul,div,sqrt,inv,exp,log,pi
+//   --limbs=a,b,... limb widths among 8,16,32 (default all)
+//   --alloc=a,b,... storage modes among heap,fixed (default all)
+//   --min-time=S    minimum measuring time per case in seconds (default 0.2)
+//   --no-boost      do not time the Boost.Multiprecision types
+//   --json=FILE     also write the results as JSON to FILE (- for stdout,
+//                   in which case the table goes to stderr)
+//
+// Digit counts up to WIDE_DECIMAL_BENCH_MAX_DIGITS10 (10^4 by default,
+// at most 10^6) are compiled in. Each compiled-in decwide_t type caches
+// pi and ln2 before main(), which takes minutes at 10^6 digits.
+// The fixed storage mode (no allocator) and the Boost types are only
+// instantiated up to 10^4 digits, since their limbs live on the stack.
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <boost/version.hpp>
+
+#if !defined(BOOST_VERSION)
+#error BOOST_VERSION is not defined. Ensure that <boost/version.hpp> is properly included.
+#endif
+
+#if ((BOOST_VERSION >= 107700) && !defined(BOOST_MATH_STANDALONE))
+#if (defined(_MSC_VER) && (_MSC_VER < 1920))
+#else
+#define BOOST_MATH_STANDALONE
+#endif
+#endif
+
+#if ((BOOST_VERSION >= 107900) && !defined(BOOST_MP_STANDALONE))
+#define BOOST_MP_STANDALONE
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/stopwatch.h>
+
+#if !defined(WIDE_DECIMAL_BENCH_MAX_DIGITS10)
+#define WIDE_DECIMAL_BENCH_MAX_DIGITS10 10000 // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
+namespace wide_decimal_bench {
+
+constexpr auto bench_fixed_max_digits10 = static_cast<std::int32_t>(INT32_C(10000));
+
+enum class op_kind : unsigned
+{
+  add,
+  sub,
+  mul,
+  div,
+  sqrt,
+  inv,
+  exp,
+  log,
+  pi
+};
+
+constexpr std::array<const char*, static_cast<std::size_t>(UINT8_C(9))> op_names =
+{{
+  "add", "sub", "mul", "div", "sqrt", "inv", "exp", "log", "pi"
+}};
+
+constexpr std::array<op_kind, static_cast<std::size_t>(UINT8_C(9))> all_ops =
+{{
+  op_kind::add, op_kind::sub, op_kind::mul, op_kind::div, op_kind::sqrt, op_kind::inv, op_kind::exp, op_kind::log, op_kind::pi
+}};
+
+auto op_name(const op_kind op) -> const char* { return op_names[static_cast<std::size_t>(op)]; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+struct options
+{
+  std::int32_t             min_digits10 { INT32_C(20) };
+  std::int32_t             max_digits10 { WIDE_DECIMAL_BENCH_MAX_DIGITS10 };
+  std::vector<op_kind>     ops          { all_ops.cbegin(), all_ops.cend() };
+  std::vector<unsigned>    limb_bits    { 8U, 16U, 32U }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  bool                     alloc_heap   { true };
+  bool                     alloc_fixed  { true };
+  double                   min_time     { 0.2 }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  bool                     with_boost   { true };
+  std::string              json_file    { };
+  bool                     show_help    { false };
+};
+
+// The table goes to stdout, unless the JSON is written there.
+auto table_stream(const options& opts) -> std::ostream&
+{
+  return ((opts.json_file == "-") ? std::cerr : std::cout);
+}
+
+struct measurement
+{
+  std::uint64_t iterations { };
+  double        ns_per_op  { };
+};
+
+struct result
+{
+  op_kind     op           { };
+  std::int32_t digits10    { };
+  unsigned    limb_bits    { };
+  const char* alloc_name   { };
+  std::int32_t limbs       { };
+  measurement wd           { };
+  double      ns_dec_float { };
+  double      ns_bin_float { };
+};
+
+volatile std::uint32_t bench_sink { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// A decimal string of the requested length whose digits are pseudo-random,
+// such that all limbs of the operands are filled. The leading digit is
+// nonzero, and the value lies in [1, 10).
+auto make_operand_string(const std::int32_t digits10, const std::uint32_t seed) -> std::string
+{
+  std::mt19937 eng(seed);
+
+  std::uniform_int_distribution<int> dist_lead(1, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  std::uniform_int_distribution<int> dist_digit(0, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  std::string str(static_cast<std::size_t>(digits10 + 1), '0');
+
+  str[static_cast<std::size_t>(UINT8_C(0))] = static_cast<char>('0' + dist_lead(eng));
+  str[static_cast<std::size_t>(UINT8_C(1))] = '.';
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(2)); i < str.length(); ++i)
+  {
+    str[i] = static_cast<char>('0' + dist_digit(eng));
+  }
+
+  return str;
+}
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+auto bench_pi(const ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&) -> ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
+{
+  // Compute pi anew each time, bypassing the cached value of pi().
+  return ::math::wide_decimal::calc_pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+}
+
+template<typename BackendType, const boost::multiprecision::expression_template_option ExpressionTemplates>
+auto bench_pi(const boost::multiprecision::number<BackendType, ExpressionTemplates>&) -> boost::multiprecision::number<BackendType, ExpressionTemplates>
+{
+  // Compute pi anew each time with the series of default_ops::calc_pi(),
+  // bypassing the string constant and the cache behind the pi() of Boost.
+  using local_float_type = boost::multiprecision::number<BackendType, ExpressionTemplates>;
+
+  local_float_type pi_value { };
+
+  boost::multiprecision::default_ops::calc_pi(pi_value.backend(), static_cast<unsigned>(std::numeric_limits<local_float_type>::digits));
+
+  return pi_value;
+}
+
+template<typename FloatType>
+auto bench_inv(const FloatType& a) -> FloatType
+{
+  return FloatType(1U) / a;
+}
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+auto bench_inv(const ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& a) -> ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>
+{
+  auto a_inv = a;
+
+  static_cast<void>(a_inv.calculate_inv());
+
+  return a_inv;
+}
+
+template<typename FloatType>
+auto bench_one_op(const op_kind op, const FloatType& a, const FloatType& b, const FloatType& x) -> FloatType
+{
+  using std::exp;
+  using std::log;
+  using std::sqrt;
+
+  switch(op)
+  {
+    case op_kind::add:  return a + b;
+    case op_kind::sub:  return a - b;
+    case op_kind::mul:  return a * b;
+    case op_kind::div:  return a / b;
+    case op_kind::sqrt: return sqrt(a);
+    case op_kind::inv:  return bench_inv(a);
+    case op_kind::exp:  return exp(x);
+    case op_kind::log:  return log(a);
+    case op_kind::pi:
+    default:            return bench_pi(a);
+  }
+}
+
+template<typename FloatType>
+auto bench_measure(const op_kind op, const std::int32_t digits10, const double min_time) -> measurement
+{
+  using float_type = FloatType;
+
+  const float_type a(make_operand_string(digits10, UINT32_C(0x1234)).c_str());
+  const float_type b(make_operand_string(digits10, UINT32_C(0x5678)).c_str());
+
+  const float_type x = a / 16U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  using stopwatch_type = concurrency::stopwatch;
+
+  // Warm up caches and cached constants before timing.
+  bench_sink = static_cast<std::uint32_t>(bench_sink + ((bench_one_op(op, a, b, x) > a) ? 1U : 0U));
+
+  measurement meas { };
+
+  auto total_time = 0.0;
+
+  for(auto batch = static_cast<std::uint64_t>(UINT8_C(1)); total_time < min_time; batch *= 2U)
+  {
+    stopwatch_type my_stopwatch { };
+
+    for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); i < batch; ++i)
+    {
+      bench_sink = static_cast<std::uint32_t>(bench_sink + ((bench_one_op(op, a, b, x) > a) ? 1U : 0U));
+    }
+
+    total_time += stopwatch_type::elapsed_time<double>(my_stopwatch);
+
+    meas.iterations += batch;
+  }
+
+  meas.ns_per_op = static_cast<double>((total_time * 1.0E9) / static_cast<double>(meas.iterations));
+
+  return meas;
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+using dec_float_type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<static_cast<unsigned>(ParamDigitsBaseTen)>, boost::multiprecision::et_off>;
+
+template<const std::int32_t ParamDigitsBaseTen>
+using bin_float_type = boost::multiprecision::number<boost::multiprecision::cpp_bin_float<static_cast<unsigned>(ParamDigitsBaseTen)>, boost::multiprecision::et_off>;
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto bench_boost(const op_kind op, const options& opts, std::true_type) -> std::pair<double, double>
+{
+  return
+  {
+    bench_measure<dec_float_type<ParamDigitsBaseTen>>(op, ParamDigitsBaseTen, opts.min_time).ns_per_op,
+    bench_measure<bin_float_type<ParamDigitsBaseTen>>(op, ParamDigitsBaseTen, opts.min_time).ns_per_op
+  };
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto bench_boost(const op_kind, const options&, std::false_type) -> std::pair<double, double>
+{
+  return { 0.0, 0.0 };
+}
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType>
+auto bench_wide_decimal(const options& opts, const char* alloc_name, const std::pair<double, double>& ns_boost, const op_kind op, std::vector<result>& results) -> void // NOLINT(google-runtime-references)
+{
+  using wide_decimal_type = ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType>;
+
+  result res { };
+
+  res.op           = op;
+  res.digits10     = ParamDigitsBaseTen;
+  res.limb_bits    = static_cast<unsigned>(std::numeric_limits<LimbType>::digits);
+  res.alloc_name   = alloc_name;
+  res.limbs        = wide_decimal_type::decwide_t_elem_number;
+  res.wd           = bench_measure<wide_decimal_type>(op, ParamDigitsBaseTen, opts.min_time);
+  res.ns_dec_float = ns_boost.first;
+  res.ns_bin_float = ns_boost.second;
+
+  std::stringstream strm;
+
+  strm << std::left  << std::setw(5)  << op_name(op)
+       << std::right << std::setw(9)  << ParamDigitsBaseTen
+       << std::setw(4)  << res.limb_bits
+       << std::setw(7)  << alloc_name
+       << std::setw(16) << std::fixed << std::setprecision(1) << res.wd.ns_per_op
+       << std::setw(14) << std::scientific << std::setprecision(3) << static_cast<double>((static_cast<double>(res.limbs) * 1.0E9) / res.wd.ns_per_op);
+
+  for(const auto ns : { res.ns_dec_float, res.ns_bin_float })
+  {
+    if(ns > 0.0) { strm << std::setw(10) << std::fixed << std::setprecision(2) << (ns / res.wd.ns_per_op); }
+    else         { strm << std::setw(10) << "-"; }
+  }
+
+  table_stream(opts) << strm.str() << std::endl;
+
+  results.push_back(res);
+}
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType>
+auto bench_wide_decimal_fixed(const options& opts, const std::pair<double, double>& ns_boost, const op_kind op, std::vector<result>& results, std::true_type) -> void // NOLINT(google-runtime-references)
+{
+  bench_wide_decimal<ParamDigitsBaseTen, LimbType, void>(opts, "fixed", ns_boost, op, results);
+}
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType>
+auto bench_wide_decimal_fixed(const options&, const std::pair<double, double>&, const op_kind, std::vector<result>&, std::false_type) -> void { } // NOLINT(google-runtime-references)
+
+template<const std::int32_t ParamDigitsBaseTen, typename LimbType>
+auto bench_limb_type(const options& opts, const std::pair<double, double>& ns_boost, const op_kind op, std::vector<result>& results) -> void // NOLINT(google-runtime-references)
+{
+  const auto limb_bits = static_cast<unsigned>(std::numeric_limits<LimbType>::digits);
+
+  if(std::find(opts.limb_bits.cbegin(), opts.limb_bits.cend(), limb_bits) == opts.limb_bits.cend())
+  {
+    return;
+  }
+
+  if(opts.alloc_heap)
+  {
+    bench_wide_decimal<ParamDigitsBaseTen, LimbType, std::allocator<void>>(opts, "heap", ns_boost, op, results);
+  }
+
+  if(opts.alloc_fixed)
+  {
+    using fixed_is_instantiated_type = std::integral_constant<bool, (ParamDigitsBaseTen <= bench_fixed_max_digits10)>;
+
+    bench_wide_decimal_fixed<ParamDigitsBaseTen, LimbType>(opts, ns_boost, op, results, fixed_is_instantiated_type());
+  }
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto bench_digits(const options& opts, std::vector<result>& results) -> void // NOLINT(google-runtime-references)
+{
+  if((ParamDigitsBaseTen < opts.min_digits10) || (ParamDigitsBaseTen > opts.max_digits10))
+  {
+    return;
+  }
+
+  for(const auto op : opts.ops)
+  {
+    // Time the Boost types once per operation and digit count.
+    using boost_is_instantiated_type = std::integral_constant<bool, (ParamDigitsBaseTen <= bench_fixed_max_digits10)>;
+
+    const auto ns_boost =
+      (opts.with_boost ? bench_boost<ParamDigitsBaseTen>(op, opts, boost_is_instantiated_type())
+                       : std::pair<double, double> { 0.0, 0.0 });
+
+    bench_limb_type<ParamDigitsBaseTen, std::uint8_t >(opts, ns_boost, op, results);
+    bench_limb_type<ParamDigitsBaseTen, std::uint16_t>(opts, ns_boost, op, results);
+    bench_limb_type<ParamDigitsBaseTen, std::uint32_t>(opts, ns_boost, op, results);
+  }
+}
+
+auto split_list(const std::string& str) -> std::vector<std::string>
+{
+  std::vector<std::string> items { };
+
+  std::stringstream strm(str);
+
+  std::string item { };
+
+  while(std::getline(strm, item, ','))
+  {
+    if(!item.empty()) { items.push_back(item); }
+  }
+
+  return items;
+}
+
+auto parse_options(const int argc, char** argv, options& opts) -> bool // NOLINT(google-runtime-references,readability-function-cognitive-complexity)
+{
+  auto result_is_ok = true;
+
+  for(auto i = 1; (i < argc) && result_is_ok; ++i)
+  {
+    const std::string arg(argv[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto pos_eq = arg.find('=');
+
+    const auto key   = arg.substr(static_cast<std::size_t>(UINT8_C(0)), pos_eq);
+    const auto value = ((pos_eq != std::string::npos) ? arg.substr(pos_eq + 1U) : std::string());
+
+    if     (key == "--min-digits") { opts.min_digits10 = static_cast<std::int32_t>(std::stol(value)); }
+    else if(key == "--max-digits") { opts.max_digits10 = static_cast<std::int32_t>(std::stol(value)); }
+    else if(key == "--min-time")   { opts.min_time     = std::stod(value); }
+    else if(key == "--no-boost")   { opts.with_boost   = false; }
+    else if(key == "--json")       { opts.json_file    = value; }
+    else if(key == "--help")       { opts.show_help    = true; }
+    else if(key == "--ops")
+    {
+      opts.ops.clear();
+
+      for(const auto& name : split_list(value))
+      {
+        const auto it = std::find_if(all_ops.cbegin(), all_ops.cend(), [&name](const op_kind op) { return (name == op_name(op)); }); // NOLINT(modernize-use-trailing-return-type)
+
+        result_is_ok = ((it != all_ops.cend()) && result_is_ok);
+
+        if(it != all_ops.cend()) { opts.ops.push_back(*it); }
+      }
+    }
+    else if(key == "--limbs")
+    {
+      opts.limb_bits.clear();
+
+      for(const auto& name : split_list(value))
+      {
+        opts.limb_bits.push_back(static_cast<unsigned>(std::stoul(name)));
+      }
+    }
+    else if(key == "--alloc")
+    {
+      const auto names = split_list(value);
+
+      opts.alloc_heap  = (std::find(names.cbegin(), names.cend(), "heap")  != names.cend());
+      opts.alloc_fixed = (std::find(names.cbegin(), names.cend(), "fixed") != names.cend());
+    }
+    else
+    {
+      result_is_ok = false;
+    }
+  }
+
+  return result_is_ok;
+}
+
+auto write_json(std::ostream& os, const options& opts, const std::vector<result>& results) -> void
+{
+  const auto put_ratio =
+    [&os](const double ns_boost, const double ns_wd) // NOLINT(modernize-use-trailing-return-type)
+    {
+      if(ns_boost > 0.0) { os << std::fixed << std::setprecision(4) << (ns_boost / ns_wd); }
+      else               { os << "null"; }
+    };
+
+  os << "{\n"
+     << "  \"benchmark\": \"wide_decimal_bench\",\n"
+     << "  \"boost_version\": " << BOOST_VERSION << ",\n"
+     << "  \"min_time_s\": " << opts.min_time << ",\n"
+     << "  \"results\": [\n";
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < results.size(); ++i)
+  {
+    const auto& res = results[i];
+
+    os << "    { \"op\": \"" << op_name(res.op) << "\""
+       << ", \"digits10\": " << res.digits10
+       << ", \"limb_bits\": " << res.limb_bits
+       << ", \"allocator\": \"" << res.alloc_name << "\""
+       << ", \"limbs\": " << res.limbs
+       << ", \"iterations\": " << res.wd.iterations
+       << ", \"ns_per_op\": " << std::fixed << std::setprecision(1) << res.wd.ns_per_op
+       << ", \"limbs_per_s\": " << std::scientific << std::setprecision(6) << static_cast<double>((static_cast<double>(res.limbs) * 1.0E9) / res.wd.ns_per_op)
+       << ", \"ratio_cpp_dec_float\": "; put_ratio(res.ns_dec_float, res.wd.ns_per_op);
+    os << ", \"ratio_cpp_bin_float\": "; put_ratio(res.ns_bin_float, res.wd.ns_per_op);
+    os << " }" << ((i + 1U < results.size()) ? ",\n" : "\n");
+  }
+
+  os << "  ]\n"
+     << "}\n";
+}
+
+} // namespace wide_decimal_bench
+
+auto main(int argc, char** argv) -> int
+{
+  using namespace wide_decimal_bench; // NOLINT(google-build-using-namespace)
+
+  options opts { };
+
+  const auto options_are_ok = parse_options(argc, argv, opts);
+
+  if((!options_are_ok) || opts.show_help)
+  {
+    std::cerr << "Usage: wide_decimal_bench [--min-digits=N] [--max-digits=N] [--ops=add,...] "
+                 "[--limbs=8,16,32] [--alloc=heap,fixed] [--min-time=S] [--no-boost] [--json=FILE]"
+              << std::endl;
+
+    return (options_are_ok ? 0 : 1);
+  }
+
+  // The ratios are the time of the Boost type divided by the time
+  // of decwide_t, so a ratio above one means decwide_t is faster.
+  table_stream(opts) << "op      digits limb  alloc       ns/op       limbs/s  dec_float bin_float" << std::endl;
+
+  std::vector<result> results { };
+
+  bench_digits<INT32_C(20)>     (opts, results);
+  bench_digits<INT32_C(100)>    (opts, results);
+  bench_digits<INT32_C(1000)>   (opts, results);
+  bench_digits<INT32_C(10000)>  (opts, results);
+
+  #if (WIDE_DECIMAL_BENCH_MAX_DIGITS10 >= 100000)
+  bench_digits<INT32_C(100000)> (opts, results);
+  #endif
+  #if (WIDE_DECIMAL_BENCH_MAX_DIGITS10 >= 1000000)
+  bench_digits<INT32_C(1000000)>(opts, results);
+  #endif
+
+  if(opts.json_file == "-")
+  {
+    write_json(std::cout, opts, results);
+  }
+  else if(!opts.json_file.empty())
+  {
+    std::ofstream out(opts.json_file);
+
+    write_json(out, opts, results);
+
+    if(!out.good())
+    {
+      std::cerr << "Cannot write " << opts.json_file << std::endl;
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
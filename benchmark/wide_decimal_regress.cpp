@@ -0,0 +1,482 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Time multiplication and log of decwide_t at fixed digit counts
+// and compare the results with a baseline of earlier timings.
+// The thread is pinned to one CPU, and each case is warmed up and then
+// timed in several runs of a fixed number of iterations. The median
+// of the runs is compared with the baseline. The program fails if any
+// case is slower than its baseline by more than the threshold.
+//
+// Usage: wide_decimal_regress [options]
+//   --baseline=FILE        baseline to compare with (default: the one in benchmark/)
+//   --write-baseline=FILE  write the medians as a new baseline instead of comparing
+//   --threshold=P          allowed slowdown in percent (default 10)
+//   --runs=N               timed runs per case (default 9)
+//   --warmup=N             untimed runs per case (default 2)
+//   --min-time=S           minimum time of one run in seconds (default 0.05)
+//   --cpu=K                pin the thread to CPU K, or -1 for no pinning (default 0)
+//   --cases=a,b,...        run only these cases, given by name (log/1000)
+//                          or by operation (mul)
+//
+// The baseline is only meaningful on the machine and build type it
+// was written on. Write it anew with --write-baseline when either
+// changes, or when a change in speed is intended.
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/stopwatch.h>
+
+#if !defined(WIDE_DECIMAL_REGRESS_BASELINE)
+#define WIDE_DECIMAL_REGRESS_BASELINE "benchmark/wide_decimal_regress_baseline.json" // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
+namespace wide_decimal_regress {
+
+struct options
+{
+  std::string              baseline_file       { WIDE_DECIMAL_REGRESS_BASELINE };
+  std::string              write_baseline_file { };
+  double                   threshold_percent   { 10.0 }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  unsigned                 runs                { 9U };   // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  unsigned                 warmup              { 2U };
+  double                   min_time            { 0.05 }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  int                      cpu                 { 0 };
+  std::vector<std::string> case_names          { };
+  bool                     show_help           { false };
+};
+
+// A case times a given number of iterations of one operation
+// and returns the elapsed time in seconds.
+struct regress_case
+{
+  using function_type = auto (*)(std::uint64_t) -> double;
+
+  const char*   name;
+  function_type function;
+};
+
+struct result
+{
+  std::string name      { };
+  double      ns_median { };
+  double      ns_min    { };
+  double      ns_max    { };
+};
+
+volatile std::uint32_t regress_sink { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+// A decimal string of the requested length with pseudo-random digits
+// from a fixed seed, such that every run times the same operands.
+// The value lies in [1, 10).
+auto make_operand_string(const std::int32_t digits10, const std::uint32_t seed) -> std::string
+{
+  std::mt19937 eng(seed);
+
+  std::uniform_int_distribution<int> dist_lead(1, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  std::uniform_int_distribution<int> dist_digit(0, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  std::string str(static_cast<std::size_t>(digits10 + 1), '0');
+
+  str[static_cast<std::size_t>(UINT8_C(0))] = static_cast<char>('0' + dist_lead(eng));
+  str[static_cast<std::size_t>(UINT8_C(1))] = '.';
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(2)); i < str.length(); ++i)
+  {
+    str[i] = static_cast<char>('0' + dist_digit(eng));
+  }
+
+  return str;
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+using regress_decimal_type = ::math::wide_decimal::decwide_t<ParamDigitsBaseTen, std::uint32_t, std::allocator<void>>;
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto operand_a() -> const regress_decimal_type<ParamDigitsBaseTen>&
+{
+  static const regress_decimal_type<ParamDigitsBaseTen> a(make_operand_string(ParamDigitsBaseTen, UINT32_C(0x1234)).c_str());
+
+  return a;
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto operand_b() -> const regress_decimal_type<ParamDigitsBaseTen>&
+{
+  static const regress_decimal_type<ParamDigitsBaseTen> b(make_operand_string(ParamDigitsBaseTen, UINT32_C(0x5678)).c_str());
+
+  return b;
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto time_mul(const std::uint64_t iterations) -> double
+{
+  const auto& a = operand_a<ParamDigitsBaseTen>();
+  const auto& b = operand_b<ParamDigitsBaseTen>();
+
+  using stopwatch_type = concurrency::stopwatch;
+
+  stopwatch_type my_stopwatch { };
+
+  for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); i < iterations; ++i)
+  {
+    regress_sink = static_cast<std::uint32_t>(regress_sink + (((a * b) > a) ? 1U : 0U));
+  }
+
+  return stopwatch_type::elapsed_time<double>(my_stopwatch);
+}
+
+template<const std::int32_t ParamDigitsBaseTen>
+auto time_log(const std::uint64_t iterations) -> double
+{
+  const auto& a = operand_a<ParamDigitsBaseTen>();
+
+  using stopwatch_type = concurrency::stopwatch;
+
+  stopwatch_type my_stopwatch { };
+
+  for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); i < iterations; ++i)
+  {
+    regress_sink = static_cast<std::uint32_t>(regress_sink + ((log(a) > a) ? 1U : 0U));
+  }
+
+  return stopwatch_type::elapsed_time<double>(my_stopwatch);
+}
+
+// The multiplications span the schoolbook, Karatsuba
+// and FFT methods with their default thresholds.
+auto all_cases() -> std::vector<regress_case>
+{
+  return
+  {
+    { "mul/100",    time_mul<INT32_C(100)>    },
+    { "mul/1000",   time_mul<INT32_C(1000)>   },
+    { "mul/10000",  time_mul<INT32_C(10000)>  },
+    { "mul/100000", time_mul<INT32_C(100000)> },
+    { "log/100",    time_log<INT32_C(100)>    },
+    { "log/1000",   time_log<INT32_C(1000)>   },
+    { "log/10000",  time_log<INT32_C(10000)>  }
+  };
+}
+
+auto case_is_selected(const std::string& name, const options& opts) -> bool
+{
+  return
+       opts.case_names.empty()
+    || std::any_of(opts.case_names.cbegin(),
+                   opts.case_names.cend(),
+                   [&name](const std::string& item) { return ((name == item) || (name.compare(0U, name.find('/'), item) == 0)); }); // NOLINT(modernize-use-trailing-return-type)
+}
+
+auto pin_to_cpu(const int cpu) -> bool
+{
+  #if defined(__linux__)
+  cpu_set_t cpus;
+
+  CPU_ZERO(&cpus);
+  CPU_SET(static_cast<std::size_t>(cpu), &cpus); // NOLINT(hicpp-signed-bitwise)
+
+  return (sched_setaffinity(0, sizeof(cpus), &cpus) == 0);
+  #else
+  static_cast<void>(cpu);
+
+  return false;
+  #endif
+}
+
+// Find an iteration count for which one run takes at least
+// the minimum time, then warm up and take the timed runs.
+auto run_case(const regress_case& rc, const options& opts) -> result
+{
+  auto iterations = static_cast<std::uint64_t>(UINT8_C(1));
+
+  while(rc.function(iterations) < opts.min_time)
+  {
+    iterations *= 2U;
+  }
+
+  for(auto i = 0U; i < opts.warmup; ++i)
+  {
+    static_cast<void>(rc.function(iterations));
+  }
+
+  std::vector<double> ns_per_op { };
+
+  for(auto i = 0U; i < opts.runs; ++i)
+  {
+    ns_per_op.push_back(static_cast<double>((rc.function(iterations) * 1.0E9) / static_cast<double>(iterations)));
+  }
+
+  std::sort(ns_per_op.begin(), ns_per_op.end());
+
+  const auto mid = static_cast<std::size_t>(ns_per_op.size() / 2U);
+
+  result res { };
+
+  res.name      = rc.name;
+  res.ns_median = (((ns_per_op.size() % 2U) != 0U) ? ns_per_op[mid] : ((ns_per_op[mid - 1U] + ns_per_op[mid]) / 2.0));
+  res.ns_min    = ns_per_op.front();
+  res.ns_max    = ns_per_op.back();
+
+  return res;
+}
+
+auto split_list(const std::string& str) -> std::vector<std::string>
+{
+  std::vector<std::string> items { };
+
+  std::stringstream strm(str);
+
+  std::string item { };
+
+  while(std::getline(strm, item, ','))
+  {
+    if(!item.empty()) { items.push_back(item); }
+  }
+
+  return items;
+}
+
+auto parse_options(const int argc, char** argv, options& opts) -> bool // NOLINT(google-runtime-references)
+{
+  auto result_is_ok = true;
+
+  for(auto i = 1; (i < argc) && result_is_ok; ++i)
+  {
+    const std::string arg(argv[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto pos_eq = arg.find('=');
+
+    const auto key   = arg.substr(static_cast<std::size_t>(UINT8_C(0)), pos_eq);
+    const auto value = ((pos_eq != std::string::npos) ? arg.substr(pos_eq + 1U) : std::string());
+
+    if     (key == "--baseline")       { opts.baseline_file       = value; }
+    else if(key == "--write-baseline") { opts.write_baseline_file = value; }
+    else if(key == "--threshold")      { opts.threshold_percent   = std::stod(value); }
+    else if(key == "--runs")           { opts.runs                = static_cast<unsigned>(std::stoul(value)); }
+    else if(key == "--warmup")         { opts.warmup              = static_cast<unsigned>(std::stoul(value)); }
+    else if(key == "--min-time")       { opts.min_time            = std::stod(value); }
+    else if(key == "--cpu")            { opts.cpu                 = std::stoi(value); }
+    else if(key == "--cases")          { opts.case_names          = split_list(value); }
+    else if(key == "--help")           { opts.show_help           = true; }
+    else
+    {
+      result_is_ok = false;
+    }
+  }
+
+  return (result_is_ok && (opts.runs > 0U));
+}
+
+// Read the median times of a baseline written by write_baseline(),
+// one case per line.
+auto read_baseline(const std::string& file_name, std::map<std::string, double>& baseline) -> bool // NOLINT(google-runtime-references)
+{
+  std::ifstream in(file_name);
+
+  if(!in.is_open())
+  {
+    return false;
+  }
+
+  std::string line { };
+
+  while(std::getline(in, line))
+  {
+    const auto pos_name = line.find("\"name\": \"");
+    const auto pos_time = line.find("\"ns_per_op\": ");
+
+    if((pos_name != std::string::npos) && (pos_time != std::string::npos))
+    {
+      const auto first = pos_name + 9U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      std::stringstream strm(line.substr(pos_time + 13U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      auto ns = 0.0;
+
+      if(strm >> ns)
+      {
+        baseline[line.substr(first, line.find('"', first) - first)] = ns;
+      }
+    }
+  }
+
+  return true;
+}
+
+auto write_baseline(std::ostream& os, const options& opts, const std::vector<result>& results) -> void
+{
+  os << "{\n"
+     << "  \"benchmark\": \"wide_decimal_regress\",\n"
+     << "  \"runs\": " << opts.runs << ",\n"
+     << "  \"min_time_s\": " << opts.min_time << ",\n"
+     << "  \"results\": [\n";
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < results.size(); ++i)
+  {
+    os << "    { \"name\": \"" << results[i].name << "\""
+       << ", \"ns_per_op\": " << std::fixed << std::setprecision(1) << results[i].ns_median
+       << " }" << ((i + 1U < results.size()) ? ",\n" : "\n");
+  }
+
+  os << "  ]\n"
+     << "}\n";
+}
+
+// Print each case against its baseline, and then the regressed cases
+// once more, so that they can be read at a glance. Return true
+// if no case regressed.
+auto compare_with_baseline(const std::vector<result>& results, const std::map<std::string, double>& baseline, const options& opts) -> bool
+{
+  std::cout << "case           baseline ns/op     median ns/op   change  spread" << std::endl;
+
+  std::vector<std::string> regressions { };
+
+  for(const auto& res : results)
+  {
+    std::stringstream strm;
+
+    strm << std::left << std::setw(12) << res.name << std::right;
+
+    const auto spread = static_cast<double>(((res.ns_max - res.ns_min) * 100.0) / res.ns_median);
+
+    const auto it = baseline.find(res.name);
+
+    if(it == baseline.cend())
+    {
+      strm << std::setw(18) << "-"
+           << std::setw(17) << std::fixed << std::setprecision(1) << res.ns_median
+           << std::setw(9)  << "-"
+           << std::setw(7)  << std::setprecision(1) << spread << "%"
+           << "  new";
+    }
+    else
+    {
+      const auto change = static_cast<double>(((res.ns_median - it->second) * 100.0) / it->second);
+
+      const auto is_regressed = (change > opts.threshold_percent);
+
+      strm << std::setw(18) << std::fixed << std::setprecision(1) << it->second
+           << std::setw(17) << res.ns_median
+           << std::setw(8)  << std::showpos << change << std::noshowpos << "%"
+           << std::setw(7)  << spread << "%"
+           << (is_regressed ? "  REGRESSED" : "  ok");
+
+      if(is_regressed)
+      {
+        std::stringstream strm_regression;
+
+        strm_regression << res.name << ": "
+                        << std::fixed << std::setprecision(1) << it->second << " ns -> " << res.ns_median << " ns"
+                        << " (" << std::showpos << change << std::noshowpos << "%, allowed " << opts.threshold_percent << "%)";
+
+        regressions.push_back(strm_regression.str());
+      }
+    }
+
+    std::cout << strm.str() << std::endl;
+  }
+
+  if(!regressions.empty())
+  {
+    std::cout << std::endl << regressions.size() << " of " << results.size() << " cases regressed:" << std::endl;
+
+    for(const auto& regression : regressions) { std::cout << "  " << regression << std::endl; }
+  }
+
+  return regressions.empty();
+}
+
+} // namespace wide_decimal_regress
+
+auto main(int argc, char** argv) -> int // NOLINT(bugprone-exception-escape)
+{
+  using namespace wide_decimal_regress; // NOLINT(google-build-using-namespace)
+
+  options opts { };
+
+  const auto options_are_ok = parse_options(argc, argv, opts);
+
+  if((!options_are_ok) || opts.show_help)
+  {
+    std::cerr << "Usage: wide_decimal_regress [--baseline=FILE] [--write-baseline=FILE] [--threshold=P] "
+                 "[--runs=N] [--warmup=N] [--min-time=S] [--cpu=K] [--cases=mul,log/1000,...]"
+              << std::endl;
+
+    return (options_are_ok ? 0 : 1);
+  }
+
+  std::map<std::string, double> baseline { };
+
+  if(opts.write_baseline_file.empty() && (!read_baseline(opts.baseline_file, baseline)))
+  {
+    std::cerr << "Cannot read the baseline " << opts.baseline_file << std::endl;
+
+    return 1;
+  }
+
+  if((opts.cpu >= 0) && (!pin_to_cpu(opts.cpu)))
+  {
+    std::cerr << "Cannot pin the thread to CPU " << opts.cpu << ", the timings may vary more" << std::endl;
+  }
+
+  std::vector<result> results { };
+
+  for(const auto& rc : all_cases())
+  {
+    if(case_is_selected(rc.name, opts))
+    {
+      results.push_back(run_case(rc, opts));
+    }
+  }
+
+  if(!opts.write_baseline_file.empty())
+  {
+    std::ofstream out(opts.write_baseline_file);
+
+    write_baseline(out, opts, results);
+
+    if(!out.good())
+    {
+      std::cerr << "Cannot write " << opts.write_baseline_file << std::endl;
+
+      return 1;
+    }
+
+    std::cout << "Wrote " << results.size() << " cases to " << opts.write_baseline_file << std::endl;
+
+    return 0;
+  }
+
+  return (compare_with_baseline(results, baseline, opts) ? 0 : 1);
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,281 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Find the crossovers of the schoolbook, Karatsuba and FFT multiplication
+// of decwide_t on this host, for limb types uint8, uint16 and uint32
+// with the default FFT float type double. The tuned thresholds are
+// written as a header that specializes decwide_t_multiplication_thresholds.
+// Include that header before any other use of decwide_t, or pass
+// the printed values to decwide_t::set_multiplication_thresholds()
+// at runtime.
+//
+// Usage: wide_decimal_tune [options]
+//   --min-time=S    minimum measuring time per size and method (default 0.05)
+//   --output=FILE   write the header to FILE (default: stdout)
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+// The tuning types are large, and they do not need the constants.
+#if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/stopwatch.h>
+
+namespace wide_decimal_tune {
+
+struct thresholds
+{
+  unsigned     limb_bits { };
+  std::int32_t kara      { };
+  std::int32_t fft       { };
+};
+
+volatile std::uint32_t tune_sink { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename LimbType, const std::int32_t MaxElems>
+class multiplication_tuner
+{
+public:
+  using limb_type = LimbType;
+
+  static constexpr auto elem_digits10 = static_cast<std::int32_t>(std::numeric_limits<limb_type>::digits10 / 2 * 2);
+
+  using wide_decimal_type = ::math::wide_decimal::decwide_t<static_cast<std::int32_t>(MaxElems * elem_digits10), limb_type, std::allocator<void>>;
+
+  static_assert(wide_decimal_type::decwide_t_elem_number >= wide_decimal_type::decwide_t_elems_for_fft,
+                "Error: The tuning type is too small to compile in FFT multiplication");
+
+  explicit multiplication_tuner(const double min_time) : my_min_time(min_time)
+  {
+    std::mt19937 eng(UINT32_C(0x5EED));
+
+    std::uniform_int_distribution<int> dist_digit(0, 9); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    std::string str_a(static_cast<std::size_t>(MaxElems * elem_digits10), '0');
+    std::string str_b(static_cast<std::size_t>(MaxElems * elem_digits10), '0');
+
+    str_a[static_cast<std::size_t>(UINT8_C(0))] = '3';
+    str_b[static_cast<std::size_t>(UINT8_C(0))] = '7';
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(1)); i < str_a.length(); ++i)
+    {
+      str_a[i] = static_cast<char>('0' + dist_digit(eng));
+      str_b[i] = static_cast<char>('0' + dist_digit(eng));
+    }
+
+    my_a = wide_decimal_type(str_a.c_str());
+    my_b = wide_decimal_type(str_b.c_str());
+  }
+
+  auto tune(const unsigned limb_bits) -> thresholds
+  {
+    constexpr auto never = (std::numeric_limits<std::int32_t>::max)();
+
+    // Karatsuba versus schoolbook, then FFT versus Karatsuba
+    // from the Karatsuba crossover on.
+    const auto kara = crossover(INT32_C(16), (std::min)(INT32_C(2048), MaxElems), never, never, INT32_C(2), never);
+    const auto fft  = crossover(kara, MaxElems, INT32_C(2), never, INT32_C(2), INT32_C(2));
+
+    wide_decimal_type::reset_multiplication_thresholds();
+
+    return { limb_bits, kara, (std::max)(fft, kara) };
+  }
+
+private:
+  const double      my_min_time;
+  wide_decimal_type my_a { };
+  wide_decimal_type my_b { };
+
+  auto time_mul(const std::int32_t elems, const std::int32_t kara, const std::int32_t fft) -> double
+  {
+    static_cast<void>(wide_decimal_type::set_multiplication_thresholds(kara, fft));
+
+    auto a = my_a;
+    auto b = my_b;
+
+    a.precision(static_cast<std::int32_t>(elems * elem_digits10));
+    b.precision(static_cast<std::int32_t>(elems * elem_digits10));
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    auto total_time = 0.0;
+    auto iterations = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto batch = static_cast<std::uint64_t>(UINT8_C(1)); total_time < my_min_time; batch *= 2U)
+    {
+      stopwatch_type my_stopwatch { };
+
+      for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); i < batch; ++i)
+      {
+        auto c = a;
+
+        c *= b;
+
+        tune_sink = static_cast<std::uint32_t>(tune_sink + static_cast<std::uint32_t>(c.crepresentation()[static_cast<std::size_t>(UINT8_C(1))]));
+      }
+
+      total_time += stopwatch_type::elapsed_time<double>(my_stopwatch);
+
+      iterations += batch;
+    }
+
+    return total_time / static_cast<double>(iterations);
+  }
+
+  // The smallest size in [lo, hi] from which on the faster method wins
+  // at three consecutive sizes. Return hi if there is no such size.
+  auto crossover(const std::int32_t lo,
+                 const std::int32_t hi,
+                 const std::int32_t slow_kara,
+                 const std::int32_t slow_fft,
+                 const std::int32_t fast_kara,
+                 const std::int32_t fast_fft) -> std::int32_t
+  {
+    auto wins          = 0;
+    auto first_win     = hi;
+
+    for(auto elems = lo; elems < hi; elems = static_cast<std::int32_t>((std::max)(elems + 1, static_cast<std::int32_t>((elems * 9) / 8)))) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      const auto t_slow = time_mul(elems, slow_kara, slow_fft);
+      const auto t_fast = time_mul(elems, fast_kara, fast_fft);
+
+      if(t_fast < t_slow)
+      {
+        if(wins == 0) { first_win = elems; }
+
+        if(++wins == 3) { return first_win; }
+      }
+      else
+      {
+        wins      = 0;
+        first_win = hi;
+      }
+    }
+
+    return first_win;
+  }
+};
+
+auto write_header(std::ostream& os, const std::vector<thresholds>& tuned) -> void
+{
+  os << "///////////////////////////////////////////////////////////////////////////////\n"
+     << "// Multiplication thresholds of decwide_t tuned on this host by\n"
+     << "// benchmark/wide_decimal_tune.cpp. Include this header before any\n"
+     << "// other use of decwide_t.\n"
+     << "//\n\n"
+     << "#ifndef DECWIDE_T_TUNED_THRESHOLDS_H // NOLINT(llvm-header-guard)\n"
+     << "  #define DECWIDE_T_TUNED_THRESHOLDS_H\n\n"
+     << "  #include <cstdint>\n\n"
+     << "  #include <math/wide_decimal/decwide_t.h>\n\n"
+     << "  WIDE_DECIMAL_NAMESPACE_BEGIN\n\n"
+     << "  #if(__cplusplus >= 201703L)\n"
+     << "  namespace math::wide_decimal {\n"
+     << "  #else\n"
+     << "  namespace math { namespace wide_decimal { // NOLINT(modernize-concat-nested-namespaces)\n"
+     << "  #endif\n";
+
+  for(const auto& t : tuned)
+  {
+    os << "\n"
+       << "  template<>\n"
+       << "  struct decwide_t_multiplication_thresholds<std::uint" << t.limb_bits << "_t, double>\n"
+       << "  {\n"
+       << "    static constexpr auto elems_for_kara() -> std::int32_t { return static_cast<std::int32_t>(INT32_C(" << t.kara << ")); }\n"
+       << "    static constexpr auto elems_for_fft () -> std::int32_t { return static_cast<std::int32_t>(INT32_C(" << t.fft  << ")); }\n"
+       << "  };\n";
+  }
+
+  os << "\n"
+     << "  #if(__cplusplus >= 201703L)\n"
+     << "  } // namespace math::wide_decimal\n"
+     << "  #else\n"
+     << "  } // namespace wide_decimal\n"
+     << "  } // namespace math\n"
+     << "  #endif\n\n"
+     << "  WIDE_DECIMAL_NAMESPACE_END\n\n"
+     << "#endif // DECWIDE_T_TUNED_THRESHOLDS_H\n";
+}
+
+} // namespace wide_decimal_tune
+
+auto main(int argc, char** argv) -> int
+{
+  using namespace wide_decimal_tune; // NOLINT(google-build-using-namespace)
+
+  auto        min_time    = 0.05; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  std::string output_file { };
+
+  for(auto i = 1; i < argc; ++i)
+  {
+    const std::string arg(argv[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    if     (arg.find("--min-time=") == 0U) { min_time    = std::stod(arg.substr(11U)); } // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    else if(arg.find("--output=")   == 0U) { output_file = arg.substr(9U); }             // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    else
+    {
+      std::cerr << "Usage: wide_decimal_tune [--min-time=S] [--output=FILE]" << std::endl;
+
+      return ((arg == "--help") ? 0 : 1);
+    }
+  }
+
+  std::vector<thresholds> tuned { };
+
+  tuned.push_back(multiplication_tuner<std::uint8_t,  INT32_C(16384)>(min_time).tune( 8U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  tuned.push_back(multiplication_tuner<std::uint16_t, INT32_C(16384)>(min_time).tune(16U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  tuned.push_back(multiplication_tuner<std::uint32_t, INT32_C(16384)>(min_time).tune(32U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  for(const auto& t : tuned)
+  {
+    std::cerr << "uint" << std::setw(2) << std::left << t.limb_bits
+              << ": elems_for_kara = " << std::setw(6) << t.kara
+              << "elems_for_fft = "    << t.fft
+              << std::endl;
+  }
+
+  if(output_file.empty())
+  {
+    write_header(std::cout, tuned);
+  }
+  else
+  {
+    std::ofstream out(output_file);
+
+    write_header(out, tuned);
+
+    if(!out.good())
+    {
+      std::cerr << "Cannot write " << output_file << std::endl;
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#pragma GCC diagnostic pop
+#endif
@@ -26,6 +26,7 @@
 #define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
 #define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
 #define WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION
+#define WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK
 
 #include <examples/example_decwide_t.h>
 #include <math/wide_decimal/decwide_t.h>
@@ -348,6 +349,9 @@ namespace example008_bernoulli
       result_is_ok &= (closeness < tol);
     }
 
+    // Every allocation must have been served from the slot memory.
+    result_is_ok &= (wide_decimal_allocator_type::get_slot_failed_allocations() == static_cast<std::size_t>(UINT8_C(0)));
+
     return result_is_ok;
   }
 } // namespace example008_bernoulli
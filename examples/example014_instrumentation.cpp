@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This example counts the kernels run by a square root and an inverse
+// with the optional operation counters. The counters are compiled in
+// by WIDE_DECIMAL_ENABLE_INSTRUMENTATION. The decimal type used here
+// appears in no other translation unit, so that its instrumented
+// member functions do not collide with uninstrumented ones.
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#define WIDE_DECIMAL_ENABLE_INSTRUMENTATION
+#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
+
+#include <examples/example_decwide_t.h>
+#include <math/wide_decimal/decwide_t.h>
+
+namespace example014_instrumentation
+{
+  template<typename DecimalType>
+  auto sqrt_and_inverse() -> bool
+  {
+    using local_decimal_type = DecimalType;
+
+    const local_decimal_type s = sqrt(local_decimal_type(2U));
+
+    const local_decimal_type r = (1 / (s * 3U)) / 7U;
+
+    using std::fabs;
+
+    const local_decimal_type closeness = fabs(1 - ((s * s) / 2));
+    const local_decimal_type delta     = fabs(1 - ((r * 21U) * s));
+
+    return (   (closeness < (std::numeric_limits<local_decimal_type>::epsilon() * static_cast<std::uint32_t>(UINT8_C(10))))
+            && (delta     < (std::numeric_limits<local_decimal_type>::epsilon() * static_cast<std::uint32_t>(UINT8_C(10)))));
+  }
+} // namespace example014_instrumentation
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::math::wide_decimal::example014_instrumentation() -> bool
+#else
+auto ::math::wide_decimal::example014_instrumentation() -> bool
+#endif
+{
+  // With 20011 decimal digits, all three multiplication methods are used.
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using dec20011_t = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(20011), std::uint32_t, std::allocator<void>>;
+
+  namespace instrumentation = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::instrumentation;
+  #else
+  using dec20011_t = ::math::wide_decimal::decwide_t<INT32_C(20011), std::uint32_t, std::allocator<void>>;
+
+  namespace instrumentation = ::math::wide_decimal::instrumentation;
+  #endif
+
+  using instrumentation::counter_kind;
+
+  instrumentation::reset();
+
+  auto result_is_ok = example014_instrumentation::sqrt_and_inverse<dec20011_t>();
+
+  const auto counts_here = instrumentation::thread_snapshot();
+
+  result_is_ok = (   (counts_here.total_calls(counter_kind::sqrt)               == static_cast<std::uint64_t>(UINT8_C(1)))
+                  && (counts_here.total_calls(counter_kind::inv)                >= static_cast<std::uint64_t>(UINT8_C(1)))
+                  && (counts_here.total_calls(counter_kind::newton_step)        >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::mul_school)         >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::mul_kara)           >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::mul_fft)            >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::mul_by_int)         >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::div_by_int)         >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::value_allocation)   >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_calls(counter_kind::scratch_allocation) >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && (counts_here.total_nanoseconds(counter_kind::sqrt)         >  static_cast<std::uint64_t>(UINT8_C(0)))
+                  && result_is_ok);
+
+  // The full-precision multiplications fall into the size bucket of the limb count.
+  result_is_ok = (   (counts_here.calls[static_cast<std::size_t>(counter_kind::mul_fft)][instrumentation::size_bucket(dec20011_t::decwide_t_elem_number)] > static_cast<std::uint64_t>(UINT8_C(0)))
+                  && result_is_ok);
+
+  // The counts of another thread appear in the global snapshot,
+  // also after that thread has exited, but not in this thread's.
+  auto result_of_thread_is_ok = false;
+
+  std::thread other([&result_of_thread_is_ok]() { result_of_thread_is_ok = example014_instrumentation::sqrt_and_inverse<dec20011_t>(); });
+
+  other.join();
+
+  const auto counts_all = instrumentation::snapshot();
+
+  result_is_ok = (   result_of_thread_is_ok
+                  && (instrumentation::thread_snapshot().total_calls(counter_kind::sqrt) == static_cast<std::uint64_t>(UINT8_C(1)))
+                  && (counts_all.total_calls(counter_kind::sqrt)                         == static_cast<std::uint64_t>(UINT8_C(2)))
+                  && (counts_all.total_calls(counter_kind::mul_fft)                      == static_cast<std::uint64_t>(counts_here.total_calls(counter_kind::mul_fft) * 2U))
+                  && result_is_ok);
+
+  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  std::stringstream strm;
+
+  instrumentation::report(strm, counts_all);
+
+  result_is_ok = (   (strm.str().find("mul_fft")   != std::string::npos)
+                  && (strm.str().find("rootn_inv") == std::string::npos)
+                  && result_is_ok);
+  #endif
+
+  instrumentation::reset();
+
+  result_is_ok = (   (instrumentation::snapshot().total_calls(counter_kind::value_allocation) == static_cast<std::uint64_t>(UINT8_C(0)))
+                  && result_is_ok);
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_DECIMAL_STANDALONE_EXAMPLE014_INSTRUMENTATION)
+
+#include <iomanip>
+#include <iostream>
+
+auto main() -> int
+{
+  const auto result_is_ok = ::math::wide_decimal::example014_instrumentation();
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+}
+
+#endif
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#pragma GCC diagnostic pop
+#endif
@@ -56,6 +56,7 @@
   auto example012_rational_floor_ceil    () -> bool;
   auto example013_embeddable_sqrt        () -> bool;
   auto example013a_embeddable_agm        () -> bool;
+  auto example014_instrumentation        () -> bool;
 
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_decimal
@@ -22,12 +22,25 @@
   //#define WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
   //#define WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS
   //#define WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION
+  //#define WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK
+  //#define WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK
+  //#define WIDE_DECIMAL_DISABLE_UINT64_LIMB
+  //#define WIDE_DECIMAL_DISABLE_SIMD_MULTIPLY
+  //#define WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION
+  //#define WIDE_DECIMAL_DISABLE_CHARCONV
+  //#define WIDE_DECIMAL_DISABLE_SERIALIZATION
+  //#define WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS
   //#define WIDE_DECIMAL_NAMESPACE=something_unique // (best if done on the command line)
+  //#define WIDE_DECIMAL_ELEMS_FOR_KARA=113
+  //#define WIDE_DECIMAL_ELEMS_FOR_FFT=1793
 
   #include <math/wide_decimal/decwide_t_detail_ops.h>
 
   #include <util/utility/util_baselexical_cast.h>
 
+  #if (!defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS) || !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK))
+  #include <atomic>
+  #endif
   #include <cmath>
   #include <cstddef>
   #include <cstdlib>
@@ -35,8 +48,10 @@
   #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
   #include <functional>
   #endif
+  #include <iterator>
   #include <limits>
   #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  #include <cstdio>
   #include <iomanip>
   #include <ios>
   #include <iostream>
@@ -53,6 +68,14 @@
   #error WIDE_DECIMAL_NAMESPACE_END is not defined. Ensure that <decwide_t_detail_namespace.h> is properly included.
   #endif
 
+  #if !defined(WIDE_DECIMAL_ELEMS_FOR_KARA)
+  #define WIDE_DECIMAL_ELEMS_FOR_KARA 113 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_DECIMAL_ELEMS_FOR_FFT)
+  #define WIDE_DECIMAL_ELEMS_FOR_FFT 1793 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
   #if (defined(__GNUC__) && (defined(__RL78__) || defined(__riscv)))
   namespace std { using ::ilogb; }
   #endif
@@ -178,6 +201,20 @@
   auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint16_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
   #endif
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10 = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #else
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #endif
+  #endif
+
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType          = std::uint32_t,
            typename AllocatorType     = std::allocator<void>,
@@ -210,6 +247,108 @@
            typename FftFloatType      = double>
   auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #endif
+
+  // The state of the AGM iterations of calc_pi() and calc_ln_two().
+  // The state is handed to a callback after each completed iteration,
+  // where it can be saved (for instance with serialize()). A calculation
+  // which has been interrupted can be resumed from the saved state.
+  // For pi, the values are a, bB, t and s. For ln(2) they are ak and bk.
+  enum class agm_checkpoint_kind : std::uint8_t // NOLINT(performance-enum-size)
+  {
+    none,
+    pi,
+    ln_two
+  };
+
+  template<typename WideDecimalType>
+  struct agm_checkpoint
+  {
+    using value_type = WideDecimalType;
+
+    #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+    using callback_type = std::function<void(const agm_checkpoint&)>;
+    #else
+    using callback_type = void(*)(const agm_checkpoint&);
+    #endif
+
+    agm_checkpoint_kind                                            kind      { agm_checkpoint_kind::none }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint32_t                                                  iteration { };                          // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t                                                   digits10  { };                          // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<value_type, static_cast<std::size_t>(UINT8_C(4))>   values    { };                          // NOLINT(misc-non-private-member-variables-in-classes)
+
+    // The upper limit of the iteration count of each kind of calculation.
+    static constexpr auto max_iteration(const agm_checkpoint_kind the_kind) -> std::uint32_t
+    {
+      return
+        (the_kind == agm_checkpoint_kind::pi)
+          ? static_cast<std::uint32_t>(UINT8_C(48))
+          : ((the_kind == agm_checkpoint_kind::ln_two) ? static_cast<std::uint32_t>(UINT8_C(128))
+                                                       : static_cast<std::uint32_t>(UINT8_C(0)));
+    }
+
+    // A checkpoint of a finished calculation has been reset
+    // to the kind none, and can not be resumed.
+    WIDE_DECIMAL_NODISCARD auto can_resume(const agm_checkpoint_kind other_kind) const -> bool
+    {
+      return (   (kind == other_kind)
+              && (iteration != static_cast<std::uint32_t>(UINT8_C(0)))
+              && (iteration <  max_iteration(kind))
+              && (digits10  == static_cast<std::int32_t>(std::numeric_limits<value_type>::digits10)));
+    }
+
+    // The number of bytes written by serialize().
+    static constexpr auto serialized_size() -> std::size_t
+    {
+      return
+        static_cast<std::size_t>
+        (
+            detail::checkpoint_serialization_format::header_size()
+          + static_cast<std::size_t>(std::tuple_size<decltype(values)>::value * value_type::serialized_size())
+        );
+    }
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+  template<typename WideDecimalType>
+  auto serialize(std::uint8_t* first, std::uint8_t* last, const agm_checkpoint<WideDecimalType>& checkpoint) -> serialize_result;
+
+  template<typename WideDecimalType>
+  auto deserialize(const std::uint8_t* first, const std::uint8_t* last, agm_checkpoint<WideDecimalType>& checkpoint) -> deserialize_result; // NOLINT(google-runtime-references)
+  #endif
+
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, const typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type& pfn_callback_checkpoint, const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10 = nullptr) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type; // NOLINT(google-runtime-references)
+  #else
+  auto calc_pi(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type pfn_callback_checkpoint, void(*pfn_callback_to_report_digits10)(const std::uint32_t) = nullptr) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type; // NOLINT(google-runtime-references)
+  #endif
+
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_ln_two(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, const typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type& pfn_callback_checkpoint) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type; // NOLINT(google-runtime-references)
+  #else
+  auto calc_ln_two(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type pfn_callback_checkpoint) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type; // NOLINT(google-runtime-references)
+  #endif
+
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType          = std::uint32_t,
            typename AllocatorType     = std::allocator<void>,
@@ -234,6 +373,16 @@
            typename FftFloatType      = double>
   auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+  #endif
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr unsigned_long_long_max() -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr signed_long_long_min  () -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto constexpr signed_long_long_max  () -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
@@ -362,6 +511,82 @@
                  FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
 
+  // Global add/sub/mul/div of decwide_t&& with const decwide_t&.
+  // These reuse the storage of the temporary left-hand operand.
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+  // Global add/sub/mul/div of decwide_t&& with all built-in types.
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                      decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+
   // Global add/sub/mul/div of all built-in types with const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&.
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
   auto operator+(SignedIntegralType n,
@@ -412,69 +637,69 @@
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<   std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type;
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type;
 
   // Global comparison operators of const decwide_t& with const decwide_t&.
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator< (const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> bool;
@@ -500,6 +725,51 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename ArithmeticType> auto operator>=(ArithmeticType u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> typename std::enable_if<std::is_arithmetic<ArithmeticType>::value, bool>::type;
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename ArithmeticType> auto operator> (ArithmeticType u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> typename std::enable_if<std::is_arithmetic<ArithmeticType>::value, bool>::type;
 
+  // The numbers of limbs at which multiplication switches from the
+  // schoolbook method to Karatsuba and from Karatsuba to FFT. These are
+  // the defaults of the runtime thresholds of decwide_t, and they also
+  // decide which of the methods are compiled in for a given digit count.
+  // Specialize this template for a limb type and an FFT float type
+  // in order to tune the thresholds at compile time, as is done by the
+  // header written by the tuning utility benchmark/wide_decimal_tune.cpp.
+  template<typename LimbType, typename FftFloatType>
+  struct decwide_t_multiplication_thresholds
+  {
+    static constexpr auto elems_for_kara() -> std::int32_t { return static_cast<std::int32_t>(WIDE_DECIMAL_ELEMS_FOR_KARA); }
+    static constexpr auto elems_for_fft () -> std::int32_t { return static_cast<std::int32_t>(WIDE_DECIMAL_ELEMS_FOR_FFT); }
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  namespace detail {
+
+  inline auto raw_limbs_iword_index() -> int
+  {
+    static const int index { std::ios_base::xalloc() };
+
+    return index;
+  }
+
+  } // namespace detail
+
+  // The stream manipulator raw_limbs selects the raw limb format
+  // of to_chars_raw() for the output of decwide_t and noraw_limbs
+  // restores the decimal format. The input operator of decwide_t
+  // recognizes and reads both formats.
+  inline auto raw_limbs(std::ios_base& ios) -> std::ios_base& // NOLINT(google-runtime-references)
+  {
+    ios.iword(detail::raw_limbs_iword_index()) = 1L;
+
+    return ios;
+  }
+
+  inline auto noraw_limbs(std::ios_base& ios) -> std::ios_base& // NOLINT(google-runtime-references)
+  {
+    ios.iword(detail::raw_limbs_iword_index()) = 0L;
+
+    return ios;
+  }
+  #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType,
            typename AllocatorType,
@@ -515,11 +785,20 @@
     using internal_float_type = InternalFloatType;
 
     // Check the limb type.
+    #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+    static_assert((   std::is_same<std::uint8_t,  limb_type>::value
+                   || std::is_same<std::uint16_t, limb_type>::value
+                   || std::is_same<std::uint32_t, limb_type>::value
+                   || std::is_same<std::uint64_t, limb_type>::value),
+                   "Error: limb_type (template parameter LimbType) "
+                   "must be one of uint8_t, uint16_t, uint32_t or uint64_t.");
+    #else
     static_assert((   std::is_same<std::uint8_t,  limb_type>::value
                    || std::is_same<std::uint16_t, limb_type>::value
                    || std::is_same<std::uint32_t, limb_type>::value),
                    "Error: limb_type (template parameter LimbType) "
                    "must be one of uint8_t, uint16_t or uint32_t.");
+    #endif
 
     // Check the exponent type.
     static_assert((   std::is_same<std::int8_t,  exponent_type>::value
@@ -529,18 +808,24 @@
                    "Error: exponent_type (template parameter ExponentType) "
                    "must be one of int8_t, int16_t, int32_t or int64_t.");
 
+    // The type of the limb base, which is 64 bits wide for std::uint64_t limbs.
+    using elem_mask_type = typename detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_type;
+
     // Define the decwide_t digits characteristics.
-    static constexpr std::int32_t  decwide_t_digits10       = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::digits10;
-    static constexpr std::int32_t  decwide_t_digits         = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::digits;
-    static constexpr std::int32_t  decwide_t_max_digits10   = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::max_digits10;
-    static constexpr std::int32_t  decwide_t_radix          = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::radix;
-    static constexpr std::int32_t  decwide_t_elem_digits10  = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_digits10;
-    static constexpr std::int32_t  decwide_t_elem_number    = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_number;
-    static constexpr std::int32_t  decwide_t_elem_mask      = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask;
-    static constexpr std::int32_t  decwide_t_elem_mask_half = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_half;
-    static constexpr std::int32_t  decwide_t_elem_mask_min1 = static_cast<std::int32_t>(decwide_t_elem_mask - static_cast<std::int32_t>(INT8_C(1)));
-    static constexpr std::int32_t  decwide_t_elems_for_kara = static_cast<std::int32_t>(INT32_C( 112) + INT32_C(1));
-    static constexpr std::int32_t  decwide_t_elems_for_fft  = static_cast<std::int32_t>(INT32_C(1792) + INT32_C(1));
+    static constexpr std::int32_t   decwide_t_digits10       = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::digits10;
+    static constexpr std::int32_t   decwide_t_digits         = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::digits;
+    static constexpr std::int32_t   decwide_t_max_digits10   = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::max_digits10;
+    static constexpr std::int32_t   decwide_t_radix          = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::radix;
+    static constexpr std::int32_t   decwide_t_elem_digits10  = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_digits10;
+    static constexpr std::int32_t   decwide_t_elem_number    = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_number;
+    static constexpr elem_mask_type decwide_t_elem_mask      = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask;
+    static constexpr elem_mask_type decwide_t_elem_mask_half = detail::decwide_t_helper<ParamDigitsBaseTen, LimbType>::elem_mask_half;
+    static constexpr elem_mask_type decwide_t_elem_mask_min1 = static_cast<elem_mask_type>(decwide_t_elem_mask - static_cast<elem_mask_type>(INT8_C(1)));
+    static constexpr std::int32_t   decwide_t_elems_for_kara = decwide_t_multiplication_thresholds<LimbType, FftFloatType>::elems_for_kara();
+    static constexpr std::int32_t   decwide_t_elems_for_fft  = decwide_t_multiplication_thresholds<LimbType, FftFloatType>::elems_for_fft();
+
+    static_assert((decwide_t_elems_for_kara > static_cast<std::int32_t>(INT8_C(1))) && (decwide_t_elems_for_fft >= decwide_t_elems_for_kara),
+                  "Error: The multiplication thresholds must satisfy 1 < elems_for_kara <= elems_for_fft.");
 
     static constexpr exponent_type decwide_t_max_exp10      =  static_cast<exponent_type>(UINTMAX_C(1) << static_cast<unsigned>(std::numeric_limits<exponent_type>::digits - (std::is_same<exponent_type, std::int64_t>::value ? 4 : (std::is_same<exponent_type, std::int32_t>::value ? 3 : (std::is_same<exponent_type, std::int16_t>::value ? 2 : 1)))));
     static constexpr exponent_type decwide_t_min_exp10      = -static_cast<exponent_type>(decwide_t_max_exp10);
@@ -561,7 +846,7 @@
       typename std::conditional<is_void_allocator(),
       #endif
                                 std::allocator<void>,
-                                AllocatorType>::type;
+                                typename detail::representation_allocator<AllocatorType>::type>::type;
 
   public:
     using allocator_type =
@@ -579,14 +864,15 @@
       typename std::conditional<is_void_allocator(),
       #endif
                                 detail::fixed_static_array <limb_type, static_cast<std::size_t>(decwide_t_elem_number)>,
+                                #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+                                typename std::conditional<detail::representation_allocator<AllocatorType>::is_shared(),
+                                                          detail::shared_fixed_dynamic_array<limb_type, static_cast<std::size_t>(decwide_t_elem_number), allocator_type>,
+                                                          detail::fixed_dynamic_array       <limb_type, static_cast<std::size_t>(decwide_t_elem_number), allocator_type>>::type>::type;
+                                #else
                                 detail::fixed_dynamic_array<limb_type, static_cast<std::size_t>(decwide_t_elem_number), allocator_type>>::type;
+                                #endif
 
-    using double_limb_type =
-      typename std::conditional<std::is_same<limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using double_limb_type = typename detail::decwide_t_helper_base<limb_type>::double_limb_type;
 
     using signed_limb_type = typename std::make_signed<limb_type>::type;
 
@@ -631,15 +917,6 @@
     // LCOV_EXCL_STOP
     #endif
 
-    #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
-    static auto wr_string(const decwide_t&         x,
-                                std::string&       str, // NOLINT(google-runtime-references)
-                                std::ios::fmtflags ostrm_flags,
-                                std::streamsize    ostrm_precision,
-                                std::streamsize    ostrm_width,
-                                char               ostrm_fill = ' ') -> void; // NOLINT(readability-function-cognitive-complexity,google-runtime-references)
-    #endif
-
   public:
     // Default constructor.
     constexpr decwide_t() noexcept
@@ -825,24 +1102,27 @@
         my_exp = e;
         my_neg = b_neg;
 
+        // The leading limb holds at least one digit of the mantissa,
+        // and the remaining digits fill the limbs after it.
         constexpr auto digit_elem_whole =
           static_cast<int>
           (
-              std::numeric_limits<internal_float_type>::max_digits10
+              static_cast<int>(std::numeric_limits<internal_float_type>::max_digits10 - 1)
             / static_cast<int>(decwide_t_elem_digits10)
           );
 
         constexpr auto digit_elem_mod =
           static_cast<int>
           (
-              std::numeric_limits<internal_float_type>::max_digits10
+              static_cast<int>(std::numeric_limits<internal_float_type>::max_digits10 - 1)
             % static_cast<int>(decwide_t_elem_digits10)
           );
 
         constexpr auto digit_loops = // NOLINT(altera-id-dependent-backward-branch)
           static_cast<int>
           (
-              digit_elem_whole
+              static_cast<int>(INT8_C(1))
+            + digit_elem_whole
             + static_cast<int>
               (
                 (digit_elem_mod != static_cast<int>(INT8_C(0)))
@@ -905,10 +1185,134 @@
       return *this;
     }
 
-    WIDE_DECIMAL_NODISCARD auto  representation()       noexcept ->       representation_type& { return my_data; }
+    WIDE_DECIMAL_NODISCARD auto  representation()                ->       representation_type& { detail::make_representation_unique(my_data); return my_data; }
     WIDE_DECIMAL_NODISCARD auto  representation() const noexcept -> const representation_type& { return my_data; }
     WIDE_DECIMAL_NODISCARD auto crepresentation() const noexcept -> const representation_type& { return my_data; }
 
+    // The number of bytes written by serialize().
+    static constexpr auto serialized_size() -> std::size_t
+    {
+      return
+        static_cast<std::size_t>
+        (
+            detail::serialization_format::header_size()
+          + static_cast<std::size_t>(static_cast<std::size_t>(decwide_t_elem_number) * sizeof(limb_type))
+        );
+    }
+
+    // The maximum number of characters written by to_chars_raw().
+    static constexpr auto raw_chars_max_size() -> std::size_t
+    {
+      return
+        static_cast<std::size_t>
+        (
+            static_cast<std::size_t>(UINT8_C(48))
+          + static_cast<std::size_t>(static_cast<std::size_t>(decwide_t_elem_number) * static_cast<std::size_t>(sizeof(limb_type) * 2U))
+        );
+    }
+
+    // The runtime thresholds (in limbs) of the multiplication methods
+    // of this type. They start out at the compile-time thresholds of
+    // decwide_t_multiplication_thresholds. They select among the methods
+    // compiled in for this digit count, so Karatsuba is only ever used
+    // if decwide_t_elem_number >= decwide_t_elems_for_kara, and FFT
+    // only if decwide_t_elem_number >= decwide_t_elems_for_fft.
+    // With WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS, the thresholds
+    // are the compile-time ones and can not be changed.
+    #if !defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS)
+    static auto elems_for_kara() -> std::int32_t { return my_multiplication_thresholds.elems_for_kara.load(std::memory_order_relaxed); }
+    static auto elems_for_fft () -> std::int32_t { return my_multiplication_thresholds.elems_for_fft.load (std::memory_order_relaxed); }
+
+    static auto set_multiplication_thresholds(const std::int32_t kara, const std::int32_t fft) -> bool
+    {
+      // Without dynamic memory allocation, the static scratch pools
+      // are sized for the compile-time thresholds, which are then
+      // the upper limits of the runtime thresholds.
+      const auto thresholds_are_ok =
+        (
+             (kara > static_cast<std::int32_t>(INT8_C(1)))
+          && (fft  >= kara)
+          #if defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+          && (kara <= decwide_t_elems_for_kara)
+          && (fft  <= decwide_t_elems_for_fft)
+          #endif
+        );
+
+      if(thresholds_are_ok)
+      {
+        my_multiplication_thresholds.elems_for_kara.store(kara, std::memory_order_relaxed);
+        my_multiplication_thresholds.elems_for_fft.store (fft,  std::memory_order_relaxed);
+      }
+
+      return thresholds_are_ok;
+    }
+
+    static auto reset_multiplication_thresholds() -> void
+    {
+      static_cast<void>(set_multiplication_thresholds(decwide_t_elems_for_kara, decwide_t_elems_for_fft));
+    }
+    #else
+    static constexpr auto elems_for_kara() -> std::int32_t { return decwide_t_elems_for_kara; }
+    static constexpr auto elems_for_fft () -> std::int32_t { return decwide_t_elems_for_fft; }
+    #endif
+
+    // Unless the bound of its round-off error lies within
+    // fft_roundoff_limit(), the FFT multiplication measures how far the
+    // coefficients of its inverse transform lie from the nearest integers.
+    // If that round-off error exceeds fft_roundoff_limit(), the product is
+    // recomputed exactly with Karatsuba multiplication. The worst round-off
+    // error measured and the number of such fallbacks are kept per type.
+    // Both stay zero with WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK.
+    static constexpr auto fft_roundoff_limit() -> fft_float_type { return static_cast<fft_float_type>(detail::fft::template_half<fft_float_type>() / 2); }
+
+    // The number of points (1, 2 or 4, and 3 or 6 for 18-digit limbs)
+    // into which the FFT multiplication of prec_elems limbs splits each
+    // limb. It is the smallest number for which an upper bound of the
+    // round-off error stays within fft_roundoff_limit(). Without dynamic
+    // memory allocation, the static FFT pools are sized for half-limbs,
+    // which are then the smallest points.
+    static auto fft_points_per_limb(const std::int32_t prec_elems) -> std::uint32_t
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      constexpr auto max_points_per_limb =
+        static_cast<std::uint32_t>
+        (
+          (decwide_t_elem_digits10 > static_cast<std::int32_t>(INT8_C(8))) ? static_cast<std::uint32_t>(UINT8_C(6))
+                                                                            : static_cast<std::uint32_t>(UINT8_C(4))
+        );
+      #else
+      constexpr auto max_points_per_limb = static_cast<std::uint32_t>(UINT8_C(2));
+      #endif
+
+      return detail::fft_points_per_limb<limb_type, fft_float_type>(prec_elems, max_points_per_limb, static_cast<double>(fft_roundoff_limit()));
+    }
+
+    static auto fft_roundoff_worst() -> fft_float_type
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+      return my_fft_roundoff_statistics().worst_roundoff.load(std::memory_order_relaxed);
+      #else
+      return static_cast<fft_float_type>(0);
+      #endif
+    }
+
+    static auto fft_fallback_count() -> std::uint32_t
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+      return my_fft_roundoff_statistics().fallback_count.load(std::memory_order_relaxed);
+      #else
+      return static_cast<std::uint32_t>(UINT8_C(0));
+      #endif
+    }
+
+    static auto reset_fft_roundoff_statistics() -> void
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+      my_fft_roundoff_statistics().worst_roundoff.store(static_cast<fft_float_type>(0.0F), std::memory_order_relaxed);
+      my_fft_roundoff_statistics().fallback_count.store(static_cast<std::uint32_t>(UINT8_C(0)), std::memory_order_relaxed);
+      #endif
+    }
+
     // Binary arithmetic operators.
     auto operator+=(const decwide_t& v) -> decwide_t& // NOLINT(readability-function-cognitive-complexity)
     {
@@ -966,8 +1370,10 @@
                                    : -static_cast<std::int32_t>(ofs_exp.get_value_unsigned() / static_cast<unsigned_exponent_type>(decwide_t_elem_digits10)))
         );
 
+      detail::make_representation_unique(my_data);
+
       #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      representation_type my_n_data_for_add_sub;
+      auto my_n_data_for_add_sub = detail::make_representation_like(my_data);
       #endif
 
       if(my_neg == v.my_neg)
@@ -1221,6 +1627,10 @@
 
     auto operator*=(const decwide_t& v) -> decwide_t&
     {
+      const detail::operation_allocation_scope<AllocatorType> allocation_scope("mul");
+
+      detail::make_representation_unique(my_data);
+
       // Handle multiplication by zero.
       if(iszero() || v.iszero())
       {
@@ -1309,6 +1719,8 @@
 
     auto operator/=(const decwide_t& v) -> decwide_t&
     {
+      const detail::operation_allocation_scope<AllocatorType> allocation_scope("div");
+
       const auto u_and_v_are_identical =
         (   (my_fpclass == v.my_fpclass)
          && (my_exp     == v.my_exp)
@@ -1353,6 +1765,8 @@
 
     auto mul_unsigned_long_long(unsigned long long n) -> decwide_t& // NOLINT(google-runtime-int)
     {
+      detail::make_representation_unique(my_data);
+
       // Multiply *this with a constant unsigned long long.
 
       // Evaluate the sign of the result.
@@ -1399,6 +1813,8 @@
       }
 
       // Set up the multiplication loop.
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_by_int, my_prec_elem);
+
       const auto nn    = static_cast<limb_type>(n);
       const auto carry = detail::mul_loop_n(my_data.data(), nn, my_prec_elem);
 
@@ -1423,6 +1839,8 @@
 
     auto div_unsigned_long_long(unsigned long long n) -> decwide_t& // NOLINT(google-runtime-int)
     {
+      detail::make_representation_unique(my_data);
+
       // Divide *this by a constant unsigned long long.
 
       // Evaluate the sign of the result.
@@ -1455,6 +1873,8 @@
       if(nn > static_cast<limb_type>(UINT8_C(1)))
       {
         // Do the division loop.
+        WIDE_DECIMAL_INSTRUMENT_SCOPE(div_by_int, my_prec_elem);
+
         const auto prev = detail::div_loop_n(my_data.data(), nn, my_prec_elem);
 
         using local_size_type = typename representation_type::size_type;
@@ -1486,10 +1906,10 @@
           const auto val_prev =
             static_cast<limb_type>
             (
-                static_cast<std::uint64_t>
+                static_cast<double_limb_type>
                 (
-                    static_cast<std::uint64_t>(prev)
-                  * static_cast<std::uint32_t>(decwide_t_elem_mask)
+                    static_cast<double_limb_type>(prev)
+                  * static_cast<limb_type>(decwide_t_elem_mask)
                 )
               / nn
             );
@@ -1674,6 +2094,9 @@
     {
       my_initializer.do_nothing();
 
+      // The cached value is not cancelled along with a calculation.
+      WIDE_DECIMAL_PROGRESS_SUSPEND();
+
       static const decwide_t
         val
         (
@@ -1687,6 +2110,9 @@
     {
       my_initializer.do_nothing();
 
+      // The cached value is not cancelled along with a calculation.
+      WIDE_DECIMAL_PROGRESS_SUSPEND();
+
       static const decwide_t
         val
         (
@@ -1740,7 +2166,7 @@
 
     auto swap(decwide_t&& other) noexcept -> void
     {
-      my_data.swap(static_cast<representation_type&&>(other.my_data));
+      my_data.swap(other.my_data);
 
       std::swap(my_exp,       other.my_exp);
       std::swap(my_neg,       other.my_neg);
@@ -1751,6 +2177,8 @@
     // Elementary primitives.
     auto calculate_inv() -> decwide_t&
     {
+      const detail::operation_allocation_scope<AllocatorType> allocation_scope("inv");
+
       // Compute the inverse of *this.
       // Handle the special case of zero.
       if(iszero())
@@ -1763,6 +2191,8 @@
         return *this;
       }
 
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(inv, my_prec_elem);
+
       const auto b_neg = my_neg;
 
       my_neg = false;
@@ -1799,6 +2229,11 @@
                digits  < static_cast<std::int32_t>(original_prec_elem * decwide_t_elem_digits10); // NOLINT(altera-id-dependent-backward-branch)
                digits *= static_cast<std::int32_t>(INT8_C(2)))
       {
+        if(!WIDE_DECIMAL_PROGRESS(inv, digits, original_prec_elem * decwide_t_elem_digits10))
+        {
+          break;
+        }
+
         // Adjust precision of the terms.
         const auto min_elem_digits10_plus_one =
           (std::min)
@@ -1817,6 +2252,8 @@
           precision(new_prec_as_digits10);
         x.precision(new_prec_as_digits10);
 
+        WIDE_DECIMAL_INSTRUMENT_COUNT(newton_step, my_prec_elem);
+
         // Next iteration of *this.
         static_cast<void>
         (
@@ -1833,6 +2270,8 @@
 
     auto calculate_sqrt() -> decwide_t&
     {
+      const detail::operation_allocation_scope<AllocatorType> allocation_scope("sqrt");
+
       // Compute the square root of *this.
 
       if(isneg())
@@ -1850,6 +2289,8 @@
         return *this;
       }
 
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(sqrt, my_prec_elem);
+
       // Use the original value of *this for iteration below.
       decwide_t x(*this);
 
@@ -1913,6 +2354,11 @@
                digits  < static_cast<std::int32_t>(original_prec_elem * decwide_t_elem_digits10); // NOLINT(altera-id-dependent-backward-branch)
                digits *= static_cast<std::int32_t>(INT8_C(2)))
       {
+        if(!WIDE_DECIMAL_PROGRESS(sqrt, digits, original_prec_elem * decwide_t_elem_digits10))
+        {
+          break;
+        }
+
         // Adjust precision of the terms.
         const auto min_elem_digits10_plus_one =
           (std::min)
@@ -1932,6 +2378,8 @@
         vi.precision(new_prec_as_digits10);
          x.precision(new_prec_as_digits10);
 
+        WIDE_DECIMAL_INSTRUMENT_COUNT(newton_step, my_prec_elem);
+
         // Next iteration of vi
         vi += vi * (((*this * vi) * static_cast<std::int32_t>(INT8_C(-2))) + one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
 
@@ -1949,6 +2397,8 @@
 
     auto calculate_rootn_inv(std::int32_t p) -> decwide_t&
     {
+      const detail::operation_allocation_scope<AllocatorType> allocation_scope("rootn_inv");
+
       // Compute the inverse of the n'th root of *this.
       // In other words compute the value of [1 / (rootn of *this)]
       // with n = p.
@@ -1965,6 +2415,8 @@
       }
       // LCOV_EXCL_STOP
 
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(rootn_inv, my_prec_elem);
+
       // Use the original value of *this for iteration below.
       decwide_t x(*this);
 
@@ -2001,6 +2453,11 @@
                digits  < static_cast<std::int32_t>(original_prec_elem * decwide_t_elem_digits10); // NOLINT(altera-id-dependent-backward-branch)
                digits *= static_cast<std::int32_t>(INT8_C(2)))
       {
+        if(!WIDE_DECIMAL_PROGRESS(rootn_inv, digits, original_prec_elem * decwide_t_elem_digits10))
+        {
+          break;
+        }
+
         // Adjust precision of the terms.
         const auto min_elem_digits10_plus_one =
           (std::min)
@@ -2019,6 +2476,8 @@
           precision(new_prec_as_digits10);
         x.precision(new_prec_as_digits10);
 
+        WIDE_DECIMAL_INSTRUMENT_COUNT(newton_step, my_prec_elem);
+
         // Perform the next iteration.
         decwide_t
           term
@@ -2206,24 +2665,27 @@
           static_cast<internal_float_type>(1.0F) / static_cast<internal_float_type>(p10)
         );
 
+      // The leading limb holds at least one digit of the mantissa,
+      // and the remaining digits are in the limbs after it.
       constexpr auto digit_loops_elem_digits10_div =
         static_cast<std::int32_t>
         (
-            static_cast<std::int32_t>(std::numeric_limits<internal_float_type>::max_digits10)
+            static_cast<std::int32_t>(std::numeric_limits<internal_float_type>::max_digits10 - 1)
           / static_cast<std::int32_t>(decwide_t_elem_digits10)
         );
 
       constexpr auto digit_loops_elem_digits10_mod =
         static_cast<std::int32_t>
         (
-            static_cast<std::int32_t>(std::numeric_limits<internal_float_type>::max_digits10)
+            static_cast<std::int32_t>(std::numeric_limits<internal_float_type>::max_digits10 - 1)
           % static_cast<std::int32_t>(decwide_t_elem_digits10)
         );
 
       constexpr auto digit_loops = // NOLINT(altera-id-dependent-backward-branch)
         static_cast<std::int32_t>
         (
-            digit_loops_elem_digits10_div
+            static_cast<std::int32_t>(INT8_C(1))
+          + digit_loops_elem_digits10_div
           + static_cast<std::int32_t>
             (
               (digit_loops_elem_digits10_mod != static_cast<std::int32_t>(INT8_C(0)))
@@ -2548,12 +3010,91 @@
       return unsigned_long_long_result;
     }
 
-    explicit operator long double() const { return                     extract_long_double(); }
-    explicit operator double     () const { return static_cast<double>(extract_long_double()); }
-    explicit operator float      () const { return static_cast<float> (extract_long_double()); }
+    template<typename FloatingPointType>
+    WIDE_DECIMAL_NODISCARD auto extract_builtin_float_type() const -> FloatingPointType
+    {
+      // Returns the floating-point value nearest to *this,
+      // with ties being rounded to even. The result is correctly
+      // rounded as long as the precision of decwide_t resolves the
+      // midpoints between adjacent floating-point values (otherwise
+      // it is faithfully rounded). Subnormal results and results
+      // overflowing the floating-point range are not corrected.
 
-    template<typename IntegralType,
-             typename = typename std::enable_if<std::is_integral<IntegralType>::value>::type>
+      using local_float_type = FloatingPointType;
+
+      static_assert(std::is_floating_point<local_float_type>::value,
+                    "Error: The floating-point type must be a built-in floating-point type");
+
+      if(iszero())
+      {
+        return static_cast<local_float_type>(0.0F);
+      }
+
+      decwide_t xx(*this);
+
+      xx.my_neg = false;
+
+      auto result = local_float_type { };
+
+      if(!xx.extract_builtin_float_type_fast_path(result))
+      {
+        // Get an estimate from the leading decimal digits.
+        // extract_long_double() converts at least max_digits10 + 1
+        // leading digits of *this with strtold(). These are within
+        // 10^(-max_digits10) (relative) of *this, which is less than
+        // 0.2 ulp of long double. With a correctly rounding strtold(),
+        // the estimate is thus within 0.7 ulp of long double, and after
+        // rounding to local_float_type within one ulp of this type.
+        // The nearest value is then the estimate or one of its two
+        // neighbors, which is decided by at most two comparisons with
+        // the exact midpoints between them.
+        result = static_cast<local_float_type>(xx.extract_long_double());
+
+        using std::nextafter;
+
+        const auto result_is_normal =
+          (
+               (result >= (std::numeric_limits<local_float_type>::min)())
+            && (result <= (std::numeric_limits<local_float_type>::max)())
+          );
+
+        if(result_is_normal)
+        {
+          const auto result_is_odd =
+            ((detail::template native_float_parts<local_float_type>(result).get_mantissa() & 1U) != 0U);
+
+          const auto result_up = nextafter(result, (std::numeric_limits<local_float_type>::max)());
+          const auto result_dn = nextafter(result, static_cast<local_float_type>(0.0F));
+
+          // Ties go to the even one of the two neighbors.
+          const auto cmp_up =
+            ((result_up <= (std::numeric_limits<local_float_type>::max)()) ? xx.cmp(binary_float_midpoint_up(result)) : -1);
+
+          if((cmp_up > 0) || ((cmp_up == 0) && result_is_odd))
+          {
+            result = result_up;
+          }
+          else if(result_dn >= (std::numeric_limits<local_float_type>::min)())
+          {
+            const auto cmp_dn = xx.cmp(binary_float_midpoint_up(result_dn));
+
+            if((cmp_dn < 0) || ((cmp_dn == 0) && result_is_odd))
+            {
+              result = result_dn;
+            }
+          }
+        }
+      }
+
+      return ((!my_neg) ? result : -result);
+    }
+
+    explicit operator long double() const { return extract_builtin_float_type<long double>(); }
+    explicit operator double     () const { return extract_builtin_float_type<double>(); }
+    explicit operator float      () const { return extract_builtin_float_type<float>(); }
+
+    template<typename IntegralType,
+             typename = typename std::enable_if<std::is_integral<IntegralType>::value>::type>
     explicit constexpr operator IntegralType() const
     {
       return
@@ -2624,13 +3165,58 @@
   private:
     #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
     #else
+    // The largest Karatsuba multiplication, which includes the fallback
+    // of the FFT multiplication at full precision. There is no fallback
+    // if the round-off error bound of half-limbs (the smallest points
+    // without dynamic memory allocation) is met at full precision,
+    // since it is then met at every smaller precision, too.
+    #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+    static constexpr auto decwide_t_fft_can_fall_back =
+      (
+           (decwide_t_elem_number >= decwide_t_elems_for_fft)
+        && (!(  detail::fft_roundoff_bound_of_limbs<limb_type, fft_float_type>(decwide_t_elem_number, static_cast<std::uint32_t>(UINT8_C(2)))
+              <= static_cast<double>(detail::fft::template_half<fft_float_type>() / 2)))
+      );
+
+    static constexpr auto decwide_t_elems_for_kara_pool = static_cast<std::int32_t>(decwide_t_fft_can_fall_back ? decwide_t_elem_number : static_cast<std::int32_t>(decwide_t_elems_for_fft - 1));
+    #else
+    static constexpr auto decwide_t_elems_for_kara_pool = static_cast<std::int32_t>(decwide_t_elems_for_fft - 1);
+    #endif
+
     static std::array<limb_type,      static_cast<std::size_t>((decwide_t_elems_for_kara - 1) * 2)>                                                                                               my_school_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_fft - 1)) * 8UL))> my_kara_mul_pool;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    static std::array<limb_type,      static_cast<std::size_t>(detail::a029750::a029750_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elems_for_kara_pool)) * 8UL))>    my_kara_mul_pool;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
     static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_af_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     static std::array<fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_elem_number)) * 4UL))>       my_bf_fft_mul_pool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     static representation_type my_n_data_for_add_sub; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
     #endif
 
+    #if !defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS)
+    struct multiplication_thresholds_type
+    {
+      std::atomic<std::int32_t> elems_for_kara; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::atomic<std::int32_t> elems_for_fft;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    // The thresholds are constant-initialized, so reading
+    // them needs no guard of a function-local static.
+    static multiplication_thresholds_type my_multiplication_thresholds; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    #endif
+
+    #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+    struct fft_roundoff_statistics_type
+    {
+      std::atomic<fft_float_type> worst_roundoff; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::atomic<std::uint32_t>  fallback_count; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    static auto my_fft_roundoff_statistics() -> fft_roundoff_statistics_type&
+    {
+      static fft_roundoff_statistics_type statistics { { static_cast<fft_float_type>(0.0F) }, { static_cast<std::uint32_t>(UINT8_C(0)) } };
+
+      return statistics;
+    }
+    #endif
+
     representation_type my_data;      // NOLINT(readability-identifier-naming)
     exponent_type       my_exp;       // NOLINT(readability-identifier-naming)
     bool                my_neg;       // NOLINT(readability-identifier-naming,modernize-use-default-member-init)
@@ -2677,6 +3263,8 @@
 
     auto from_unsigned_long_long(unsigned long long u) -> void // NOLINT(google-runtime-int)
     {
+      detail::make_representation_unique(my_data);
+
       my_exp = static_cast<exponent_type>(INT8_C(0));
 
       auto i = static_cast<std::uint_fast32_t>(UINT8_C(0));
@@ -2746,35 +3334,350 @@
                 static_cast<limb_type>(UINT8_C(0)));
     }
 
+    template<typename FloatingPointType>
+    auto extract_builtin_float_type_fast_path(FloatingPointType& result) const -> bool // NOLINT(google-runtime-references)
+    {
+      // Use Clinger's fast path if *this is an integer significand
+      // that fits in the mantissa of FloatingPointType, scaled by
+      // a power of ten that is exactly representable. Then a single
+      // multiplication or division is correctly rounded.
+      using local_float_type = FloatingPointType;
+
+      constexpr auto max_exact_pow10 =
+        static_cast<exponent_type>
+        (
+          (static_cast<std::int32_t>(std::numeric_limits<local_float_type>::digits) * INT32_C(43067)) / INT32_C(100000)
+        );
+
+      constexpr auto max_significand_elems =
+        static_cast<std::int32_t>
+        (
+          (std::min)(static_cast<std::int32_t>(std::numeric_limits<unsigned long long>::digits10 / decwide_t_elem_digits10), decwide_t_elem_number) // NOLINT(google-runtime-int)
+        );
+
+      using local_size_type = typename representation_type::size_type;
+
+      const auto it_last_nonzero =
+        std::find_if(my_data.crbegin() + static_cast<std::ptrdiff_t>(decwide_t_elem_number - my_prec_elem),
+                     my_data.crend(),
+                     [](const limb_type& limb) { return (limb != static_cast<limb_type>(UINT8_C(0))); }); // NOLINT(modernize-use-trailing-return-type)
+
+      const auto significand_elems = static_cast<std::int32_t>(std::distance(it_last_nonzero, my_data.crend()));
+
+      if(significand_elems > max_significand_elems)
+      {
+        return false;
+      }
+
+      auto significand = static_cast<unsigned long long>(UINT8_C(0)); // NOLINT(google-runtime-int)
+
+      for(auto i = static_cast<local_size_type>(UINT8_C(0)); i < static_cast<local_size_type>(significand_elems); ++i)
+      {
+        significand *= static_cast<unsigned long long>(decwide_t_elem_mask); // NOLINT(google-runtime-int)
+        significand += static_cast<unsigned long long>(my_data[i]);          // NOLINT(google-runtime-int)
+      }
+
+      const auto exp10 =
+        static_cast<exponent_type>
+        (
+          my_exp - static_cast<exponent_type>(static_cast<exponent_type>(significand_elems - 1) * static_cast<exponent_type>(decwide_t_elem_digits10))
+        );
+
+      constexpr auto float_digits_cover_significand =
+        (std::numeric_limits<local_float_type>::digits >= std::numeric_limits<unsigned long long>::digits); // NOLINT(google-runtime-int)
+
+      constexpr auto significand_shift =
+        static_cast<unsigned>(float_digits_cover_significand ? 0 : std::numeric_limits<local_float_type>::digits);
+
+      const auto significand_is_exact = (float_digits_cover_significand || ((significand >> significand_shift) == 0U));
+
+      if(   (!significand_is_exact)
+         || (exp10 > max_exact_pow10)
+         || (exp10 < static_cast<exponent_type>(-max_exact_pow10)))
+      {
+        return false;
+      }
+
+      auto pow10 = static_cast<local_float_type>(1.0F);
+
+      for(auto i = static_cast<exponent_type>(INT8_C(0)); i < ((exp10 < 0) ? -exp10 : exp10); ++i)
+      {
+        pow10 *= static_cast<local_float_type>(10.0F);
+      }
+
+      result =
+        (exp10 < 0) ? static_cast<local_float_type>(static_cast<local_float_type>(significand) / pow10)
+                    : static_cast<local_float_type>(static_cast<local_float_type>(significand) * pow10);
+
+      return true;
+    }
+
     template<typename FloatingPointType>
     auto from_builtin_float_type(FloatingPointType flt) -> void
     {
+      detail::make_representation_unique(my_data);
+
       const auto b_neg = (flt < static_cast<FloatingPointType>(0.0F));
 
       const detail::template native_float_parts<FloatingPointType> ld_parts((!b_neg) ? flt : -flt);
 
-      // Create a decwide_t from the fractional part of the
-      // mantissa expressed as an unsigned long long.
-      from_unsigned_long_long(ld_parts.get_mantissa());
-
-      // Scale the unsigned long long representation to the fractional
-      // part of the long double and multiply with the base-2 exponent.
-      const auto p2 =
+      // Scale the integral mantissa with the base-2 exponent.
+      from_binary_float_parts<FloatingPointType>
+      (
+        ld_parts.get_mantissa(),
         static_cast<int>
         (
             ld_parts.get_exponent()
           - static_cast<int>(std::numeric_limits<FloatingPointType>::digits - static_cast<int>(INT8_C(1)))
+        )
+      );
+
+      my_neg = (b_neg && (!iszero()));
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+    template<typename FloatingPointType>
+    static auto make_binary_float_scale_table() -> detail::binary_float_scale_table<decwide_t, FloatingPointType>
+    {
+      // Compute each power only to the precision that it needs,
+      // so that setting up the table does not depend on the
+      // precision of decwide_t, once this exceeds the table range.
+      detail::binary_float_scale_table<decwide_t, FloatingPointType> table { };
+
+      auto make_squares =
+        [](decwide_t* p_powers, const std::size_t level_count, const unsigned base, const int bits_per_exponent_times_1000)
+        {
+          p_powers[static_cast<std::size_t>(UINT8_C(0))] = decwide_t(base); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          for(auto level = static_cast<std::size_t>(UINT8_C(1)); level < level_count; ++level)
+          {
+            const auto exponent = static_cast<int>(1 << static_cast<unsigned>(level));
+
+            decwide_t& power = p_powers[level]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            power = p_powers[level - 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            power.set_prec_elem_exactly(binary_limbs_prec_elem(static_cast<std::size_t>(UINT8_C(1)), static_cast<int>(((exponent * bits_per_exponent_times_1000) / 1000) + 1)));
+            power *= p_powers[level - 1U]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            power.set_prec_elem_exactly(decwide_t_elem_number);
+          }
+        };
+
+      // Use log2(5) = 2.322 (rounded up) for the number of bits per power of five.
+      make_squares(table.pow2.data(), table.pow2.size(), 2U, 1000);
+      make_squares(table.pow5.data(), table.pow5.size(), 5U, 2322);
+
+      return table;
+    }
+
+    template<typename FloatingPointType>
+    static auto my_value_binary_float_scale_table() -> const detail::binary_float_scale_table<decwide_t, FloatingPointType>&
+    {
+      static const detail::binary_float_scale_table<decwide_t, FloatingPointType> table(make_binary_float_scale_table<FloatingPointType>());
+
+      return table;
+    }
+    #endif
+
+    template<typename FloatingPointType>
+    auto from_binary_float_parts(const std::uintmax_t mantissa, const int exponent2) -> void
+    {
+      detail::make_representation_unique(my_data);
+
+      // Set *this to the exact value of mantissa * 2^exponent2.
+      // The products are evaluated to the precision that their
+      // exact result needs (or to the precision of decwide_t,
+      // whichever is less), using the tabulated binary powers.
+      // Without cached constants, the powers are instead applied
+      // in limb-sized factors, which needs no table at all.
+      // For negative exponents, mantissa * 2^-k = mantissa * 5^k * 10^-k.
+
+      from_unsigned_long_long(static_cast<unsigned long long>(mantissa)); // NOLINT(google-runtime-int)
+
+      my_neg       = false;
+      my_fpclass   = fpclass_type::decwide_t_finite;
+      my_prec_elem = decwide_t_elem_number;
+
+      if((mantissa == static_cast<std::uintmax_t>(UINT8_C(0))) || (exponent2 == static_cast<int>(INT8_C(0))))
+      {
+        return;
+      }
+
+      const auto exponent2_is_neg = (exponent2 < static_cast<int>(INT8_C(0)));
+
+      const auto k = static_cast<unsigned>((!exponent2_is_neg) ? exponent2 : -exponent2);
+
+      // Get the precision needed for the product with base^j,
+      // using log2(5) = 2.322 (rounded up).
+      const auto prec_elem_of_power =
+        [exponent2_is_neg](const unsigned j) // NOLINT(modernize-use-trailing-return-type)
+        {
+          const auto bits_of_result =
+            static_cast<int>
+            (
+                std::numeric_limits<std::uintmax_t>::digits
+              + static_cast<int>((!exponent2_is_neg) ? j : static_cast<unsigned>(((j * 2322U) / 1000U) + 1U))
+            );
+
+          return binary_limbs_prec_elem(static_cast<std::size_t>(UINT8_C(1)), bits_of_result);
+        };
+
+      const auto prec_elem = prec_elem_of_power(k);
+
+      set_prec_elem_exactly(prec_elem);
+
+      #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+      const auto& table = my_value_binary_float_scale_table<FloatingPointType>();
+
+      const decwide_t* p_powers = ((!exponent2_is_neg) ? table.pow2.data() : table.pow5.data());
+
+      for(auto level = static_cast<std::size_t>(UINT8_C(0)); (k >> level) != 0U; ++level)
+      {
+        if(((k >> level) & 1U) != 0U)
+        {
+          // Multiplication of one by the power takes over the (full)
+          // precision of the power, so the precision is set again.
+          operator*=(p_powers[level]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          set_prec_elem_exactly(prec_elem);
+        }
+      }
+      #else
+      // Multiply with the largest powers of the base which stay below
+      // the limb base, each in a single pass over the limbs. The limbs
+      // beyond the precision are zero, so the precision simply grows
+      // along with the product. This takes about k / chunk passes.
+      constexpr auto chunk2 = detail::small_power_count_below(static_cast<std::uint64_t>(UINT8_C(2)), static_cast<std::uint64_t>(decwide_t_elem_mask));
+      constexpr auto chunk5 = detail::small_power_count_below(static_cast<std::uint64_t>(UINT8_C(5)), static_cast<std::uint64_t>(decwide_t_elem_mask));
+
+      const auto base  = static_cast<std::uint64_t>((!exponent2_is_neg) ? UINT8_C(2) : UINT8_C(5));
+      const auto chunk = ((!exponent2_is_neg) ? chunk2 : chunk5);
+
+      for(auto j = static_cast<unsigned>(UINT8_C(0)); j < k; ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto n = (std::min)(chunk, static_cast<unsigned>(k - j));
+
+        j += n;
+
+        my_prec_elem = prec_elem_of_power(j);
+
+        static_cast<void>(mul_unsigned_long_long(static_cast<unsigned long long>(detail::small_power(base, n)))); // NOLINT(google-runtime-int)
+      }
+
+      my_prec_elem = prec_elem;
+      #endif
+
+      if(exponent2_is_neg)
+      {
+        // Divide by 10^k, which amounts to a shift of the exponent
+        // by whole limbs after a multiplication with 10^(-k mod elem_digits10).
+        const auto k_div = static_cast<exponent_type>(static_cast<exponent_type>(k) / static_cast<exponent_type>(decwide_t_elem_digits10));
+        const auto k_mod = static_cast<std::int32_t>(static_cast<std::int32_t>(k) % decwide_t_elem_digits10);
+
+        auto limb_shift = k_div;
+
+        if(k_mod != static_cast<std::int32_t>(INT8_C(0)))
+        {
+          static_cast<void>(mul_unsigned_long_long(detail::pow10_maker_as_runtime_value(static_cast<std::uint32_t>(decwide_t_elem_digits10 - k_mod))));
+
+          ++limb_shift;
+        }
+
+        my_exp = static_cast<exponent_type>(my_exp - static_cast<exponent_type>(limb_shift * static_cast<exponent_type>(decwide_t_elem_digits10)));
+      }
+
+      set_prec_elem_exactly(decwide_t_elem_number);
+    }
+
+    template<typename FloatingPointType>
+    static auto binary_float_midpoint_up(const FloatingPointType f) -> decwide_t
+    {
+      // Get the exact midpoint between the positive, normalized
+      // floating-point value f and its next larger neighbor.
+      const detail::template native_float_parts<FloatingPointType> f_parts(f);
+
+      const auto exponent2 =
+        static_cast<int>
+        (
+            f_parts.get_exponent()
+          - static_cast<int>(std::numeric_limits<FloatingPointType>::digits - static_cast<int>(INT8_C(1)))
         );
 
-      if     (p2 <  static_cast<int>(INT8_C(-2))) { *this *= pow(half<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(), -p2); }
-      else if(p2 == static_cast<int>(INT8_C(-2))) { *this /= static_cast<limb_type>(UINT8_C(4)); }
-      else if(p2 == static_cast<int>(INT8_C(-1))) { *this /= static_cast<limb_type>(UINT8_C(2)); }
-      else if(p2 == static_cast<int>(INT8_C( 0))) { ; }
-      else if(p2 == static_cast<int>(INT8_C( 1))) { *this *= static_cast<limb_type>(UINT8_C(2)); }
-      else if(p2 == static_cast<int>(INT8_C( 2))) { *this *= static_cast<limb_type>(UINT8_C(4)); }
-      else                                        { *this *= pow(two<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(), p2); }
+      decwide_t mid { };
+      decwide_t half_ulp { };
 
-      my_neg = b_neg;
+      mid.template from_binary_float_parts<FloatingPointType>(f_parts.get_mantissa(), exponent2);
+      half_ulp.template from_binary_float_parts<FloatingPointType>(static_cast<std::uintmax_t>(UINT8_C(1)), static_cast<int>(exponent2 - 1));
+
+      return mid += half_ulp;
+    }
+
+    // Karatsuba multiplication of the first prec_elems_for_multiply
+    // limbs of *this by those of v. This is also the exact fallback
+    // of the FFT multiplication, so the static scratch pool for it
+    // holds the full limb count when FFT multiplication is compiled in.
+    auto eval_mul_karatsuba(const decwide_t& v, const std::int32_t prec_elems_for_multiply) -> void
+    {
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_kara, prec_elems_for_multiply);
+
+      // Use Sloane's A029750: The so-called 7-smooth numbers having the form 2^k times 1, 3, 5 or 7.
+      const auto kara_elems_for_multiply =
+        detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      using kara_mul_pool_allocator_type = detail::scratch_allocator<AllocatorType, limb_type>;
+      using kara_mul_pool_type           = util::dynamic_array<limb_type, typename kara_mul_pool_allocator_type::type>;
+
+      auto my_kara_mul_pool =
+        kara_mul_pool_type
+        (
+          static_cast<typename kara_mul_pool_type::size_type>
+          (
+              static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
+            * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
+          ),
+          static_cast<limb_type>(UINT8_C(0)),
+          kara_mul_pool_allocator_type::get(my_data)
+        );
+
+      WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
+      #endif
+
+      limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
+      std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
+
+      std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      detail::eval_multiply_kara_n_by_n_to_2n(result,
+                                              u_local,
+                                              v_local,
+                                              kara_elems_for_multiply,
+                                              t);
+
+      // Handle a potential carry.
+      if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+
+        // Shift the result of the multiplication one element to the right.
+        std::copy(result,
+                  result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
+      }
+      else
+      {
+        const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
+
+        std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  my_data.begin());
+      }
     }
 
     template<const ::std::int32_t OtherDigits10>
@@ -2789,8 +3692,11 @@
       static_cast<void>(p_nullparam);
 
       // Use school multiplication.
+      WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_school, prec_elems_for_multiply);
+
       #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-      using school_mul_pool_type = util::dynamic_array<limb_type>;
+      using school_mul_pool_allocator_type = detail::scratch_allocator<AllocatorType, limb_type>;
+      using school_mul_pool_type           = util::dynamic_array<limb_type, typename school_mul_pool_allocator_type::type>;
 
       auto my_school_mul_pool =
         school_mul_pool_type
@@ -2799,8 +3705,12 @@
           (
               static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
             * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-          )
+          ),
+          static_cast<limb_type>(UINT8_C(0)),
+          school_mul_pool_allocator_type::get(my_data)
         );
+
+      WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
       #endif
 
       limb_type* result = my_school_mul_pool.data();
@@ -2846,11 +3756,18 @@
     {
       static_cast<void>(p_nullparam);
 
-      if(prec_elems_for_multiply < decwide_t_elems_for_kara)
+      // FFT is not compiled in for this digit count, so Karatsuba
+      // is used above the runtime threshold.
+      const auto kara_threshold = elems_for_kara();
+
+      if(prec_elems_for_multiply < kara_threshold)
       {
         // Use school multiplication.
+        WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_school, prec_elems_for_multiply);
+
         #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using school_mul_pool_type = util::dynamic_array<limb_type>;
+        using school_mul_pool_allocator_type = detail::scratch_allocator<AllocatorType, limb_type>;
+        using school_mul_pool_type           = util::dynamic_array<limb_type, typename school_mul_pool_allocator_type::type>;
 
         auto my_school_mul_pool =
           school_mul_pool_type
@@ -2859,8 +3776,12 @@
             (
                 static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
               * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-            )
+            ),
+            static_cast<limb_type>(UINT8_C(0)),
+            school_mul_pool_allocator_type::get(my_data)
           );
+
+        WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
         #endif
 
         limb_type* result = my_school_mul_pool.data();
@@ -2884,7 +3805,7 @@
         }
         else
         {
-          const auto kara_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_kara);
+          const auto kara_limit = (std::min)(decwide_t_elem_number, kara_threshold);
 
           const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, kara_limit));
 
@@ -2893,101 +3814,53 @@
                     my_data.begin());
         }
       }
-      else if(   (prec_elems_for_multiply >= decwide_t_elems_for_kara)
-              && (prec_elems_for_multiply <  decwide_t_elems_for_fft))
+      else
       {
-        // Karatsuba multiplication.
+        eval_mul_karatsuba(v, prec_elems_for_multiply);
+      }
+    }
+
+    template<const ::std::int32_t OtherDigits10>
+    auto eval_mul_dispatch_multiplication_method
+    (
+      const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
+      const ::std::int32_t prec_elems_for_multiply,
+      const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
+                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_fft))>::type* p_nullparam = nullptr
+    ) -> void
+    {
+      static_cast<void>(p_nullparam);
 
-        // Sloanes's A029750: Numbers of the form 2^k times 1, 3, 5 or 7.
-        const auto kara_elems_for_multiply =
-          detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
+      const auto kara_threshold = elems_for_kara();
+      const auto fft_threshold  = elems_for_fft();
+
+      if(prec_elems_for_multiply < kara_threshold)
+      {
+        // Use school multiplication.
+        WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_school, prec_elems_for_multiply);
 
         #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using kara_mul_pool_type = util::dynamic_array<limb_type>;
+        using school_mul_pool_allocator_type = detail::scratch_allocator<AllocatorType, limb_type>;
+        using school_mul_pool_type           = util::dynamic_array<limb_type, typename school_mul_pool_allocator_type::type>;
 
-        auto my_kara_mul_pool =
-          kara_mul_pool_type
+        auto my_school_mul_pool =
+          school_mul_pool_type
           (
-            static_cast<typename kara_mul_pool_type::size_type>
+            static_cast<typename school_mul_pool_type::size_type>
             (
-                static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
-            )
+                static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
+              * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
+            ),
+            static_cast<limb_type>(UINT8_C(0)),
+            school_mul_pool_allocator_type::get(my_data)
           );
-        #endif
 
-        limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-        std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
-        std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
+        WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
+        #endif
 
-        std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        limb_type* result = my_school_mul_pool.data();
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
-                                                u_local,
-                                                v_local,
-                                                kara_elems_for_multiply,
-                                                t);
-
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        {
-          my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
-
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-        else
-        {
-          const auto fft_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_fft);
-
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, fft_limit));
-
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-      }
-    }
-
-    template<const ::std::int32_t OtherDigits10>
-    auto eval_mul_dispatch_multiplication_method
-    (
-      const decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v,
-      const ::std::int32_t prec_elems_for_multiply,
-      const typename std::enable_if<(   (OtherDigits10 == ParamDigitsBaseTen)
-                                     && (decwide_t<OtherDigits10, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number >= decwide_t_elems_for_fft))>::type* p_nullparam = nullptr
-    ) -> void
-    {
-      static_cast<void>(p_nullparam);
-
-      if(prec_elems_for_multiply < decwide_t_elems_for_kara)
-      {
-        // Use school multiplication.
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using school_mul_pool_type = util::dynamic_array<limb_type>;
-
-        auto my_school_mul_pool =
-          school_mul_pool_type
-          (
-            static_cast<typename school_mul_pool_type::size_type>
-            (
-                static_cast<typename school_mul_pool_type::size_type>(prec_elems_for_multiply)
-              * static_cast<typename school_mul_pool_type::size_type>(UINT8_C(2))
-            )
-          );
-
-        #endif
-
-        limb_type* result = my_school_mul_pool.data();
-
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
         detail::eval_multiply_n_by_n_to_2n(result,
                                            const_cast<const_limb_pointer_type>(my_data.data()),   // NOLINT(cppcoreguidelines-pro-type-const-cast)
@@ -3006,7 +3879,7 @@
         }
         else
         {
-          const auto kara_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_kara);
+          const auto kara_limit = (std::min)(decwide_t_elem_number, kara_threshold);
 
           const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, kara_limit));
 
@@ -3015,130 +3888,122 @@
                     my_data.begin());
         }
       }
-      else if(   (prec_elems_for_multiply >= decwide_t_elems_for_kara)
-              && (prec_elems_for_multiply <  decwide_t_elems_for_fft))
+      else if(prec_elems_for_multiply < fft_threshold)
       {
         // Use Karatsuba multiplication.
+        eval_mul_karatsuba(v, prec_elems_for_multiply);
+      }
+      else
+      {
+        // Use FFT-based multiplication.
+        WIDE_DECIMAL_INSTRUMENT_SCOPE(mul_fft, prec_elems_for_multiply);
 
-        // Use Sloane's A029750: The so-called 7-smooth numbers having the form 2^k times 1, 3, 5 or 7.
-        const auto kara_elems_for_multiply =
-          detail::a029750::a029750_as_runtime_value(static_cast<std::uint32_t>(prec_elems_for_multiply));
-
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using kara_mul_pool_type = util::dynamic_array<limb_type>;
+        // Split the limbs into as few FFT points as the round-off
+        // error bound allows (full limbs, half-limbs or quarter-limbs).
+        const auto points_per_limb = fft_points_per_limb(prec_elems_for_multiply);
 
-        auto my_kara_mul_pool =
-          kara_mul_pool_type
+        // Determine the required FFT size n_fft, where n_fft must be
+        // a power of two. It is doubled in order to contain the
+        // multiplication result. This is because we are performing
+        // (n * n -> 2n) multiplication.
+        const auto n_fft =
+          static_cast<std::uint32_t>
           (
-            static_cast<typename kara_mul_pool_type::size_type>
-            (
-                static_cast<typename kara_mul_pool_type::size_type>(kara_elems_for_multiply)
-              * static_cast<typename kara_mul_pool_type::size_type>(UINT8_C(8))
-            )
+              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * points_per_limb))
+            * static_cast<std::uint32_t>(UINT8_C(2))
           );
-        #endif
 
-        limb_type* u_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* v_local = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(1))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* result  = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        limb_type* t       = my_kara_mul_pool.data() + static_cast<std::size_t>(static_cast<std::size_t>(kara_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(4))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+        using fft_mul_storage_allocator_type = detail::scratch_allocator<AllocatorType, fft_float_type>;
+        using fft_mul_storage_type           = util::dynamic_array<fft_float_type, typename fft_mul_storage_allocator_type::type>;
 
-        std::copy(my_data.cbegin(), my_data.cbegin() + prec_elems_for_multiply, u_local);
-        std::copy(v.my_data.cbegin(), v.my_data.cbegin() + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), v_local);
+        auto my_af_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft), static_cast<fft_float_type>(0.0F), fft_mul_storage_allocator_type::get(my_data));
+        auto my_bf_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft), static_cast<fft_float_type>(0.0F), fft_mul_storage_allocator_type::get(my_data));
 
-        std::fill(u_local + prec_elems_for_multiply, u_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        std::fill(v_local + prec_elems_for_multiply, v_local + kara_elems_for_multiply, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
+        WIDE_DECIMAL_INSTRUMENT_COUNT(scratch_allocation, prec_elems_for_multiply);
+        #endif
 
-        detail::eval_multiply_kara_n_by_n_to_2n(result,
-                                                u_local,
-                                                v_local,
-                                                kara_elems_for_multiply,
-                                                t);
+        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
 
-        // Handle a potential carry.
-        if(result[static_cast<std::size_t>(UINT8_C(0))] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        {
-          my_exp = static_cast<exponent_type>(my_exp + static_cast<exponent_type>(decwide_t_elem_digits10));
+        // The round-off error is only measured if its bound does not
+        // already ensure that the coefficients are rounded correctly.
+        #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+        const auto check_roundoff =
+          (!(  detail::fft_roundoff_bound_of_limbs<limb_type, fft_float_type>(prec_elems_for_multiply, points_per_limb)
+             <= static_cast<double>(fft_roundoff_limit())));
+        #else
+        constexpr auto check_roundoff = false;
+        #endif
 
-          // Shift the result of the multiplication one element to the right.
-          std::copy(result,
-                    result + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
-        }
-        else
+        const auto roundoff =
+          detail::mul_loop_fft(my_data.data(),
+                               const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                               my_af_fft_mul_pool.data(),
+                               my_bf_fft_mul_pool.data(),
+                               static_cast<std::int32_t>(prec_elems_for_multiply),
+                               n_fft,
+                               points_per_limb,
+                               fft_roundoff_limit(),
+                               check_roundoff);
+
+        #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+        auto& statistics = my_fft_roundoff_statistics();
+
+        if(check_roundoff)
         {
-          const auto fft_limit = (std::min)(decwide_t_elem_number, decwide_t_elems_for_fft);
-
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, fft_limit));
+          // The worst round-off is only recorded for measured products.
+          auto worst = statistics.worst_roundoff.load(std::memory_order_relaxed);
 
-          std::copy(result +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    result + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
+          while((worst < roundoff) && (!statistics.worst_roundoff.compare_exchange_weak(worst, roundoff, std::memory_order_relaxed))) { ; } // NOLINT(altera-id-dependent-backward-branch)
         }
-      }
-      else if(prec_elems_for_multiply >= decwide_t_elems_for_fft)
-      {
-        // Use FFT-based multiplication.
-
-        // Determine the required FFT size n_fft,
-        // where n_fft must be a power of two.
-
-        // We use half-limbs in the FFT in order to reduce
-        // the size of the data points in the FFTs.
-        // This helps preserve precision for large
-        // array lengths.
-
-        // The size is doubled in order to contain the multiplication
-        // result. This is because we are performing (n * n -> 2n)
-        // multiplication. Furthermore, the FFT size is doubled again
-        // since half-limbs are used.
-
-        // Obtain the needed FFT size doubled (and doubled again),
-        // with the added condition of needing to be a power of 2.
-        const auto n_fft =
-          static_cast<std::uint32_t>
-          (
-              detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems_for_multiply))
-            * static_cast<std::uint32_t>(UINT8_C(4))
-          );
 
-        #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
-        using fft_mul_storage_type = util::dynamic_array<fft_float_type>;
+        const auto use_fallback = (!(roundoff <= fft_roundoff_limit()));
+        #else
+        static_cast<void>(roundoff);
 
-        auto my_af_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
-        auto my_bf_fft_mul_pool = fft_mul_storage_type(static_cast<typename fft_mul_storage_type::size_type>(n_fft));
+        constexpr auto use_fallback = false;
         #endif
 
-        using const_limb_pointer_type = typename std::add_const<limb_type*>::type;
+        if(use_fallback)
+        {
+          // The coefficients could not be rounded reliably, and my_data
+          // is still the unmodified multiplicand. Use the exact Karatsuba
+          // multiplication for this product instead.
+          #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+          statistics.fallback_count.fetch_add(static_cast<std::uint32_t>(UINT8_C(1)), std::memory_order_relaxed);
+          #endif
 
-        detail::mul_loop_fft(my_data.data(),
-                             const_cast<const_limb_pointer_type>(  my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             const_cast<const_limb_pointer_type>(v.my_data.data()), // NOLINT(cppcoreguidelines-pro-type-const-cast)
-                             my_af_fft_mul_pool.data(),
-                             my_bf_fft_mul_pool.data(),
-                             static_cast<std::int32_t>(prec_elems_for_multiply),
-                             n_fft);
+          WIDE_DECIMAL_INSTRUMENT_COUNT(fft_fallback, prec_elems_for_multiply);
 
-        if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
-        {
-          // Adjust the exponent because of the internal scaling of the FFT multiplication.
-          my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+          eval_mul_karatsuba(v, prec_elems_for_multiply);
         }
         else
         {
-          const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
+          if(my_data.front() != static_cast<limb_type>(UINT8_C(0)))
+          {
+            // Adjust the exponent because of the internal scaling of the FFT multiplication.
+            my_exp += static_cast<exponent_type>(decwide_t_elem_digits10);
+          }
+          else
+          {
+            const auto copy_limit = static_cast<std::ptrdiff_t>((std::min)(prec_elems_for_multiply, decwide_t_elem_number));
 
-          std::copy(my_data.cbegin() +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.cbegin() + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-                    my_data.begin());
+            std::copy(my_data.cbegin() +                             static_cast<std::ptrdiff_t>(INT8_C(1)),               // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                      my_data.cbegin() + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + copy_limit), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                      my_data.begin());
 
-          my_data.back() = static_cast<limb_type>(UINT8_C(0));
+            my_data.back() = static_cast<limb_type>(UINT8_C(0));
+          }
         }
       }
     }
 
     auto eval_round_self() -> void // NOLINT(readability-function-cognitive-complexity)
     {
+      detail::make_representation_unique(my_data);
+
       const auto needs_rounding = ((isfinite)() && (!iszero()));
 
       if(needs_rounding)
@@ -3356,6 +4221,8 @@
 
     auto rd_string(const char* s) -> bool // NOLINT(readability-function-cognitive-complexity)
     {
+      detail::make_representation_unique(my_data);
+
       std::string str(s);
 
       // Get a possible exponent and remove it.
@@ -3729,482 +4596,1810 @@
     }
     #endif //!(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
 
-    static auto get_output_digits(const decwide_t&         x,
-                                        char*              it_dst,
-                                  const std::uint_fast32_t number_of_elements,
-                                        std::size_t*       count_retrieved,
-                                  const bool               include_decimal_point = false) -> void
+    static auto get_output_format(const exponent_type               the_exp,
+                                  const detail::os_float_field_type my_float_field,
+                                  const std::int64_t                ostrm_precision,
+                                        std::uint_fast32_t&         os_precision, // NOLINT(google-runtime-references)
+                                        bool&                       use_scientific) -> std::uint_fast32_t // NOLINT(google-runtime-references)
     {
-      // Extract the required digits from decwide_t, including
-      // digits both before as well as after the decimal point.
+      // Get the output stream's precision and limit it to max_digits10.
+      // Erroneous negative precision (theoretically impossible) will be
+      // set to ostream's default precision. Zero precision will be left
+      // at zero.
+      const auto prec_default = static_cast<std::int64_t>(INT8_C(6));
 
-      // Include the decimal point in the retrieved characters
-      // if requested. Do not, however, count an inserted
-      // decimal point as one of the retrieved characters.
+      os_precision =
+        static_cast<std::uint_fast32_t>
+        (
+          ((ostrm_precision <= static_cast<std::int64_t>(INT8_C(0)))
+            ? ((my_float_field != detail::os_float_field_type::scientific) ? static_cast<std::uint_fast32_t>(prec_default) : static_cast<std::uint_fast32_t>(UINT8_C(0)))
+            : static_cast<std::uint_fast32_t>(ostrm_precision))
+        );
 
-      using data_elem_array_type =
-        std::array<char, static_cast<std::size_t>(decwide_t_elem_digits10)>;
+      use_scientific = false;
 
-      data_elem_array_type data_elem_buf { };
+      auto use_fixed = false;
 
-      // Obtain the digits in the first limb.
-      auto it_rep = x.crepresentation().cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      if     (my_float_field == detail::os_float_field_type::scientific) { use_scientific = true; }
+      else if(my_float_field == detail::os_float_field_type::fixed)      { use_fixed      = true; }
+      else // os_float_field_none
+      {
+        // Set up the range for dynamic detection of scientific notation.
+        // If the exponent is less than -4 or larger than a precision-dependent
+        // positive bound, then scientific notation is used.
+        static const auto neg_bound_for_scientific_neg_exp = static_cast<exponent_type>(INT8_C(-4));
+               const auto min_bound_for_scientific_pos_exp = (std::max)(static_cast<exponent_type>(os_precision), static_cast<exponent_type>(prec_default));
+               const auto pos_bound_for_scientific_pos_exp = (std::min)(static_cast<exponent_type>(decwide_t_digits10), min_bound_for_scientific_pos_exp);
 
-      const char* p_end = util::baselexical_cast(*it_rep, data_elem_buf.data(), data_elem_buf.data() + data_elem_buf.size()); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+        if(   (the_exp <  neg_bound_for_scientific_neg_exp)
+           || (the_exp >= pos_bound_for_scientific_pos_exp)
+          )
+        {
+          use_scientific = true;
+        }
+        else
+        {
+          use_fixed = true;
+        }
+      }
 
-      ++it_rep;
+      // Ascertain the number of digits requested from decwide_t.
+      auto number_of_digits10_i_want = static_cast<std::uint_fast32_t>(UINT8_C(0));
 
-      *count_retrieved =
-        static_cast<std::size_t>
+      const auto max10_plus_one =
+        static_cast<std::uint_fast32_t>
         (
-          std::distance(static_cast<const char*>(data_elem_buf.data()), p_end)
+            static_cast<std::uint_fast32_t>(decwide_t_max_digits10)
+          + static_cast<std::uint_fast32_t>(UINT8_C(1))
         );
 
-      it_dst = std::copy(data_elem_buf.cbegin(),
-                         data_elem_buf.cbegin() + *count_retrieved,
-                         it_dst);
-
-      // Include the decimal point if requested.
-      if(include_decimal_point)
+      if(use_scientific)
       {
-        *it_dst++ = '.'; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        // The float-field is scientific. The number of digits is given by
+        // (1 + the ostream's precision), not to exceed (max_digits10 + 1).
+        const auto prec_plus_one  =
+          static_cast<std::uint_fast32_t>
+          (
+            static_cast<std::uint_fast32_t>(UINT8_C(1)) + os_precision
+          );
+
+        number_of_digits10_i_want = (std::min)(max10_plus_one, prec_plus_one);
       }
 
-      data_elem_array_type data_elem_array { };
+      if(use_fixed)
+      {
+        // The float-field is scientific. The number of all-digits depends
+        // on the form of the number.
 
-      // Extract the digits following the decimal point from decwide_t,
-      // beginning with the data element having index 1.
-      while(it_rep != (x.crepresentation().cbegin() + static_cast<std::size_t>(number_of_elements))) // NOLINT(altera-id-dependent-backward-branch)
+        const auto exp_plus_one                   = static_cast<exponent_type>(the_exp      + static_cast<exponent_type>(INT8_C(1)));
+        const auto exp_plus_one_plus_my_precision = static_cast<exponent_type>(exp_plus_one + static_cast<exponent_type>(os_precision));
+
+        if(the_exp >= static_cast<exponent_type>(INT8_C(0)))
+        {
+          // If the number is larger than 1 in absolute value, then the number of
+          // digits is given by the width of the integer part plus the ostream's
+          // precision, not to exceed (max_digits10 + 1).
+          number_of_digits10_i_want =
+            static_cast<std::uint_fast32_t>
+            (
+              (std::min)(exp_plus_one_plus_my_precision, static_cast<exponent_type>(max10_plus_one))
+            );
+        }
+        else
+        {
+          number_of_digits10_i_want = (std::min)(os_precision, max10_plus_one);
+        }
+      }
+
+      // If the float field is not set, reduce the number of digits requested
+      // from decwide_t such that it neither exceeds the ostream's precision
+      // nor decwide_t's max_digits10.
+      if(my_float_field == detail::os_float_field_type::none)
       {
-        p_end = util::baselexical_cast(*it_rep, data_elem_buf.data(), data_elem_buf.data() + data_elem_buf.size());
+        const auto max_dig10 = (std::min)(os_precision, static_cast<std::uint_fast32_t>(decwide_t_max_digits10));
 
-        ++it_rep;
+        number_of_digits10_i_want = (std::min)(number_of_digits10_i_want, max_dig10);
+      }
 
-        auto rit = std::copy(static_cast<std::reverse_iterator<const char*>>(p_end),
-                             static_cast<std::reverse_iterator<const char*>>(static_cast<const char*>(data_elem_buf.data())),
-                             data_elem_array.rbegin());
+      return number_of_digits10_i_want;
+    }
 
-        std::fill(rit, data_elem_array.rend(), '0');
+    static auto output_digit_at(const decwide_t&         x,
+                                const std::uint_fast32_t digits_in_limb_zero,
+                                const std::uint_fast32_t pos) -> char
+    {
+      // Get the base-10 digit of the mantissa of x at the zero-based
+      // position pos, counted from the most significant digit.
 
-        it_dst = std::copy(data_elem_array.cbegin(),
-                           data_elem_array.cend(),
-                           it_dst);
+      using local_size_type = typename representation_type::size_type;
 
-        *count_retrieved =
-          static_cast<std::size_t>
-          (
-              *count_retrieved
-            + static_cast<std::size_t>(decwide_t_elem_digits10)
-          );
+      using digit_helper_struct_type = detail::decwide_t_helper<decwide_t_elem_digits10, limb_type>;
+
+      const auto ed = static_cast<std::uint_fast32_t>(decwide_t_elem_digits10);
+
+      const auto limb_digit =
+        (pos < digits_in_limb_zero)
+          ? digit_helper_struct_type::digit_at_pos_in_limb(x.my_data[static_cast<local_size_type>(UINT8_C(0))],
+                                                           static_cast<unsigned>(digits_in_limb_zero - static_cast<std::uint_fast32_t>(pos + static_cast<std::uint_fast32_t>(UINT8_C(1)))))
+          : digit_helper_struct_type::digit_at_pos_in_limb(x.my_data[static_cast<local_size_type>(static_cast<std::uint_fast32_t>(UINT8_C(1)) + static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(pos - digits_in_limb_zero) / ed))],
+                                                           static_cast<unsigned>(static_cast<std::uint_fast32_t>(ed - static_cast<std::uint_fast32_t>(UINT8_C(1))) - static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(pos - digits_in_limb_zero) % ed)));
+
+      return static_cast<char>(static_cast<char>(limb_digit) + '0');
+    }
+
+    using output_limb_chars_type =
+      std::array<char, static_cast<std::size_t>(static_cast<std::size_t>(static_cast<std::size_t>(decwide_t_elem_digits10 + 7) / 8U) * 8U)>;
+
+    static auto limb_to_chars(const limb_type limb, output_limb_chars_type& chars) -> void // NOLINT(google-runtime-references)
+    {
+      // Write the zero-padded decimal digits of the limb,
+      // eight characters at a time, right-aligned in chars.
+      auto value = static_cast<std::uint64_t>(limb);
+
+      for(auto i = chars.size(); i != static_cast<std::size_t>(UINT8_C(0)); i -= static_cast<std::size_t>(UINT8_C(8)))
+      {
+        detail::swar_store_eight_chars(detail::swar_value_to_eight_digits(static_cast<std::uint32_t>(value % UINT64_C(100000000))),
+                                       chars.data() + static_cast<std::size_t>(i - static_cast<std::size_t>(UINT8_C(8)))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        value = static_cast<std::uint64_t>(value / UINT64_C(100000000));
       }
     }
 
-    #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
-    static auto get_output_string(const decwide_t&         x,
-                                        std::string&       str, // NOLINT(google-runtime-references)
-                                        exponent_type&     the_exp,
-                                  const std::uint_fast32_t number_of_digits) -> void
+    static constexpr auto os_float_field(const chars_format fmt) -> detail::os_float_field_type
     {
-      // Determine the number of elements needed to provide the requested digits from decwide_t.
-      const std::uint_fast32_t number_of_elements =
-        (std::min)(static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(number_of_digits / static_cast<std::uint_fast32_t>(decwide_t_elem_digits10)) + static_cast<std::uint_fast32_t>(UINT8_C(2))),
-                   static_cast<std::uint_fast32_t>(decwide_t_elem_number));
+      return
+        (fmt == chars_format::scientific) ? detail::os_float_field_type::scientific
+                                          : ((fmt == chars_format::fixed) ? detail::os_float_field_type::fixed
+                                                                          : detail::os_float_field_type::none);
+    }
 
-      // Extract the remaining digits from decwide_t after the decimal point.
+    template<typename PutFunctionType>
+    static auto wr_digits(const decwide_t&                  x,
+                          const detail::os_float_field_type my_float_field,
+                          const std::int64_t                precision,
+                          const bool                        my_showpos,
+                          const bool                        my_showpoint,
+                          const bool                        my_uppercase,
+                          const digit_grouping&             grouping,
+                                PutFunctionType&            put) -> bool // NOLINT(readability-function-cognitive-complexity,google-runtime-references)
+    {
+      // Write x character-by-character to put() just like an ostream
+      // having the given precision, float-field and flags would. The
+      // digits are read directly from the limbs and rounded on the fly,
+      // so no intermediate string is needed.
 
-      util::dynamic_array<char>
-        str_tmp_mem
-        (
-          static_cast<std::size_t>
-          (
-              static_cast<std::size_t>(number_of_elements)
-            * static_cast<std::size_t>(decwide_t_elem_digits10)
-          ),
-          ' '
-        );
+      using std::ilogb;
 
-      auto count_retrieved = static_cast<std::size_t>(UINT8_C(0));
+      auto the_exp = static_cast<exponent_type>(ilogb(x));
 
-      get_output_digits(x,
-                        str_tmp_mem.data(),
-                        number_of_elements,
-                        &count_retrieved);
+      std::uint_fast32_t os_precision   { };
+      bool               use_scientific { };
 
-      str.resize(count_retrieved);
+      const auto number_of_digits =
+        get_output_format(the_exp, my_float_field, precision, os_precision, use_scientific);
 
-      std::copy(str_tmp_mem.cbegin(),
-                str_tmp_mem.cbegin() + count_retrieved,
-                str.begin());
+      // Determine the number of available digits. These are
+      // the digits of the limbs that are needed for the output.
+      using local_size_type = typename representation_type::size_type;
 
-      // Cut the output to the size of the precision.
-      if(str.length() > number_of_digits)
-      {
-        // Get the digit immediately following the last digit and use this for rounding.
-        const auto round =
-          static_cast<std::uint32_t>
-          (
-            static_cast<std::uint32_t>(str.at(number_of_digits)) - static_cast<std::uint32_t>('0')
-          );
+      const auto digits_in_limb_zero =
+        static_cast<std::uint_fast32_t>(detail::order_of_builtin_integer(x.my_data[static_cast<local_size_type>(UINT8_C(0))]));
+
+      const auto number_of_elements =
+        (std::min)(static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(number_of_digits / static_cast<std::uint_fast32_t>(decwide_t_elem_digits10)) + static_cast<std::uint_fast32_t>(UINT8_C(2))),
+                   static_cast<std::uint_fast32_t>(decwide_t_elem_number));
+
+      const auto number_of_available_digits =
+        static_cast<std::uint_fast32_t>
+        (
+            digits_in_limb_zero
+          + static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(number_of_elements - static_cast<std::uint_fast32_t>(UINT8_C(1))) * static_cast<std::uint_fast32_t>(decwide_t_elem_digits10))
+        );
+
+      const auto len = (std::min)(number_of_digits, number_of_available_digits);
 
-        // Truncate the string
-        str = str.substr(static_cast<std::uint_fast32_t>(UINT8_C(0)), number_of_digits);
+      // Round half-up at the digit following the last requested one.
+      // A round-up increments the digit at index round_ix and clears
+      // all digits after it. Rounding nothing but nines yields 1 followed
+      // by zeros and increments the exponent.
+      auto round_ix     = len;
+      auto all_nines    = false;
 
-        if(round >= static_cast<std::uint32_t>(UINT8_C(5)))
+      if(number_of_available_digits > number_of_digits)
+      {
+        if(output_digit_at(x, digits_in_limb_zero, number_of_digits) >= '5')
         {
-          auto ix = static_cast<std::string::size_type>(str.length() - static_cast<std::size_t>(UINT8_C(1)));
+          round_ix = static_cast<std::uint_fast32_t>(number_of_digits - static_cast<std::uint_fast32_t>(UINT8_C(1)));
 
-          // Every trailing 9 must be rounded up.
-          while(   (ix != static_cast<std::size_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
-                && (static_cast<int>(static_cast<int>(str.at(ix)) - static_cast<int>('0')) == static_cast<int>(INT8_C(9))))
+          while(   (round_ix != static_cast<std::uint_fast32_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+                && (output_digit_at(x, digits_in_limb_zero, round_ix) == '9'))
           {
-            str.at(ix) = '0';
-
-            --ix;
+            --round_ix;
           }
 
-          if(ix == static_cast<std::size_t>(UINT8_C(0)))
+          if((round_ix == static_cast<std::uint_fast32_t>(UINT8_C(0))) && (output_digit_at(x, digits_in_limb_zero, round_ix) == '9'))
           {
-            // There were nothing but trailing nines.
-            const auto has_nothing_but_trailing_nines =
-              static_cast<int>(static_cast<int>(str.at(ix)) - static_cast<int>(INT8_C(0x30))) == static_cast<int>(INT8_C(9));
+            all_nines = true;
 
-            if(has_nothing_but_trailing_nines)
-            {
-              // Increment up to the next order and adjust exponent.
-              ++str[ix] = '1';
-
-              ++the_exp;
-            }
-            else
-            {
-              // Round up this digit.
-              ++str[ix];
-            }
-          }
-          else
-          {
-            // Round up the last digit.
-            ++str[ix];
+            ++the_exp;
           }
         }
       }
-    }
 
-    static auto wr_string_scientific(      std::string&       str, // NOLINT(google-runtime-references)
-                                     const exponent_type      the_exp,
-                                     const std::uint_fast32_t os_precision,
-                                     const bool               my_showpoint,
-                                     const bool               my_uppercase,
-                                     const bool               trim_trailing_zeros = false) -> void
-    {
-      if(os_precision > static_cast<std::uint_fast32_t>(str.length() - static_cast<std::size_t>(UINT8_C(1))))
-      {
-        // Zero-extend the string to the given precision if necessary.
-        const auto n_pad =
-          static_cast<std::uint_fast32_t>
-          (
-              os_precision
-            - static_cast<std::uint_fast32_t>(str.length() - static_cast<std::size_t>(UINT8_C(1)))
-          );
+      // The digits are handed out from the characters of one limb at a time,
+      // so that each limb is converted only once in sequential output.
+      output_limb_chars_type limb_chars { };
 
-        str.insert(str.end(), static_cast<std::size_t>(n_pad), '0');
-      }
+      auto limb_chars_index = (std::numeric_limits<std::uint_fast32_t>::max)();
 
-      // Insert the decimal point.
-      str.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+      const auto limb_chars_at =
+        [&x, &digits_in_limb_zero, &limb_chars, &limb_chars_index](const std::uint_fast32_t pos) -> const char* // NOLINT(modernize-use-trailing-return-type)
+        {
+          constexpr auto ed = static_cast<std::uint_fast32_t>(decwide_t_elem_digits10);
 
-      // Trim the trailing zeros, where the trim-characteristics depend on the showpoint flag.
-      if(trim_trailing_zeros)
-      {
-        const std::string::const_reverse_iterator rit_non_zero =
-          std::find_if(str.crbegin(),
-                       str.crend(),
-                       [](const char& c) // NOLINT(modernize-use-trailing-return-type)
-                       {
-                         return (c != '0');
-                       });
+          constexpr auto chars_per_limb = static_cast<std::uint_fast32_t>(std::tuple_size<output_limb_chars_type>::value);
 
-        if(rit_non_zero != str.crbegin())
-        {
-          const auto ofs =
-            static_cast<std::ptrdiff_t>
+          const auto pos_is_in_limb_zero = (pos < digits_in_limb_zero);
+
+          const auto limb_index =
+            static_cast<std::uint_fast32_t>
             (
-                static_cast<std::ptrdiff_t>(str.length())
-              - std::distance(str.crbegin(), rit_non_zero)
+              pos_is_in_limb_zero ? static_cast<std::uint_fast32_t>(UINT8_C(0))
+                                  : static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(UINT8_C(1)) + static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(pos - digits_in_limb_zero) / ed))
+            );
+
+          if(limb_index != limb_chars_index)
+          {
+            limb_to_chars(x.my_data[static_cast<typename representation_type::size_type>(limb_index)], limb_chars);
+
+            limb_chars_index = limb_index;
+          }
+
+          const auto char_index =
+            static_cast<std::uint_fast32_t>
+            (
+              pos_is_in_limb_zero ? static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(chars_per_limb - digits_in_limb_zero) + pos)
+                                  : static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(chars_per_limb - ed) + static_cast<std::uint_fast32_t>(static_cast<std::uint_fast32_t>(pos - digits_in_limb_zero) % ed))
             );
 
-          str.erase(str.begin() + ofs, str.end());
+          return limb_chars.data() + static_cast<std::size_t>(char_index); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        };
+
+      const auto digit =
+        [&limb_chars_at, &len, &round_ix, &all_nines](const std::uint_fast32_t pos) -> char // NOLINT(modernize-use-trailing-return-type)
+        {
+          if(pos >= len) { return '0'; }
+
+          if(all_nines) { return ((pos == static_cast<std::uint_fast32_t>(UINT8_C(0))) ? '1' : '0'); }
+
+          if(pos < round_ix) { return *limb_chars_at(pos); }
+
+          return ((pos == round_ix) ? static_cast<char>(*limb_chars_at(pos) + static_cast<char>(INT8_C(1))) : '0');
+        };
+
+      // Get the number of significant digits without trailing zeros.
+      // These are trimmed in the general format, unless showpoint is
+      // set. In that case, the output is instead zero-extended such that
+      // it has exactly as many significant digits as the precision.
+      const auto trim_trailing_zeros = ((my_float_field == detail::os_float_field_type::none) && (!my_showpoint));
+
+      const auto extend_to_precision = ((my_float_field == detail::os_float_field_type::none) && my_showpoint);
+
+      auto number_of_significant_digits = len;
+
+      if(trim_trailing_zeros)
+      {
+        while(   (number_of_significant_digits != static_cast<std::uint_fast32_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+              && (digit(static_cast<std::uint_fast32_t>(number_of_significant_digits - static_cast<std::uint_fast32_t>(UINT8_C(1)))) == '0'))
+        {
+          --number_of_significant_digits;
         }
       }
 
-      // Perform the final manipulations on the digits of the string.
-      if(my_showpoint)
+      const auto put_digits =
+        [&put, &digit, &limb_chars, &limb_chars_at, &len, &round_ix, &all_nines](std::uint_fast32_t pos, const std::uint_fast32_t pos_end) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          auto result_is_ok = true;
+
+          // Digits that are not affected by rounding are put
+          // in runs directly from the characters of their limb.
+          const auto run_end =
+            static_cast<std::uint_fast32_t>
+            (
+              all_nines ? static_cast<std::uint_fast32_t>(UINT8_C(0)) : (std::min)(pos_end, (std::min)(len, round_ix))
+            );
+
+          while((pos < run_end) && result_is_ok) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            const char* p_run = limb_chars_at(pos);
+
+            const auto run_length =
+              (std::min)(static_cast<std::uint_fast32_t>(std::distance(p_run, static_cast<const char*>(limb_chars.data() + limb_chars.size()))), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                         static_cast<std::uint_fast32_t>(run_end - pos));
+
+            for(auto i = static_cast<std::uint_fast32_t>(UINT8_C(0)); (i < run_length) && result_is_ok; ++i) // NOLINT(altera-id-dependent-backward-branch)
+            {
+              result_is_ok = put(p_run[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+
+            pos = static_cast<std::uint_fast32_t>(pos + run_length);
+          }
+
+          for( ; (pos < pos_end) && result_is_ok; ++pos) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            result_is_ok = put(digit(pos));
+          }
+
+          return result_is_ok;
+        };
+
+      // Fraction digits are optionally separated into groups, with
+      // a line break after each complete line of groups.
+      auto fraction_digit_count = static_cast<std::uint_fast32_t>(UINT8_C(0));
+
+      const auto put_fraction_digit =
+        [&put, &grouping, &fraction_digit_count](const char c) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          auto result_is_ok = true;
+
+          if(   (grouping.digits_per_group != static_cast<std::uint32_t>(UINT8_C(0)))
+             && (fraction_digit_count != static_cast<std::uint_fast32_t>(UINT8_C(0)))
+             && ((fraction_digit_count % grouping.digits_per_group) == static_cast<std::uint_fast32_t>(UINT8_C(0))))
+          {
+            const auto line_is_full =
+              (
+                   (grouping.groups_per_line != static_cast<std::uint32_t>(UINT8_C(0)))
+                && ((static_cast<std::uint_fast32_t>(fraction_digit_count / grouping.digits_per_group) % grouping.groups_per_line) == static_cast<std::uint_fast32_t>(UINT8_C(0)))
+              );
+
+            result_is_ok = put(line_is_full ? '\n' : grouping.separator);
+          }
+
+          ++fraction_digit_count;
+
+          return (result_is_ok && put(c));
+        };
+
+      const auto put_fraction_digits =
+        [&put_fraction_digit, &put_digits, &grouping, &digit](std::uint_fast32_t pos, const std::uint_fast32_t pos_end) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          if(grouping.digits_per_group == static_cast<std::uint32_t>(UINT8_C(0)))
+          {
+            return put_digits(pos, pos_end);
+          }
+
+          auto result_is_ok = true;
+
+          for( ; (pos < pos_end) && result_is_ok; ++pos) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            result_is_ok = put_fraction_digit(digit(pos));
+          }
+
+          return result_is_ok;
+        };
+
+      auto result_is_ok = (x.isneg() ? put('-') : (my_showpos ? put('+') : true));
+
+      if(use_scientific)
+      {
+        const auto number_of_digits_for_fraction =
+          static_cast<std::uint_fast32_t>
+          (
+            extend_to_precision ? os_precision : number_of_significant_digits
+          );
+
+        const auto number_of_fraction_digits =
+          static_cast<std::uint_fast32_t>
+          (
+            ((!trim_trailing_zeros) && (!extend_to_precision))
+              ? os_precision
+              : static_cast<std::uint_fast32_t>((number_of_digits_for_fraction > static_cast<std::uint_fast32_t>(UINT8_C(1))) ? static_cast<std::uint_fast32_t>(number_of_digits_for_fraction - static_cast<std::uint_fast32_t>(UINT8_C(1))) : static_cast<std::uint_fast32_t>(UINT8_C(0)))
+          );
+
+        result_is_ok = (result_is_ok && put(digit(static_cast<std::uint_fast32_t>(UINT8_C(0)))));
+
+        if((number_of_fraction_digits != static_cast<std::uint_fast32_t>(UINT8_C(0))) || my_showpoint)
+        {
+          result_is_ok = (   result_is_ok
+                          && put('.')
+                          && put_fraction_digits(static_cast<std::uint_fast32_t>(UINT8_C(1)), static_cast<std::uint_fast32_t>(number_of_fraction_digits + static_cast<std::uint_fast32_t>(UINT8_C(1)))));
+        }
+
+        // Write the exponent with a width that is an even multiple of three.
+        const auto b_exp_is_neg = (the_exp < static_cast<exponent_type>(INT8_C(0)));
+
+        const auto u_exp =
+          static_cast<std::uint64_t>
+          (
+            (!b_exp_is_neg) ? the_exp : static_cast<exponent_type>(-the_exp)
+          );
+
+        std::array<char, static_cast<std::size_t>(UINT8_C(21))> exp_buf = {{ '\0' }}; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        const char* p_exp_end = util::baselexical_cast(u_exp, exp_buf.data(), exp_buf.data() + exp_buf.size());
+
+        const auto exp_len = static_cast<std::size_t>(std::distance(static_cast<const char*>(exp_buf.data()), p_exp_end));
+
+        const auto exp_len_mod3 = static_cast<std::size_t>(exp_len % static_cast<std::size_t>(UINT8_C(3)));
+
+        auto exp_len_pad =
+          static_cast<std::size_t>
+          (
+            (exp_len_mod3 != static_cast<std::size_t>(UINT8_C(0))) ? static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(3)) - exp_len_mod3)
+                                                                   : static_cast<std::size_t>(UINT8_C(0))
+          );
+
+        result_is_ok = (result_is_ok && put(my_uppercase ? 'E' : 'e') && put((!b_exp_is_neg) ? '+' : '-'));
+
+        for( ; (exp_len_pad != static_cast<std::size_t>(UINT8_C(0))) && result_is_ok; --exp_len_pad)
+        {
+          result_is_ok = put('0');
+        }
+
+        for(auto i = static_cast<std::size_t>(UINT8_C(0)); (i < exp_len) && result_is_ok; ++i)
+        {
+          result_is_ok = put(exp_buf[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+      else if(the_exp < static_cast<exponent_type>(INT8_C(0)))
       {
-        if(trim_trailing_zeros) { special_extend_string_to_precision(str, os_precision); }
+        // The number is less than one in magnitude: Write 0.000ddd.
+        const auto zero_insert_length = static_cast<std::uint_fast32_t>(detail::negate(static_cast<exponent_type>(the_exp + static_cast<exponent_type>(INT8_C(1)))));
+
+        const auto number_of_digits_after_zeros =
+          static_cast<std::uint_fast32_t>
+          (
+            extend_to_precision
+              ? os_precision
+              : ((!trim_trailing_zeros)
+                  ? (std::max)(len, static_cast<std::uint_fast32_t>((os_precision > zero_insert_length) ? static_cast<std::uint_fast32_t>(os_precision - zero_insert_length) : static_cast<std::uint_fast32_t>(UINT8_C(0))))
+                  : number_of_significant_digits)
+          );
+
+        result_is_ok = (result_is_ok && put('0'));
+
+        if((number_of_digits_after_zeros != static_cast<std::uint_fast32_t>(UINT8_C(0))) || my_showpoint)
+        {
+          result_is_ok = (result_is_ok && put('.'));
+
+          for(auto i = static_cast<std::uint_fast32_t>(UINT8_C(0)); (i < zero_insert_length) && result_is_ok; ++i) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            result_is_ok = put_fraction_digit('0');
+          }
+
+          result_is_ok = (result_is_ok && put_fraction_digits(static_cast<std::uint_fast32_t>(UINT8_C(0)), number_of_digits_after_zeros));
+        }
       }
       else
       {
-        // Remove the trailing decimal point if necessary.
-        if(str.back() == '.')
+        // Write the integer part, followed by the fraction digits.
+        const auto number_of_integer_digits = static_cast<std::uint_fast32_t>(the_exp + static_cast<exponent_type>(INT8_C(1)));
+
+        // With showpoint, the digits of zero are all fraction digits.
+        const auto end_of_fraction_digits =
+          static_cast<std::uint_fast32_t>
+          (
+            extend_to_precision
+              ? (x.iszero() ? static_cast<std::uint_fast32_t>(number_of_integer_digits + os_precision)
+                            : (std::max)(number_of_integer_digits, os_precision))
+              : ((!trim_trailing_zeros)
+                  ? static_cast<std::uint_fast32_t>(number_of_integer_digits + os_precision)
+                  : (std::max)(number_of_integer_digits, number_of_significant_digits))
+          );
+
+        result_is_ok = (result_is_ok && put_digits(static_cast<std::uint_fast32_t>(UINT8_C(0)), number_of_integer_digits));
+
+        if((end_of_fraction_digits > number_of_integer_digits) || my_showpoint)
         {
-          str.pop_back();
+          result_is_ok = (result_is_ok && put('.') && put_fraction_digits(number_of_integer_digits, end_of_fraction_digits));
         }
       }
 
-      // Append the exponent in uppercase or lower case, including its sign.
-      const auto b_exp_is_neg = (the_exp < static_cast<exponent_type>(INT8_C(0)));
+      return result_is_ok;
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+    static auto wr_chars(      char*              first,
+                               char*              last,
+                         const decwide_t&         x,
+                         const chars_format       fmt,
+                         const std::int64_t       precision) -> to_chars_result
+    {
+      char* ptr = first;
 
-      const auto u_exp =
-        static_cast<std::uint64_t>
+      auto put =
+        [&ptr, &last](const char c) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          const auto has_room = (ptr != last);
+
+          if(has_room) { *ptr++ = c; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          return has_room;
+        };
+
+      const auto result_is_ok = wr_digits(x, os_float_field(fmt), precision, false, false, false, digit_grouping(), put);
+
+      return
+      {
+        (result_is_ok ? ptr : last),
+        (result_is_ok ? std::errc() : std::errc::value_too_large)
+      };
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
+    static auto rd_chars(const char* first, const char* last, decwide_t& x) -> from_chars_result // NOLINT(readability-function-cognitive-complexity,google-runtime-references)
+    {
+      detail::make_representation_unique(x.my_data);
+
+      // Read a decimal number of the form [+/-]ddd[.ddd][e[+/-]ddd]
+      // from the range [first, last) directly into the limbs of x.
+      // Digits beyond the precision of decwide_t are truncated,
+      // just as in rd_string(). The value of x is only modified
+      // if the number has been successfully read.
+
+      const auto is_digit = [](const char c) { return ((c >= '0') && (c <= '9')); }; // NOLINT(modernize-use-trailing-return-type)
+
+      const char* ptr = first;
+
+      auto b_neg = false;
+
+      if((ptr != last) && ((*ptr == '-') || (*ptr == '+')))
+      {
+        b_neg = (*ptr == '-');
+
+        ++ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      const char* int_first = ptr;
+
+      while((ptr != last) && is_digit(*ptr)) { ++ptr; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,altera-id-dependent-backward-branch)
+
+      const auto number_of_int_digits = static_cast<std::int64_t>(std::distance(int_first, ptr));
+
+      auto number_of_frac_digits = static_cast<std::int64_t>(INT8_C(0));
+
+      if((ptr != last) && (*ptr == '.'))
+      {
+        const char* frac_first = ++ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        while((ptr != last) && is_digit(*ptr)) { ++ptr; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,altera-id-dependent-backward-branch)
+
+        number_of_frac_digits = static_cast<std::int64_t>(std::distance(frac_first, ptr));
+      }
+
+      if((number_of_int_digits + number_of_frac_digits) == static_cast<std::int64_t>(INT8_C(0)))
+      {
+        return { first, std::errc::invalid_argument };
+      }
+
+      const char* digits_last = ptr;
+
+      // Read the optional exponent. An exponent character that is not
+      // followed by at least one digit is not part of the number.
+      auto exp_part        = static_cast<std::int64_t>(INT8_C(0));
+      auto exp_is_too_wide = false;
+
+      if((ptr != last) && ((*ptr == 'e') || (*ptr == 'E')))
+      {
+        const char* exp_ptr = ptr + static_cast<std::ptrdiff_t>(INT8_C(1)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        auto exp_is_neg = false;
+
+        if((exp_ptr != last) && ((*exp_ptr == '-') || (*exp_ptr == '+')))
+        {
+          exp_is_neg = (*exp_ptr == '-');
+
+          ++exp_ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        if((exp_ptr != last) && is_digit(*exp_ptr))
+        {
+          constexpr auto exp_part_limit = static_cast<std::int64_t>((std::numeric_limits<std::int64_t>::max)() / static_cast<std::int64_t>(INT8_C(100)));
+
+          while((exp_ptr != last) && is_digit(*exp_ptr)) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            if(exp_part < exp_part_limit)
+            {
+              exp_part = static_cast<std::int64_t>(static_cast<std::int64_t>(exp_part * static_cast<std::int64_t>(INT8_C(10))) + static_cast<std::int64_t>(*exp_ptr - '0'));
+            }
+            else
+            {
+              exp_is_too_wide = true;
+            }
+
+            ++exp_ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+
+          if(exp_is_neg) { exp_part = static_cast<std::int64_t>(-exp_part); }
+
+          ptr = exp_ptr;
+        }
+      }
+
+      // Skip the leading zeros, which may extend past the decimal point.
+      auto number_of_leading_zeros = static_cast<std::int64_t>(INT8_C(0));
+
+      const char* sig_first = int_first;
+
+      while((sig_first != digits_last) && ((*sig_first == '0') || (*sig_first == '.'))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(*sig_first == '0') { ++number_of_leading_zeros; }
+
+        ++sig_first; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      if(sig_first == digits_last)
+      {
+        // The number has nothing but zeros.
+        x = zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+
+        return { ptr, std::errc() };
+      }
+
+      // Get the base-10 exponent of the most significant digit.
+      const auto ilog =
+        static_cast<std::int64_t>
+        (
+            static_cast<std::int64_t>(static_cast<std::int64_t>(number_of_int_digits - static_cast<std::int64_t>(INT8_C(1))) - number_of_leading_zeros)
+          + exp_part
+        );
+
+      if(   exp_is_too_wide
+         || (ilog > static_cast<std::int64_t>(decwide_t_max_exp10))
+         || (ilog < static_cast<std::int64_t>(decwide_t_min_exp10)))
+      {
+        return { ptr, std::errc::result_out_of_range };
+      }
+
+      // The exponent of decwide_t is an even multiple of decwide_t_elem_digits10
+      // and the zeroth limb holds 1...decwide_t_elem_digits10 digits.
+      constexpr auto ed = static_cast<std::int64_t>(decwide_t_elem_digits10);
+
+      const auto ilog_div =
+        static_cast<std::int64_t>
         (
-          (!b_exp_is_neg) ? the_exp : static_cast<exponent_type>(-the_exp)
+            static_cast<std::int64_t>(ilog / ed)
+          - static_cast<std::int64_t>(((ilog % ed) < static_cast<std::int64_t>(INT8_C(0))) ? static_cast<std::int64_t>(INT8_C(1)) : static_cast<std::int64_t>(INT8_C(0)))
         );
 
-      str.push_back(my_uppercase ? 'E' : 'e');
+      x.my_exp       = static_cast<exponent_type>(ilog_div * ed);
+      x.my_neg       = b_neg;
+      x.my_fpclass   = fpclass_type::decwide_t_finite;
+      x.my_prec_elem = decwide_t_elem_number;
+
+      std::fill(x.my_data.begin(), x.my_data.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      using local_size_type = typename representation_type::size_type;
+
+      auto digits_to_go = static_cast<std::int32_t>(static_cast<std::int64_t>(ilog - static_cast<std::int64_t>(x.my_exp)) + static_cast<std::int64_t>(INT8_C(1)));
 
-      str.push_back((!b_exp_is_neg) ? '+' : '-');
+      auto limb_index = static_cast<std::int32_t>(INT8_C(0));
+      auto limb_value = static_cast<limb_type>(UINT8_C(0));
+
+      // Eight digits at a limb boundary fill one or more whole limbs.
+      constexpr auto limbs_per_eight_digits =
+        static_cast<std::int32_t>
+        (
+          ((static_cast<std::int32_t>(INT8_C(8)) % decwide_t_elem_digits10) == static_cast<std::int32_t>(INT8_C(0)))
+            ? static_cast<std::int32_t>(static_cast<std::int32_t>(INT8_C(8)) / decwide_t_elem_digits10)
+            : static_cast<std::int32_t>(INT8_C(0))
+        );
 
-      std::array<char, static_cast<std::size_t>(UINT8_C(20))> ptr_str = {{ '\0' }}; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      for( ; (sig_first != digits_last) && (limb_index < decwide_t_elem_number); ++sig_first) // NOLINT(altera-id-dependent-backward-branch,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        if(   (limbs_per_eight_digits != static_cast<std::int32_t>(INT8_C(0)))
+           && (digits_to_go == static_cast<std::int32_t>(decwide_t_elem_digits10))
+           && (std::distance(sig_first, digits_last) >= static_cast<std::ptrdiff_t>(INT8_C(8)))
+           && (static_cast<std::int32_t>(limb_index + limbs_per_eight_digits) <= decwide_t_elem_number))
+        {
+          const auto word = detail::swar_load_eight_chars(sig_first);
 
-      const char* ptr_end = util::baselexical_cast(u_exp, ptr_str.data(), ptr_str.data() + ptr_str.size()); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,llvm-qualified-auto,readability-qualified-auto)
+          if(detail::swar_eight_chars_are_digits(word))
+          {
+            auto value = detail::swar_eight_digits_to_value(word);
 
-      const auto str_exp_len = static_cast<std::size_t>(std::distance(static_cast<const char*>(ptr_str.data()), ptr_end));
+            for(auto j = limbs_per_eight_digits; j > static_cast<std::int32_t>(INT8_C(0)); --j)
+            {
+              x.my_data[static_cast<local_size_type>(static_cast<std::int32_t>(limb_index + static_cast<std::int32_t>(j - 1)))] =
+                static_cast<limb_type>(value % static_cast<std::uint32_t>(decwide_t_elem_mask));
 
-      auto str_exp = std::string(ptr_str.data(), ptr_str.data() + str_exp_len);
+              value = static_cast<std::uint32_t>(value / static_cast<std::uint32_t>(decwide_t_elem_mask));
+            }
 
-      // Format the exponent string to have a width that is an even multiple of three.
-      const auto str_exp_len_mod3 = static_cast<std::size_t>(str_exp_len % static_cast<std::size_t>(UINT8_C(3)));
+            limb_index = static_cast<std::int32_t>(limb_index + limbs_per_eight_digits);
 
-      const auto exp_has_mod3 = (str_exp_len_mod3 != static_cast<std::size_t>(UINT8_C(0)));
+            // Skip the last of the eight digits in the increment of the loop.
+            sig_first += static_cast<std::ptrdiff_t>(INT8_C(7)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      const auto str_exp_len_pad =
-        static_cast<std::size_t>
+            continue;
+          }
+        }
+
+        if(*sig_first != '.')
+        {
+          limb_value = static_cast<limb_type>(static_cast<limb_type>(limb_value * static_cast<limb_type>(UINT8_C(10))) + static_cast<limb_type>(*sig_first - '0'));
+
+          if(--digits_to_go == static_cast<std::int32_t>(INT8_C(0)))
+          {
+            x.my_data[static_cast<local_size_type>(limb_index)] = limb_value;
+
+            ++limb_index;
+
+            limb_value   = static_cast<limb_type>(UINT8_C(0));
+            digits_to_go = static_cast<std::int32_t>(decwide_t_elem_digits10);
+          }
+        }
+      }
+
+      // Scale a partially filled last limb to its full width.
+      if((limb_index < decwide_t_elem_number) && (limb_value != static_cast<limb_type>(UINT8_C(0))))
+      {
+        x.my_data[static_cast<local_size_type>(limb_index)] =
+          static_cast<limb_type>
+          (
+            limb_value * static_cast<limb_type>(detail::pow10_maker_as_runtime_value(static_cast<std::uint32_t>(digits_to_go)))
+          );
+      }
+
+      return { ptr, std::errc() };
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
+    #endif // !WIDE_DECIMAL_DISABLE_CHARCONV
+
+    template<typename PutFunctionType>
+    static auto wr_raw(const decwide_t& x, PutFunctionType& put) -> bool // NOLINT(google-runtime-references)
+    {
+      // Write x character-by-character to put() in the raw limb format.
+      const auto put_hex =
+        [&put](std::uint64_t u, const unsigned width) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          // Write u as a hexadecimal number having at least width digits.
+          std::array<char, static_cast<std::size_t>(UINT8_C(16))> buf { };
+
+          auto n = static_cast<unsigned>(UINT8_C(0));
+
+          do
+          {
+            ++n;
+
+            buf[static_cast<std::size_t>(buf.size() - n)] = "0123456789abcdef"[static_cast<std::size_t>(u & 0xFU)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+            u >>= 4U;
+          }
+          while((u != static_cast<std::uint64_t>(UINT8_C(0))) || (n < width));
+
+          auto result_is_ok = true;
+
+          for(auto i = static_cast<std::size_t>(buf.size() - n); (i < buf.size()) && result_is_ok; ++i)
+          {
+            result_is_ok = put(buf[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+
+          return result_is_ok;
+        };
+
+      // Trailing zero limbs are not written.
+      const auto it_last_nonzero =
+        std::find_if(x.my_data.crbegin(),
+                     x.my_data.crend(),
+                     [](const limb_type& limb) { return (limb != static_cast<limb_type>(UINT8_C(0))); }); // NOLINT(modernize-use-trailing-return-type)
+
+      const auto count = static_cast<std::size_t>(std::distance(it_last_nonzero, x.my_data.crend()));
+
+      const auto exp_is_neg = (x.my_exp < static_cast<exponent_type>(INT8_C(0)));
+
+      const auto exp_abs =
+        static_cast<std::uint64_t>
         (
-          exp_has_mod3 ? static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(3)) - str_exp_len_mod3)
-                       : static_cast<std::size_t>(UINT8_C(0))
+          (!exp_is_neg) ? static_cast<std::int64_t>(x.my_exp) : static_cast<std::int64_t>(-static_cast<std::int64_t>(x.my_exp))
         );
 
-      str.insert(str.end(), static_cast<std::size_t>(str_exp_len_pad), '0');
+      auto result_is_ok = (   put('D') && put('W') && put('1') && put(':')
+                           && put_hex(static_cast<std::uint64_t>(sizeof(limb_type)), 0U) && put(':')
+                           && put(x.my_neg ? '-' : '+') && put(':')
+                           && ((!exp_is_neg) || put('-')) && put_hex(exp_abs, 0U) && put(':')
+                           && put_hex(static_cast<std::uint64_t>(x.my_prec_elem), 0U) && put(':')
+                           && put_hex(static_cast<std::uint64_t>(count), 0U) && put(':'));
+
+      using local_size_type = typename representation_type::size_type;
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); (i < count) && result_is_ok; ++i)
+      {
+        result_is_ok = put_hex(static_cast<std::uint64_t>(x.my_data[static_cast<local_size_type>(i)]), static_cast<unsigned>(sizeof(limb_type) * 2U));
+      }
+
+      return result_is_ok;
+    }
+
+    static auto rd_raw(const char* first, const char* last, decwide_t& x) -> const char* // NOLINT(readability-function-cognitive-complexity,google-runtime-references)
+    {
+      // Read x from the raw limb format. The data may have been written
+      // by a decwide_t of another precision having the same limb type.
+      // Excess limbs are then truncated, just as in deserialize().
+      // The value of x is only modified on success. The end of the
+      // parsed characters is returned, or nullptr if they are invalid.
+      const char* ptr = first;
+
+      const auto get_char =
+        [&ptr, &last](const char c) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          const auto result_is_ok = ((ptr != last) && (*ptr == c));
+
+          if(result_is_ok) { ++ptr; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          return result_is_ok;
+        };
+
+      const auto get_hex =
+        [](const char*& p, const char* p_last, std::uint64_t& u, const std::ptrdiff_t width) -> bool // NOLINT(modernize-use-trailing-return-type,google-runtime-references)
+        {
+          // Read a hexadecimal number having exactly width digits,
+          // or having 1...16 digits if width is zero.
+          const auto max_width = ((width == static_cast<std::ptrdiff_t>(INT8_C(0))) ? static_cast<std::ptrdiff_t>(INT8_C(16)) : width);
+
+          u = static_cast<std::uint64_t>(UINT8_C(0));
+
+          auto n = static_cast<std::ptrdiff_t>(INT8_C(0));
+
+          for( ; (p != p_last) && (n < max_width); ++p, ++n) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,altera-id-dependent-backward-branch)
+          {
+            const char c = *p;
+
+            std::uint64_t nibble { };
+
+            if     ((c >= '0') && (c <= '9')) { nibble = static_cast<std::uint64_t>(c - '0'); }
+            else if((c >= 'a') && (c <= 'f')) { nibble = static_cast<std::uint64_t>(static_cast<int>(c - 'a') + 10); } // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+            else if((c >= 'A') && (c <= 'F')) { nibble = static_cast<std::uint64_t>(static_cast<int>(c - 'A') + 10); } // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+            else                              { break; }
+
+            u = static_cast<std::uint64_t>(static_cast<std::uint64_t>(u << 4U) | nibble);
+          }
+
+          return ((width == static_cast<std::ptrdiff_t>(INT8_C(0))) ? (n != static_cast<std::ptrdiff_t>(INT8_C(0))) : (n == width));
+        };
+
+      std::uint64_t limb_size { };
+      std::uint64_t exp_abs   { };
+      std::uint64_t prec_elem { };
+      std::uint64_t count     { };
+
+      const auto header_prefix_is_ok =
+        (
+             get_char('D') && get_char('W') && get_char('1') && get_char(':')
+          && get_hex(ptr, last, limb_size, static_cast<std::ptrdiff_t>(INT8_C(0)))
+          && (limb_size == static_cast<std::uint64_t>(sizeof(limb_type)))
+          && get_char(':')
+        );
+
+      const auto b_neg = (header_prefix_is_ok && (ptr != last) && (*ptr == '-'));
+
+      const auto sign_is_ok = (header_prefix_is_ok && (get_char('+') || get_char('-')) && get_char(':'));
+
+      const auto exp_is_neg = (sign_is_ok && get_char('-'));
+
+      const auto header_is_ok =
+        (
+             sign_is_ok
+          && get_hex(ptr, last, exp_abs,   static_cast<std::ptrdiff_t>(INT8_C(0))) && get_char(':')
+          && get_hex(ptr, last, prec_elem, static_cast<std::ptrdiff_t>(INT8_C(0))) && get_char(':')
+          && get_hex(ptr, last, count,     static_cast<std::ptrdiff_t>(INT8_C(0))) && get_char(':')
+        );
+
+      constexpr auto limb_width = static_cast<std::ptrdiff_t>(sizeof(limb_type) * 2U);
+
+      const auto exp_is_ok =
+        (
+             header_is_ok
+          && (exp_abs <= static_cast<std::uint64_t>((std::numeric_limits<std::int64_t>::max)()))
+        );
+
+      const auto the_exp =
+        static_cast<std::int64_t>
+        (
+          exp_is_ok ? ((!exp_is_neg) ? static_cast<std::int64_t>(exp_abs) : static_cast<std::int64_t>(-static_cast<std::int64_t>(exp_abs)))
+                    : static_cast<std::int64_t>(INT8_C(0))
+        );
+
+      const auto fields_are_ok =
+        (
+             exp_is_ok
+          && (the_exp <= static_cast<std::int64_t>(decwide_t_max_exp10))
+          && (the_exp >= static_cast<std::int64_t>(decwide_t_min_exp10))
+          && ((the_exp % static_cast<std::int64_t>(decwide_t_elem_digits10)) == static_cast<std::int64_t>(INT8_C(0)))
+          && (prec_elem > static_cast<std::uint64_t>(UINT8_C(0)))
+          && (prec_elem <= static_cast<std::uint64_t>((std::numeric_limits<std::int32_t>::max)()))
+          && (count <= static_cast<std::uint64_t>(std::distance(ptr, last) / limb_width))
+        );
+
+      if(!fields_are_ok)
+      {
+        return nullptr;
+      }
+
+      // Check all of the limbs before storing any of them. The limbs
+      // must be normalized: a zero first limb is only allowed if all of
+      // the limbs are zero.
+      {
+        const char* p_limb = ptr;
+
+        auto first_limb_is_zero = false;
+
+        for(auto i = static_cast<std::uint64_t>(UINT8_C(0)); i < count; ++i)
+        {
+          std::uint64_t limb { };
+
+          if(   (!get_hex(p_limb, last, limb, limb_width))
+             || (limb >= static_cast<std::uint64_t>(decwide_t_elem_mask))
+             || (first_limb_is_zero && (limb != static_cast<std::uint64_t>(UINT8_C(0)))))
+          {
+            return nullptr;
+          }
+
+          if(i == static_cast<std::uint64_t>(UINT8_C(0)))
+          {
+            first_limb_is_zero = (limb == static_cast<std::uint64_t>(UINT8_C(0)));
+          }
+        }
+      }
+
+      detail::make_representation_unique(x.my_data);
+
+      using local_size_type = typename representation_type::size_type;
+
+      const auto count_to_store = static_cast<std::size_t>((std::min)(count, static_cast<std::uint64_t>(decwide_t_elem_number)));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count_to_store; ++i)
+      {
+        std::uint64_t limb { };
+
+        static_cast<void>(get_hex(ptr, last, limb, limb_width));
+
+        x.my_data[static_cast<local_size_type>(i)] = static_cast<limb_type>(limb);
+      }
+
+      std::fill(x.my_data.begin() + static_cast<std::ptrdiff_t>(count_to_store), x.my_data.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      ptr += static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(count - static_cast<std::uint64_t>(count_to_store)) * limb_width); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      x.my_exp       = static_cast<exponent_type>(the_exp);
+      x.my_neg       = b_neg;
+      x.my_fpclass   = fpclass_type::decwide_t_finite;
+      x.my_prec_elem = static_cast<std::int32_t>((std::min)(prec_elem, static_cast<std::uint64_t>(decwide_t_elem_number)));
+
+      return ptr;
+    }
+
+    template<typename BinaryLimbType>
+    static constexpr auto binary_limb_digits() -> int
+    {
+      return std::numeric_limits<BinaryLimbType>::digits;
+    }
+
+    static auto binary_limbs_prec_elem(const std::size_t limb_count, const int limb_digits) -> std::int32_t
+    {
+      // Get the number of decimal limbs needed to exactly hold an integer
+      // having limb_count binary limbs, using log10(2) = 0.30103 (rounded up).
+      // Include guard limbs for alignment and for the carry of the leading limb.
+      const auto digits_needed =
+        static_cast<std::size_t>
+        (
+            static_cast<std::size_t>
+            (
+                static_cast<std::size_t>(limb_count * static_cast<std::size_t>(limb_digits))
+              * static_cast<std::size_t>(UINT32_C(30103))
+            )
+          / static_cast<std::size_t>(UINT32_C(100000))
+        );
+
+      const auto elems_needed =
+        static_cast<std::size_t>
+        (
+            static_cast<std::size_t>(digits_needed / static_cast<std::size_t>(decwide_t_elem_digits10))
+          + static_cast<std::size_t>(UINT8_C(3))
+        );
+
+      return
+        static_cast<std::int32_t>
+        (
+          (std::min)(elems_needed, static_cast<std::size_t>(decwide_t_elem_number))
+        );
+    }
+
+    auto set_prec_elem_exactly(const std::int32_t prec_elem) -> void
+    {
+      detail::make_representation_unique(my_data);
+
+      // Set the working precision of an integer value that is known
+      // to fit within the new precision. Limbs beyond the precision
+      // of the value are cleared, so that they can not enter the
+      // calculation when the working precision is raised again.
+      const auto prec_elem_low = (std::min)(my_prec_elem, prec_elem);
+
+      std::fill(my_data.begin() + static_cast<std::ptrdiff_t>(prec_elem_low),
+                my_data.end(),
+                static_cast<limb_type>(UINT8_C(0)));
+
+      my_prec_elem = prec_elem;
+    }
+
+    static auto make_binary_limb_powers(const int limb_digits, const std::size_t level_count) -> util::dynamic_array<decwide_t>
+    {
+      // Tabulate the powers B^(2^j) of the binary limb base B,
+      // for j = 0, 1, ..., level_count - 1, by repeated squaring.
+      util::dynamic_array<decwide_t> powers(level_count, one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
+
+      if(level_count > static_cast<std::size_t>(UINT8_C(0)))
+      {
+        // The square root of the binary limb base fits in 32 bits.
+        const auto half_base =
+          decwide_t
+          (
+            static_cast<unsigned long long>(1ULL << static_cast<unsigned>(limb_digits / 2)) // NOLINT(google-runtime-int)
+          );
+
+        powers[static_cast<std::size_t>(UINT8_C(0))] = half_base * half_base;
+
+        for(auto level = static_cast<std::size_t>(UINT8_C(1)); level < level_count; ++level)
+        {
+          powers[level] = powers[level - 1U] * powers[level - 1U];
+        }
+      }
+
+      return powers;
+    }
+
+    template<typename BinaryLimbIteratorType>
+    static auto from_binary_limbs_recursive(      BinaryLimbIteratorType          first,
+                                            const std::size_t                     count,
+                                            const util::dynamic_array<decwide_t>& powers) -> decwide_t
+    {
+      using binary_limb_type = typename std::iterator_traits<BinaryLimbIteratorType>::value_type;
+
+      if(count == static_cast<std::size_t>(UINT8_C(1)))
+      {
+        return decwide_t(static_cast<binary_limb_type>(*first));
+      }
+
+      // Split the binary integer into u = hi * B^half + lo,
+      // where half is the largest power of two less than count.
+      auto level = static_cast<std::size_t>(UINT8_C(0));
+
+      while((static_cast<std::size_t>(UINT8_C(2)) << level) < count)
+      {
+        ++level;
+      }
+
+      const auto half = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << level);
+
+      decwide_t lo = from_binary_limbs_recursive(first, half, powers);
+      decwide_t hi = from_binary_limbs_recursive(first + static_cast<std::ptrdiff_t>(half), static_cast<std::size_t>(count - half), powers);
+
+      if(hi.iszero())
+      {
+        return lo;
+      }
+
+      const auto prec_elem = binary_limbs_prec_elem(count, binary_limb_digits<binary_limb_type>());
+
+      hi.set_prec_elem_exactly(prec_elem);
+      hi *= powers[level];
+      hi.set_prec_elem_exactly(prec_elem);
+
+      if(!lo.iszero())
+      {
+        lo.set_prec_elem_exactly(prec_elem);
+        hi += lo;
+        hi.set_prec_elem_exactly(prec_elem);
+      }
+
+      return hi;
+    }
+
+    template<typename BinaryLimbIteratorType>
+    static auto to_binary_limbs_recursive(      decwide_t                       u,
+                                                BinaryLimbIteratorType          first,
+                                          const std::size_t                     count,
+                                          const util::dynamic_array<decwide_t>& powers,
+                                          const util::dynamic_array<decwide_t>& inverses) -> bool
+    {
+      using binary_limb_type = typename std::iterator_traits<BinaryLimbIteratorType>::value_type;
+
+      if(count == static_cast<std::size_t>(UINT8_C(1)))
+      {
+        const auto result_fits = (u < powers[static_cast<std::size_t>(UINT8_C(0))]);
+
+        *first = (result_fits ? static_cast<binary_limb_type>(u.extract_unsigned_long_long()) : static_cast<binary_limb_type>(UINT8_C(0)));
+
+        return result_fits;
+      }
+
+      // Split the integer into u = q * B^half + r, with q and r being
+      // converted to the upper and lower binary limbs, respectively.
+      auto level = static_cast<std::size_t>(UINT8_C(0));
+
+      while((static_cast<std::size_t>(UINT8_C(2)) << level) < count)
+      {
+        ++level;
+      }
+
+      const auto half = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << level);
+
+      const auto prec_elem = binary_limbs_prec_elem(count, binary_limb_digits<binary_limb_type>());
+
+      u.set_prec_elem_exactly(prec_elem);
+
+      // Estimate the quotient from the tabulated inverse. The estimate
+      // is off by at most one, which is corrected in the following.
+      decwide_t q(u);
+
+      q *= inverses[level];
+      q  = q.extract_integer_part();
+      q.set_prec_elem_exactly(prec_elem);
+
+      decwide_t r(q);
+
+      r *= powers[level];
+      r.set_prec_elem_exactly(prec_elem);
+      r  = u - r;
+      r.set_prec_elem_exactly(prec_elem);
+
+      while(r.isneg())
+      {
+        q -= one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+        q.set_prec_elem_exactly(prec_elem);
+
+        r += powers[level];
+        r.set_prec_elem_exactly(prec_elem);
+      }
+
+      while(r >= powers[level])
+      {
+        q += one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+        q.set_prec_elem_exactly(prec_elem);
+
+        r -= powers[level];
+        r.set_prec_elem_exactly(prec_elem);
+      }
+
+      const auto result_lo_is_ok = to_binary_limbs_recursive(r, first, half, powers, inverses);
+      const auto result_hi_is_ok = to_binary_limbs_recursive(q, first + static_cast<std::ptrdiff_t>(half), static_cast<std::size_t>(count - half), powers, inverses);
+
+      return (result_lo_is_ok && result_hi_is_ok);
+    }
+
+    static auto binary_limbs_level_count(const std::size_t count) -> std::size_t
+    {
+      // Get the number of tabulated powers B^(2^j) needed
+      // to split an integer having count binary limbs.
+      auto level_count = static_cast<std::size_t>(UINT8_C(1));
+
+      while((static_cast<std::size_t>(UINT8_C(1)) << level_count) < count)
+      {
+        ++level_count;
+      }
+
+      return level_count;
+    }
+
+    static auto get_output_digits(const decwide_t&         x,
+                                        char*              it_dst,
+                                  const std::uint_fast32_t number_of_elements,
+                                        std::size_t*       count_retrieved,
+                                  const bool               include_decimal_point = false) -> void
+    {
+      // Extract the required digits from decwide_t, including
+      // digits both before as well as after the decimal point.
+
+      // Include the decimal point in the retrieved characters
+      // if requested. Do not, however, count an inserted
+      // decimal point as one of the retrieved characters.
+
+      using data_elem_array_type =
+        std::array<char, static_cast<std::size_t>(decwide_t_elem_digits10)>;
+
+      data_elem_array_type data_elem_buf { };
+
+      // Obtain the digits in the first limb.
+      auto it_rep = x.crepresentation().cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      const char* p_end = util::baselexical_cast(*it_rep, data_elem_buf.data(), data_elem_buf.data() + data_elem_buf.size()); // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+
+      ++it_rep;
+
+      *count_retrieved =
+        static_cast<std::size_t>
+        (
+          std::distance(static_cast<const char*>(data_elem_buf.data()), p_end)
+        );
+
+      it_dst = std::copy(data_elem_buf.cbegin(),
+                         data_elem_buf.cbegin() + *count_retrieved,
+                         it_dst);
+
+      // Include the decimal point if requested.
+      if(include_decimal_point)
+      {
+        *it_dst++ = '.'; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      data_elem_array_type data_elem_array { };
+
+      // Extract the digits following the decimal point from decwide_t,
+      // beginning with the data element having index 1.
+      while(it_rep != (x.crepresentation().cbegin() + static_cast<std::size_t>(number_of_elements))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        p_end = util::baselexical_cast(*it_rep, data_elem_buf.data(), data_elem_buf.data() + data_elem_buf.size());
+
+        ++it_rep;
+
+        auto rit = std::copy(static_cast<std::reverse_iterator<const char*>>(p_end),
+                             static_cast<std::reverse_iterator<const char*>>(static_cast<const char*>(data_elem_buf.data())),
+                             data_elem_array.rbegin());
+
+        std::fill(rit, data_elem_array.rend(), '0');
+
+        it_dst = std::copy(data_elem_array.cbegin(),
+                           data_elem_array.cend(),
+                           it_dst);
+
+        *count_retrieved =
+          static_cast<std::size_t>
+          (
+              *count_retrieved
+            + static_cast<std::size_t>(decwide_t_elem_digits10)
+          );
+      }
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+    static auto os_float_field(const std::ios::fmtflags ostrm_flags) -> detail::os_float_field_type
+    {
+      using local_flags_type = std::ios::fmtflags;
+
+      return
+        (static_cast<local_flags_type>(ostrm_flags & std::ios::scientific) == static_cast<local_flags_type>(std::ios::scientific))
+          ? detail::os_float_field_type::scientific
+          : ((static_cast<local_flags_type>(ostrm_flags & std::ios::fixed) == static_cast<local_flags_type>(std::ios::fixed))
+              ? detail::os_float_field_type::fixed
+              : detail::os_float_field_type::none);
+    }
+
+    // The characters are written as they are to narrow streams
+    // and are widened with the locale of the stream otherwise.
+    template<typename char_type, typename traits_type>
+    struct ostream_sink
+    {
+      std::basic_ostream<char_type, traits_type>& my_os; // NOLINT(misc-non-private-member-variables-in-classes,cppcoreguidelines-avoid-const-or-ref-data-members)
+
+      auto write(const char* p, std::size_t count) -> bool
+      {
+        return write(p, count, std::is_same<char_type, char>());
+      }
+
+    private:
+      auto write(const char* p, std::size_t count, std::true_type) -> bool // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      {
+        static_cast<void>(my_os.write(p, static_cast<std::streamsize>(count)));
+
+        return my_os.good();
+      }
+
+      auto write(const char* p, std::size_t count, std::false_type) -> bool // NOLINT(hicpp-named-parameter,readability-named-parameter)
+      {
+        std::array<char_type, static_cast<std::size_t>(UINT8_C(64))> wide_chars { };
+
+        while((count != static_cast<std::size_t>(UINT8_C(0))) && my_os.good())
+        {
+          const auto n = (std::min)(count, wide_chars.size());
+
+          for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < n; ++i)
+          {
+            wide_chars[i] = my_os.widen(p[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-pro-bounds-constant-array-index)
+          }
+
+          static_cast<void>(my_os.write(wide_chars.data(), static_cast<std::streamsize>(n)));
+
+          p     += n; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          count -= n;
+        }
+
+        return my_os.good();
+      }
+    };
+
+    struct file_sink
+    {
+      std::FILE* my_file; // NOLINT(misc-non-private-member-variables-in-classes)
+
+      auto write(const char* p, std::size_t count) -> bool
+      {
+        return (std::fwrite(p, static_cast<std::size_t>(UINT8_C(1)), count, my_file) == count);
+      }
+    };
+
+    template<typename char_type, typename traits_type>
+    friend auto write_digits(std::basic_ostream<char_type, traits_type>& os,
+                             const decwide_t&                            x,
+                             chars_format                                fmt,
+                             int                                         precision,
+                             const digit_grouping&                       grouping = digit_grouping()) -> bool
+    {
+      // Stream the digits of x in chunks, without building
+      // a string holding the whole number.
+      ostream_sink<char_type, traits_type> sink { os };
+
+      detail::chunked_char_writer<ostream_sink<char_type, traits_type>> writer(sink);
+
+      const auto result_is_ok = wr_digits(x, os_float_field(fmt), static_cast<std::int64_t>(precision), false, false, false, grouping, writer);
+
+      return (writer.flush() && result_is_ok);
+    }
+
+    friend auto write_digits(std::FILE*            file,
+                             const decwide_t&      x,
+                             chars_format          fmt,
+                             int                   precision,
+                             const digit_grouping& grouping = digit_grouping()) -> bool
+    {
+      file_sink sink { file };
+
+      detail::chunked_char_writer<file_sink> writer(sink);
+
+      const auto result_is_ok = wr_digits(x, os_float_field(fmt), static_cast<std::int64_t>(precision), false, false, false, grouping, writer);
+
+      return (writer.flush() && result_is_ok);
+    }
+
+    template<typename char_type, typename traits_type>
+    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const decwide_t& f) -> std::basic_ostream<char_type, traits_type>&
+    {
+      if(os.iword(detail::raw_limbs_iword_index()) != 0L)
+      {
+        ostream_sink<char_type, traits_type> sink { os };
+
+        detail::chunked_char_writer<ostream_sink<char_type, traits_type>> writer(sink);
+
+        static_cast<void>(wr_raw(f, writer));
+
+        static_cast<void>(writer.flush());
+
+        return os;
+      }
+
+      using local_flags_type = std::ios::fmtflags;
+
+      const auto ostrm_flags = os.flags();
+
+      const bool my_showpos   { static_cast<local_flags_type>(ostrm_flags & std::ios::showpos)   == static_cast<local_flags_type>(std::ios::showpos) };
+      const bool my_showpoint { static_cast<local_flags_type>(ostrm_flags & std::ios::showpoint) == static_cast<local_flags_type>(std::ios::showpoint) };
+      const bool my_uppercase { static_cast<local_flags_type>(ostrm_flags & std::ios::uppercase) == static_cast<local_flags_type>(std::ios::uppercase) };
+      const bool my_left      { static_cast<local_flags_type>(ostrm_flags & std::ios::left)      == static_cast<local_flags_type>(std::ios::left) };
+
+      const auto my_float_field = os_float_field(ostrm_flags);
+      const auto my_precision   = static_cast<std::int64_t>(os.precision());
+
+      // Handle std::setw(...) and std::setfill(...). The output is
+      // counted first, so that the digits can still be streamed in
+      // chunks. Left-justify is the exception, std::right and
+      // std::internal justify right. The width is consumed just
+      // as a formatted output would.
+      const auto my_width = os.width();
+
+      static_cast<void>(os.width(static_cast<std::streamsize>(INT8_C(0))));
+
+      auto n_fill = static_cast<std::streamsize>(INT8_C(0));
+
+      if(my_width > static_cast<std::streamsize>(INT8_C(0)))
+      {
+        auto n_chars = static_cast<std::streamsize>(INT8_C(0));
+
+        auto count_chars =
+          [&n_chars](const char) -> bool // NOLINT(modernize-use-trailing-return-type,hicpp-named-parameter,readability-named-parameter)
+          {
+            ++n_chars;
+
+            return true;
+          };
+
+        static_cast<void>(wr_digits(f, my_float_field, my_precision, my_showpos, my_showpoint, my_uppercase, digit_grouping(), count_chars));
+
+        n_fill = ((my_width > n_chars) ? static_cast<std::streamsize>(my_width - n_chars) : static_cast<std::streamsize>(INT8_C(0)));
+      }
+
+      ostream_sink<char_type, traits_type> sink { os };
+
+      detail::chunked_char_writer<ostream_sink<char_type, traits_type>> writer(sink);
+
+      const auto my_fill = os.narrow(os.fill(), ' ');
+
+      const auto put_fill =
+        [&writer, &my_fill](std::streamsize n) -> void // NOLINT(modernize-use-trailing-return-type)
+        {
+          for( ; n != static_cast<std::streamsize>(INT8_C(0)); --n)
+          {
+            static_cast<void>(writer(my_fill));
+          }
+        };
+
+      if(!my_left) { put_fill(n_fill); }
+
+      static_cast<void>(wr_digits(f, my_float_field, my_precision, my_showpos, my_showpoint, my_uppercase, digit_grouping(), writer));
+
+      if(my_left) { put_fill(n_fill); }
+
+      static_cast<void>(writer.flush());
+
+      return os;
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
+    template<typename char_type, typename traits_type>
+    friend auto operator>>(std::basic_istream<char_type, traits_type>& is, decwide_t& f) -> std::basic_istream<char_type, traits_type>&
+    {
+      std::string str;
+
+      static_cast<void>(is >> str);
+
+      if(str.compare(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(4)), "DW1:") == 0)
+      {
+        const char* p_end = rd_raw(str.data(), str.data() + str.length(), f); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        if(p_end != str.data() + str.length()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        {
+          is.setstate(std::ios::failbit);
+        }
+      }
+      else
+      {
+        static_cast<void>(f.rd_string(str.c_str()));
+      }
+
+      return is;
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
+
+    #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+    friend inline auto to_chars(char* first, char* last, const decwide_t& x, chars_format fmt, int precision) -> to_chars_result
+    {
+      return wr_chars(first, last, x, fmt, static_cast<std::int64_t>(precision));
+    }
+
+    friend inline auto to_chars(char* first, char* last, const decwide_t& x) -> to_chars_result
+    {
+      return wr_chars(first, last, x, chars_format::general, static_cast<std::int64_t>(decwide_t_max_digits10));
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
+    friend inline auto from_chars(const char* first, const char* last, decwide_t& x) -> from_chars_result // NOLINT(google-runtime-references)
+    {
+      return rd_chars(first, last, x);
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
+
+    // Write the values in [values_first, values_last) to one contiguous
+    // buffer as a column separated by the delimiter, such as ',' for the
+    // fields of a CSV line or '\n' for a column of lines. No delimiter
+    // follows the last value.
+    friend auto to_chars_batch(char*            first,
+                               char*            last,
+                               const decwide_t* values_first,
+                               const decwide_t* values_last,
+                               const char       delimiter,
+                               chars_format     fmt,
+                               int              precision) -> to_chars_batch_result
+    {
+      char* ptr = first;
+
+      auto count = static_cast<std::size_t>(UINT8_C(0));
+
+      for(const decwide_t* p = values_first; p != values_last; ++p) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        if(p != values_first)
+        {
+          if(ptr == last) { return { last, count, std::errc::value_too_large }; }
+
+          *ptr++ = delimiter; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        const auto result = wr_chars(ptr, last, *p, fmt, static_cast<std::int64_t>(precision));
+
+        if(result.ec != std::errc()) { return { last, count, result.ec }; }
+
+        ptr = result.ptr;
+
+        ++count;
+      }
+
+      return { ptr, count, std::errc() };
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
+    // Read a column of values separated by the delimiter or by line breaks
+    // ("\n" or "\r\n") from one contiguous buffer into [values_first, values_last).
+    // Reading stops at the end of either range, or at the first field that is
+    // not a number followed by a separator, which is reported as an error.
+    friend auto from_chars_batch(const char* first,
+                                 const char* last,
+                                 decwide_t*  values_first,
+                                 decwide_t*  values_last,
+                                 const char  delimiter) -> from_chars_batch_result
+    {
+      const char* ptr = first;
+
+      auto count = static_cast<std::size_t>(UINT8_C(0));
+
+      for(decwide_t* p = values_first; (p != values_last) && (ptr != last); ++p) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        const auto result = rd_chars(ptr, last, *p);
+
+        if(result.ec != std::errc()) { return { result.ptr, count, result.ec }; }
+
+        ptr = result.ptr;
+
+        ++count;
+
+        if(ptr != last)
+        {
+          if((*ptr == '\r') && (std::next(ptr) != last) && (*std::next(ptr) == '\n'))
+          {
+            ++ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+
+          if((*ptr != delimiter) && (*ptr != '\n')) { return { ptr, count, std::errc::invalid_argument }; }
+
+          ++ptr; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+      }
+
+      return { ptr, count, std::errc() };
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
+
+    // Write and read x in a raw format, which is an exact image of its
+    // limbs, exponent, sign and precision. No conversion between number
+    // bases is involved, so this is lossless and much faster than the
+    // decimal formats. The format has the form
+    //   DW1:<limb size>:<sign>:<exponent>:<precision>:<count>:<limbs>
+    // with the limb size in bytes and the sign + or -. The signed
+    // exponent, the precision in limbs and the number of limbs are
+    // hexadecimal. The limbs follow, each one as a hexadecimal number
+    // having two digits per byte. Trailing zero limbs are omitted, and
+    // the first limb is only zero if the value is zero.
+    friend auto to_chars_raw(char* first, char* last, const decwide_t& x) -> to_chars_result
+    {
+      char* ptr = first;
+
+      auto put =
+        [&ptr, &last](const char c) -> bool // NOLINT(modernize-use-trailing-return-type)
+        {
+          const auto has_room = (ptr != last);
+
+          if(has_room) { *ptr++ = c; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          return has_room;
+        };
+
+      const auto result_is_ok = wr_raw(x, put);
+
+      return
+      {
+        (result_is_ok ? ptr : last),
+        (result_is_ok ? std::errc() : std::errc::value_too_large)
+      };
+    }
+
+    friend auto from_chars_raw(const char* first, const char* last, decwide_t& x) -> from_chars_result // NOLINT(google-runtime-references)
+    {
+      const char* p_end = rd_raw(first, last, x);
+
+      return
+      {
+        ((p_end != nullptr) ? p_end : first),
+        ((p_end != nullptr) ? std::errc() : std::errc::invalid_argument)
+      };
+    }
+    #endif // !WIDE_DECIMAL_DISABLE_CHARCONV
+
+    // Convert to and from binary integers, such as the limbs of uintwide_t.
+    // The binary limbs are unsigned integers stored in little-endian order
+    // (least significant limb first) in a random-access range.
+    // The conversion uses divide-and-conquer with the tabulated powers
+    // B^(2^j) of the binary limb base B, so that its complexity is
+    // that of the multiplication times the logarithm of the length.
+    // Integers having more digits than the precision of decwide_t
+    // are rounded when converted to decwide_t, and their lower
+    // binary limbs are not resolved when converted from decwide_t.
+
+    template<typename BinaryLimbIteratorType>
+    friend auto from_binary_limbs(BinaryLimbIteratorType first, BinaryLimbIteratorType last, decwide_t& x) -> void // NOLINT(google-runtime-references)
+    {
+      detail::make_representation_unique(x.my_data);
+
+      using binary_limb_type = typename std::iterator_traits<BinaryLimbIteratorType>::value_type;
+
+      static_assert(   std::is_integral<binary_limb_type>::value
+                    && std::is_unsigned<binary_limb_type>::value
+                    && (std::numeric_limits<binary_limb_type>::digits <= 64),
+                    "Error: The binary limb type must be an unsigned integral type having at most 64 bits");
+
+      // Skip the leading zero limbs.
+      auto count = static_cast<std::size_t>(std::distance(first, last));
+
+      while((count > static_cast<std::size_t>(UINT8_C(0))) && (*(first + static_cast<std::ptrdiff_t>(count - 1U)) == static_cast<binary_limb_type>(UINT8_C(0))))
+      {
+        --count;
+      }
+
+      if(count == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        x = zero<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      }
+      else
+      {
+        const auto powers = make_binary_limb_powers(binary_limb_digits<binary_limb_type>(), binary_limbs_level_count(count));
+
+        x = from_binary_limbs_recursive(first, count, powers);
 
-      str += str_exp;
+        x.set_prec_elem_exactly(decwide_t_elem_number);
+      }
     }
 
-    static auto wr_string_fixed(      std::string&       str, // NOLINT(google-runtime-references)
-                                const exponent_type      the_exp,
-                                const std::uint_fast32_t os_precision,
-                                const bool               my_showpoint,
-                                const bool               trim_trailing_zeros = false) -> void
+    template<typename BinaryLimbIteratorType>
+    friend auto to_binary_limbs(const decwide_t& x, BinaryLimbIteratorType first, BinaryLimbIteratorType last) -> bool
     {
-      const auto input_str_len = static_cast<std::size_t>(str.length());
-
-      if(the_exp < static_cast<exponent_type>(INT8_C(0)))
-      {
-        // The number is less than one in magnitude.
+      // Convert the integer part of the absolute value of x.
+      // If this does not fit in the binary limbs, then
+      // the limbs are set to zero and false is returned.
+      using binary_limb_type = typename std::iterator_traits<BinaryLimbIteratorType>::value_type;
 
-        const auto zero_insert_length =
-          detail::negate
-          (
-            static_cast<exponent_type>
-            (
-                static_cast<exponent_type>(the_exp)
-              + static_cast<exponent_type>(INT8_C(1))
-            )
-          );
+      static_assert(   std::is_integral<binary_limb_type>::value
+                    && std::is_unsigned<binary_limb_type>::value
+                    && (std::numeric_limits<binary_limb_type>::digits <= 64),
+                    "Error: The binary limb type must be an unsigned integral type having at most 64 bits");
 
-        const auto n_pad =
-          static_cast<exponent_type>
-          (
-              static_cast<exponent_type>(os_precision)
-            - static_cast<exponent_type>(static_cast<exponent_type>(str.length()) + zero_insert_length)
-          );
+      const auto count = static_cast<std::size_t>(std::distance(first, last));
 
-        // Insert the decimal point using "0." as well as the needed number
-        // of leading zeros.
+      std::fill(first, last, static_cast<binary_limb_type>(UINT8_C(0)));
 
-        str.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(zero_insert_length), '0');
-        str.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)),         '.');
-        str.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)),         '0');
+      const auto u = fabs(x).extract_integer_part();
 
-        // Zero-extend the string to the given precision if necessary.
-        if(n_pad > static_cast<exponent_type>(INT8_C(0)))
-        {
-          str.insert(str.end(), static_cast<std::size_t>(n_pad), '0');
-        }
-      }
-      else
+      if(u.iszero())
       {
-        // Insert the decimal point.
-        const auto my_exp_plus_one =
-          static_cast<std::uint_fast32_t>
-          (
-            static_cast<exponent_type>
-            (
-              the_exp + static_cast<exponent_type>(INT8_C(1))
-            )
-          );
+        return true;
+      }
 
-        // The number string is not large enough to hold the integer part of the number.
-        // Zero extend the integer part of the string.
-        if(input_str_len < static_cast<std::size_t>(my_exp_plus_one))
-        {
-          str.insert(str.end(), static_cast<std::size_t>(my_exp_plus_one - static_cast<std::uint_fast32_t>(str.length())), '0');
-        }
+      const auto ilog10_max =
+        static_cast<std::int64_t>
+        (
+          static_cast<std::int64_t>(static_cast<std::size_t>(static_cast<std::size_t>(count * static_cast<std::size_t>(binary_limb_digits<binary_limb_type>())) * static_cast<std::size_t>(UINT32_C(30103))) / static_cast<std::size_t>(UINT32_C(100000)))
+        );
 
-        str.insert(static_cast<std::size_t>(my_exp_plus_one), static_cast<std::size_t>(UINT8_C(1)), '.');
+      auto result_is_ok = ((count > static_cast<std::size_t>(UINT8_C(0))) && (static_cast<std::int64_t>(ilogb(u)) <= ilog10_max));
 
-        // Zero-extend the string to the given precision if necessary.
-        const auto n_pad =
-          static_cast<exponent_type>
-          (
-              static_cast<exponent_type>(os_precision)
-            - static_cast<exponent_type>
-              (
-                  static_cast<exponent_type>(str.length() - static_cast<std::size_t>(UINT8_C(1)))
-                - static_cast<exponent_type>(the_exp + static_cast<exponent_type>(INT8_C(1)))
-              )
-          );
+      if(result_is_ok)
+      {
+        const auto powers = make_binary_limb_powers(binary_limb_digits<binary_limb_type>(), binary_limbs_level_count(count));
 
-        if(n_pad > static_cast<exponent_type>(INT8_C(0)))
-        {
-          // This line is marked as lcov exclude line. Even though
-          // there are explicit test cases thought to cover this line,
-          // it is mysteriously sometimes not being hit.
+        util::dynamic_array<decwide_t> inverses(powers.size(), one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>());
 
-          str.insert(str.end(), static_cast<std::size_t>(n_pad), '0'); // LCOV_EXCL_LINE
+        for(auto level = static_cast<std::size_t>(UINT8_C(0)); level < powers.size(); ++level)
+        {
+          inverses[level] /= powers[level];
         }
-      }
 
-      // Trim the trailing zeros, where the trim-characteristics depend on the showpoint flag.
-      if(trim_trailing_zeros)
-      {
-        const auto rit_non_zero =
-          std::find_if(str.crbegin(),
-                       str.crend(),
-                       [](const char& c) // NOLINT(modernize-use-trailing-return-type)
-                       {
-                         return (c != '0');
-                       });
+        result_is_ok = to_binary_limbs_recursive(u, first, count, powers, inverses);
 
-        if(rit_non_zero != str.crbegin())
+        if(!result_is_ok)
         {
-          const auto ofs =
-            static_cast<std::ptrdiff_t>
-            (
-                static_cast<std::ptrdiff_t>(str.length())
-              - std::distance(str.crbegin(), rit_non_zero)
-            );
-
-          str.erase(str.begin() + ofs, str.end());
+          std::fill(first, last, static_cast<binary_limb_type>(UINT8_C(0)));
         }
       }
 
-      // Perform the final manipulations on the digits of the string.
-      if(my_showpoint)
-      {
-        if(trim_trailing_zeros)
-        {
-          special_extend_string_to_precision(str, os_precision);
-        }
-      }
-      else
+      return result_is_ok;
+    }
+
+    #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+    friend auto serialize(std::uint8_t* first, std::uint8_t* last, const decwide_t& x) -> serialize_result
+    {
+      // Write x in the binary serialization format described
+      // in detail::serialization_format.
+      using local_format = detail::serialization_format;
+
+      if(static_cast<std::size_t>(std::distance(first, last)) < serialized_size())
       {
-        // Remove the trailing decimal point if necessary.
-        if(str.back() == '.')
-        {
-          str.pop_back();
-        }
+        return { last, std::errc::value_too_large };
       }
+
+      local_format::put(first, local_format::offset_magic      (), local_format::magic());
+      local_format::put(first, local_format::offset_version    (), local_format::version());
+      local_format::put(first, local_format::offset_limb_size  (), static_cast<std::uint8_t>(sizeof(limb_type)));
+      local_format::put(first, local_format::offset_sign       (), static_cast<std::uint8_t>(x.my_neg ? UINT8_C(1) : UINT8_C(0)));
+      local_format::put(first, local_format::offset_byte_order (), local_format::byte_order());
+      local_format::put(first, local_format::offset_digits10   (), static_cast<std::int32_t>(ParamDigitsBaseTen));
+      local_format::put(first, local_format::offset_elem_number(), static_cast<std::int32_t>(decwide_t_elem_number));
+      local_format::put(first, local_format::offset_prec_elem  (), static_cast<std::int32_t>(x.my_prec_elem));
+      local_format::put(first, local_format::offset_exponent   (), static_cast<std::int64_t>(x.my_exp));
+
+      std::memcpy(first + local_format::header_size(), x.my_data.data(), static_cast<std::size_t>(static_cast<std::size_t>(decwide_t_elem_number) * sizeof(limb_type))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      return { first + serialized_size(), std::errc() }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
-    static auto special_extend_string_to_precision(std::string& str, // NOLINT(google-runtime-references)
-                                                   std::uint_fast32_t os_precision) -> void
+    friend auto deserialize(const std::uint8_t* first, const std::uint8_t* last, decwide_t& x) -> deserialize_result // NOLINT(google-runtime-references)
     {
-      // This is the special case of showpoint in combination with
-      // a non-fixed, non-scientific representation. The string has
-      // to be zero extended such that the total width of its entire
-      // non-zero part exactly equals the precision.
+      // Read x from the binary serialization format. The data may have
+      // been written by a decwide_t of another precision having the same
+      // limb type. Excess stored limbs are then truncated and missing
+      // limbs are zero. The value of x is only modified on success.
+      using local_format = detail::serialization_format;
 
-      // Check if the input number is less than 1.
-      if(   (str.at(static_cast<std::size_t>(UINT8_C(0))) == '0')
-         && (str.at(static_cast<std::size_t>(UINT8_C(1))) == '.'))
+      const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+      if(count < local_format::header_size())
       {
-        if(str.length() == static_cast<std::uint_fast32_t>(UINT8_C(2)))
-        {
-          // This string represents zero and needs zero extension.
-          str.insert(str.end(), static_cast<std::size_t>(os_precision), '0');
-        }
-        else
-        {
-          // This is a non-zero decimal less than 1 that needs zero extension.
-          const auto it_non_zero =
-            std::find_if(str.cbegin() + static_cast<std::ptrdiff_t>(INT8_C(2)),
-                         str.cend(),
-                         [](const char& c) // NOLINT(modernize-use-trailing-return-type)
-                         {
-                           return (c != '0');
-                         });
+        return { first, std::errc::invalid_argument };
+      }
 
-          const auto len_non_zero_part =
-            static_cast<std::uint_fast32_t>
-            (
-              static_cast<std::size_t>(std::distance(it_non_zero, str.cend()))
-            );
+      const auto stored_elem_number = local_format::get<std::int32_t>(first, local_format::offset_elem_number());
+      const auto stored_prec_elem   = local_format::get<std::int32_t>(first, local_format::offset_prec_elem());
+      const auto stored_exp         = local_format::get<std::int64_t>(first, local_format::offset_exponent());
+      const auto stored_sign        = local_format::get<std::uint8_t>(first, local_format::offset_sign());
 
-          const auto u_pad = static_cast<std::uint_fast32_t>(os_precision - len_non_zero_part);
+      const auto header_is_ok =
+        (
+             (local_format::get<std::uint32_t>(first, local_format::offset_magic())      == local_format::magic())
+          && (local_format::get<std::uint16_t>(first, local_format::offset_version())    == local_format::version())
+          && (local_format::get<std::uint8_t> (first, local_format::offset_limb_size())  == static_cast<std::uint8_t>(sizeof(limb_type)))
+          && (local_format::get<std::uint32_t>(first, local_format::offset_byte_order()) == local_format::byte_order())
+          && (stored_sign        <= static_cast<std::uint8_t>(UINT8_C(1)))
+          && (stored_elem_number > static_cast<std::int32_t>(INT8_C(0)))
+          && (stored_prec_elem   > static_cast<std::int32_t>(INT8_C(0)))
+          && (stored_prec_elem  <= stored_elem_number)
+          && (stored_exp <= static_cast<std::int64_t>(decwide_t_max_exp10))
+          && (stored_exp >= static_cast<std::int64_t>(decwide_t_min_exp10))
+        );
 
-          str.insert(str.end(), static_cast<std::size_t>(u_pad), '0');
-        }
+      const auto stored_size =
+        static_cast<std::size_t>
+        (
+            local_format::header_size()
+          + static_cast<std::size_t>(static_cast<std::size_t>(header_is_ok ? stored_elem_number : INT32_C(0)) * sizeof(limb_type))
+        );
+
+      if((!header_is_ok) || (count < stored_size))
+      {
+        return { first, std::errc::invalid_argument };
       }
-      else
+
+      // Check all of the stored limbs before storing any of them.
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < static_cast<std::size_t>(stored_elem_number); ++i)
       {
-        // This is a number greater than or equal to 1 that needs zero extension.
-        const auto u_pad =
-          static_cast<std::uint_fast32_t>
-          (
-              os_precision
-            - static_cast<std::uint_fast32_t>
-              (
-                static_cast<std::size_t>
-                (
-                  str.length() - static_cast<std::size_t>(UINT8_C(1))
-                )
-              )
-          );
+        const auto limb = local_format::get<limb_type>(first, static_cast<std::size_t>(local_format::header_size() + static_cast<std::size_t>(i * sizeof(limb_type))));
 
-        str.insert(str.end(), static_cast<std::size_t>(u_pad), '0');
+        if(static_cast<elem_mask_type>(limb) >= decwide_t_elem_mask)
+        {
+          return { first, std::errc::invalid_argument };
+        }
       }
-    }
-
-    template<typename char_type, typename traits_type>
-    friend auto operator<<(std::basic_ostream<char_type, traits_type>& os, const decwide_t& f) -> std::basic_ostream<char_type, traits_type>&
-    {
-      std::string str;
 
-      decwide_t::wr_string(f,
-                           str,
-                           os.flags(),
-                           os.precision(),
-                           os.width(),
-                           os.fill());
+      detail::make_representation_unique(x.my_data);
 
-      return (os << str);
-    }
+      const auto elem_number_to_copy = (std::min)(stored_elem_number, static_cast<std::int32_t>(decwide_t_elem_number));
 
-    #if !defined(WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING)
-    template<typename char_type, typename traits_type>
-    friend auto operator>>(std::basic_istream<char_type, traits_type>& is, decwide_t& f) -> std::basic_istream<char_type, traits_type>&
-    {
-      std::string str;
+      std::memcpy(x.my_data.data(), first + local_format::header_size(), static_cast<std::size_t>(static_cast<std::size_t>(elem_number_to_copy) * sizeof(limb_type))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-      static_cast<void>(is >> str);
+      std::fill(x.my_data.begin() + elem_number_to_copy, x.my_data.end(), static_cast<limb_type>(UINT8_C(0)));
 
-      static_cast<void>(f.rd_string(str.c_str()));
+      x.my_exp       = static_cast<exponent_type>(stored_exp);
+      x.my_neg       = (stored_sign != static_cast<std::uint8_t>(UINT8_C(0)));
+      x.my_fpclass   = fpclass_type::decwide_t_finite;
+      x.my_prec_elem = (std::min)(stored_prec_elem, static_cast<std::int32_t>(decwide_t_elem_number));
 
-      return is;
+      return { first + stored_size, std::errc() }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
-    #endif // !WIDE_DECIMAL_DISABLE_CONSTRUCT_FROM_STRING
-
-    #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+    #endif // !WIDE_DECIMAL_DISABLE_SERIALIZATION
 
     friend inline auto fabs(const decwide_t& x) -> decwide_t
     {
@@ -4285,6 +6480,9 @@
 
     template<const ::std::int32_t OtherMyDigits10, typename OtherLimbType, typename OtherAllocatorType, typename OtherInternalFloatType, typename OtherExponentType, typename OtherFftFloatType>
     friend constexpr auto half() -> decwide_t<OtherMyDigits10, OtherLimbType, OtherAllocatorType, OtherInternalFloatType, OtherExponentType, OtherFftFloatType>; // NOLINT(readability-redundant-declaration)
+
+    template<const ::std::int32_t OtherMyDigits10, typename OtherLimbType, typename OtherAllocatorType, typename OtherInternalFloatType, typename OtherExponentType, typename OtherFftFloatType>
+    friend class decwide_vector;
   };
 
   #if ((defined(__GNUC__) && (__GNUC__ >= 12)) && !defined(__clang__))
@@ -4355,8 +6553,8 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_radix;          // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_digits10;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number;    // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask;      // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask_half; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_mask_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask;      // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_mask_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_mask_half; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara; // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> constexpr std::int32_t decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft;  // NOLINT(readability-redundant-declaration,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
@@ -4370,193 +6568,38 @@
   const typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::initializer decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_initializer; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
   #endif
 
+  #if !defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::multiplication_thresholds_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_multiplication_thresholds { { decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara }, { decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft } }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  #endif
+
   #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
   #else
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>((decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara - 1) * 2)>                                                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_school_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr     (static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_fft - 1)) * 8UL))> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kara_mul_pool;   // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(detail::a029750::a029750_as_constexpr     (static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elems_for_kara_pool)) * 8UL))>    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kara_mul_pool;   // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_af_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> std::array<typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::fft_float_type, static_cast<std::size_t>(detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::decwide_t_elem_number)) * 4UL))>       decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_bf_fft_mul_pool; // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> typename decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::representation_type decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_n_data_for_add_sub;                                                                                                                                                                                                                                                                        // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix,cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
   #endif
 
-  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
-  auto decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::wr_string(const decwide_t&   x,               // NOLINT(readability-function-cognitive-complexity)
-                                                                                                                        std::string&       str,             // NOLINT(google-runtime-references)
-                                                                                                                        std::ios::fmtflags ostrm_flags,
-                                                                                                                        std::streamsize    ostrm_precision, // NOLINT(bugprone-easily-swappable-parameters)
-                                                                                                                        std::streamsize    ostrm_width,
-                                                                                                                        char               ostrm_fill) -> void
+  template<const ::std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #else
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #endif
   {
-    using local_flags_type = std::ios::fmtflags;
-
-    // Assess the format flags.
-
-    // Obtain the showpos and uppercase flags.
-    const bool my_showpos   { static_cast<local_flags_type>(ostrm_flags & std::ios::showpos)   == static_cast<local_flags_type>(std::ios::showpos) };
-    const bool my_uppercase { static_cast<local_flags_type>(ostrm_flags & std::ios::uppercase) == static_cast<local_flags_type>(std::ios::uppercase) };
-
-    using std::ilogb;
-
-    // Get the base-10 exponent.
-    auto the_exp = static_cast<exponent_type>(ilogb(x));
-
-    // Determine the kind of output format requested (scientific, fixed, none).
-    detail::os_float_field_type my_float_field { };
-
-    if     (static_cast<local_flags_type>(ostrm_flags & std::ios::scientific) == static_cast<local_flags_type>(std::ios::scientific)) { my_float_field = detail::os_float_field_type::scientific; }
-    else if(static_cast<local_flags_type>(ostrm_flags & std::ios::fixed)      == static_cast<local_flags_type>(std::ios::fixed))      { my_float_field = detail::os_float_field_type::fixed; }
-    else                                                                                                                              { my_float_field = detail::os_float_field_type::none; }
-
-    // Get the output stream's precision and limit it to max_digits10.
-    // Erroneous negative precision (theoretically impossible) will be
-    // set to ostream's default precision. Zero precision will be left
-    // at zero.
-    const auto prec_default = static_cast<std::streamsize>(INT8_C(6));
-
-    std::uint_fast32_t
-      os_precision
-      {
-        static_cast<std::uint_fast32_t>
-        (
-          ((ostrm_precision <= static_cast<std::streamsize>(0))
-            ? ((my_float_field != detail::os_float_field_type::scientific) ? static_cast<std::uint_fast32_t>(prec_default) : static_cast<std::uint_fast32_t>(UINT8_C(0)))
-            : static_cast<std::uint_fast32_t>(ostrm_precision))
-        )
-      };
-
-    bool use_scientific { false };
-    bool use_fixed      { false };
-
-    if     (my_float_field == detail::os_float_field_type::scientific) { use_scientific = true; }
-    else if(my_float_field == detail::os_float_field_type::fixed)      { use_fixed      = true; }
-    else // os_float_field_none
-    {
-      // Set up the range for dynamic detection of scientific notation.
-      // If the exponent is less than -4 or larger than a precision-dependent
-      // positive bound, then scientific notation is used.
-      static const auto neg_bound_for_scientific_neg_exp = static_cast<exponent_type>(INT8_C(-4));
-             const auto min_bound_for_scientific_pos_exp = (std::max)(static_cast<exponent_type>(os_precision), static_cast<exponent_type>(prec_default));
-             const auto pos_bound_for_scientific_pos_exp = (std::min)(static_cast<exponent_type>(decwide_t_digits10), min_bound_for_scientific_pos_exp);
-
-      if(   (the_exp <  neg_bound_for_scientific_neg_exp)
-         || (the_exp >= pos_bound_for_scientific_pos_exp)
-        )
-      {
-        use_scientific = true;
-      }
-      else
-      {
-        use_fixed = true;
-      }
-    }
-
-    // Ascertain the number of digits requested from decwide_t.
-    auto number_of_digits10_i_want = static_cast<std::uint_fast32_t>(UINT8_C(0));
-
-    const auto max10_plus_one =
-      static_cast<std::uint_fast32_t>
-      (
-          static_cast<std::uint_fast32_t>(decwide_t_max_digits10)
-        + static_cast<std::uint_fast32_t>(UINT8_C(1))
-      );
-
-    if(use_scientific)
-    {
-      // The float-field is scientific. The number of digits is given by
-      // (1 + the ostream's precision), not to exceed (max_digits10 + 1).
-      const auto prec_plus_one  =
-        static_cast<std::uint_fast32_t>
-        (
-          static_cast<std::uint_fast32_t>(UINT8_C(1)) + os_precision
-        );
-
-      number_of_digits10_i_want = (std::min)(max10_plus_one, prec_plus_one);
-    }
-
-    if(use_fixed)
-    {
-      // The float-field is scientific. The number of all-digits depends
-      // on the form of the number.
-
-      const auto exp_plus_one                   = static_cast<exponent_type>(the_exp      + static_cast<exponent_type>(INT8_C(1)));
-      const auto exp_plus_one_plus_my_precision = static_cast<exponent_type>(exp_plus_one + static_cast<exponent_type>(os_precision));
-
-      if(the_exp >= static_cast<exponent_type>(INT8_C(0)))
-      {
-        // If the number is larger than 1 in absolute value, then the number of
-        // digits is given by the width of the integer part plus the ostream's
-        // precision, not to exceed (max_digits10 + 1).
-        number_of_digits10_i_want =
-          static_cast<std::uint_fast32_t>
-          (
-            (std::min)(exp_plus_one_plus_my_precision, static_cast<exponent_type>(max10_plus_one))
-          );
-      }
-      else
-      {
-        number_of_digits10_i_want = (std::min)(os_precision, max10_plus_one);
-      }
-    }
-
-    // If the float field is not set, reduce the number of digits requested
-    // from decwide_t such that it neither exceeds the ostream's precision
-    // nor decwide_t's max_digits10.
-    if(my_float_field == detail::os_float_field_type::none)
-    {
-      const auto max_dig10 = (std::min)(os_precision, static_cast<std::uint_fast32_t>(decwide_t_max_digits10));
-
-      number_of_digits10_i_want = (std::min)(number_of_digits10_i_want, max_dig10);
-    }
-
-    // Extract the rounded output string with the desired number of digits.
-    get_output_string(x, str, the_exp, number_of_digits10_i_want);
-
-    // Obtain additional format information.
-    const bool
-      my_showpoint
-      {
-        static_cast<local_flags_type>(ostrm_flags & std::ios::showpoint) == static_cast<local_flags_type>(std::ios::showpoint)
-      };
-
-    // Write the output string in the desired format.
-    if     (my_float_field == detail::os_float_field_type::scientific) { wr_string_scientific(str, the_exp, os_precision, my_showpoint, my_uppercase); }
-    else if(my_float_field == detail::os_float_field_type::fixed)      { wr_string_fixed     (str, the_exp, os_precision, my_showpoint); }
-    else // os_float_field_none
-    {
-      (use_scientific ? wr_string_scientific(str, the_exp, os_precision, my_showpoint, my_uppercase, true)
-                      : wr_string_fixed     (str, the_exp, os_precision, my_showpoint, true));
-    }
-
-    // Append the sign.
-    if     (x.isneg())  { str.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), '-'); }
-    else if(my_showpos) { str.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), '+'); }
-
-    // Handle std::setw(...), std::setfill(...), std::left, std::right, std::internal.
-    const auto my_width =
-      static_cast<std::uint_fast32_t>
-      (
-        (ostrm_width >= static_cast<std::streamsize>(INT8_C(0))) ? static_cast<std::uint_fast32_t>(ostrm_width)
-                                                                 : static_cast<std::uint_fast32_t>(UINT8_C(0))
-      );
-
-    if(my_width > str.length())
-    {
-      // Get the number of fill characters.
-      const auto n_fill = static_cast<std::uint_fast32_t>(my_width - str.length());
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-      // Left-justify is the exception, std::right and std::internal justify right.
-      const bool
-        my_left
-        {
-          static_cast<local_flags_type>(ostrm_flags & std::ios::left) == static_cast<local_flags_type>(std::ios::left)
-        };
+    agm_checkpoint<local_wide_decimal_type> checkpoint { };
 
-      // Justify left or right and insert the fill characters.
-      str.insert((my_left ? str.end() : str.begin()), static_cast<std::size_t>(n_fill), ostrm_fill);
-    }
+    return calc_pi(checkpoint, nullptr, pfn_callback_to_report_digits10);
   }
-  #endif
 
   template<const ::std::int32_t ParamDigitsBaseTen,
            typename LimbType,
@@ -4565,11 +6608,13 @@
            typename ExponentType,
            typename FftFloatType>
   #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
-  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  auto calc_pi(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, const typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type& pfn_callback_checkpoint, const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(google-runtime-references)
   #else
-  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  auto calc_pi(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type pfn_callback_checkpoint, void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(google-runtime-references)
   #endif
   {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("pi");
+
     // Compute pi using a quadratically convergent Gauss AGM.
     // In particular, the Schoenhage variant is used.
 
@@ -4591,23 +6636,28 @@
 
     local_wide_decimal_type val_pi;
 
-    local_wide_decimal_type a(static_cast<unsigned>(UINT8_C(1)));
-
-    // Initialize bB to 0.5.
-    local_wide_decimal_type bB(half<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()); // NOLINT(readability-identifier-naming)
-
-    // Initialize t to 0.375.
-    local_wide_decimal_type
-      t
-      (
-        static_cast<local_wide_decimal_type>
-        (
-          static_cast<unsigned>(UINT8_C(3))
-        )
-        / static_cast<unsigned>(UINT8_C(8))
-      );
+    // The iteration state is kept in the checkpoint. Unless the
+    // checkpoint holds a state of this calculation to resume from,
+    // it is initialized with the starting values.
+    if(!checkpoint.can_resume(agm_checkpoint_kind::pi))
+    {
+      checkpoint.kind      = agm_checkpoint_kind::pi;
+      checkpoint.iteration = static_cast<std::uint32_t>(UINT8_C(0));
+      checkpoint.digits10  = static_cast<std::int32_t>(std::numeric_limits<local_wide_decimal_type>::digits10);
+
+      // Initialize a to 1, bB to 0.5, t to 0.375 and s to 0.5.
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] = one <ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] = half<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(2))] = local_wide_decimal_type(static_cast<unsigned>(UINT8_C(3))) / static_cast<unsigned>(UINT8_C(8));
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(3))] = half<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+    }
 
-    local_wide_decimal_type s(bB);
+    // Iterate on copies, which are only stored back into
+    // the checkpoint after each completed iteration.
+    local_wide_decimal_type a  { checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] };
+    local_wide_decimal_type bB { checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] }; // NOLINT(readability-identifier-naming)
+    local_wide_decimal_type t  { checkpoint.values[static_cast<std::size_t>(UINT8_C(2))] };
+    local_wide_decimal_type s  { checkpoint.values[static_cast<std::size_t>(UINT8_C(3))] };
 
     // This loop is designed for a maximum of several million
     // decimal digits of pi. The index k should reach no higher
@@ -4641,8 +6691,8 @@
         )
       );
 
-    for(auto   k = static_cast<unsigned>(UINT8_C(0));
-               k < static_cast<unsigned>(UINT8_C(48));
+    for(auto   k = static_cast<unsigned>(checkpoint.iteration);
+               k < static_cast<unsigned>(agm_checkpoint<local_wide_decimal_type>::max_iteration(agm_checkpoint_kind::pi));
              ++k)
     {
       using std::sqrt;
@@ -4692,12 +6742,32 @@
 
       if(digits10_of_iteration > digits10_iteration_goal)
       {
+        checkpoint.kind      = agm_checkpoint_kind::none;
+        checkpoint.iteration = static_cast<std::uint32_t>(UINT8_C(0));
+
         break;
       }
 
       t  = val_pi;
       t += bB;
       t /= static_cast<unsigned>(UINT8_C(4));
+
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] = a;
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] = bB;
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(2))] = t;
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(3))] = s;
+
+      checkpoint.iteration = static_cast<std::uint32_t>(k + static_cast<unsigned>(UINT8_C(1)));
+
+      if(pfn_callback_checkpoint != nullptr)
+      {
+        pfn_callback_checkpoint(checkpoint);
+      }
+
+      if(!WIDE_DECIMAL_PROGRESS(pi, digits10_of_iteration, digits10_iteration_goal))
+      {
+        break;
+      }
     }
 
     val_pi += bB;
@@ -4708,6 +6778,8 @@
       pfn_callback_to_report_digits10(static_cast<std::uint32_t>(std::numeric_limits<local_wide_decimal_type>::digits10)); // LCOV_EXCL_LINE
     }
 
+    // A cancelled calculation returns the value of its last iterate
+    // and leaves its checkpoint to be resumed.
     return val_pi;
   }
 
@@ -4792,9 +6864,42 @@
            typename ExponentType,
            typename FftFloatType>
   #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
-  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #else
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  #endif
+  {
+    // N[Pi, 121]
+    // 3.141592653589793238462643383279502884197169399375105820974944592307816406286208998628034825342117067982148086513282306647
+
+    static_cast<void>(pfn_callback_to_report_digits10);
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT32_C(       3)),
+          static_cast<local_limb_type>(UINT32_C(14159265)), static_cast<local_limb_type>(UINT32_C(35897932)),
+          static_cast<local_limb_type>(UINT32_C(38462643)), static_cast<local_limb_type>(UINT32_C(38327950)),
+          static_cast<local_limb_type>(UINT32_C(28841971)), static_cast<local_limb_type>(UINT32_C(69399375)),
+          static_cast<local_limb_type>(UINT32_C(10582097)), static_cast<local_limb_type>(UINT32_C(49445923)),
+          static_cast<local_limb_type>(UINT32_C( 7816406)), static_cast<local_limb_type>(UINT32_C(28620899)),
+          static_cast<local_limb_type>(UINT32_C(86280348)), static_cast<local_limb_type>(UINT32_C(25342117))
+        }
+      );
+  }
+
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_pi(const std::function<void(const std::uint32_t)>& pfn_callback_to_report_digits10) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   #else
-  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint32_t>::value), decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  auto calc_pi(void(*pfn_callback_to_report_digits10)(const std::uint32_t)) -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   #endif
   {
     // N[Pi, 121]
@@ -4803,7 +6908,7 @@
     static_cast<void>(pfn_callback_to_report_digits10);
 
     using local_wide_decimal_type =
-      decwide_t<ParamDigitsBaseTen, std::uint32_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
     using local_limb_type = typename local_wide_decimal_type::limb_type;
 
@@ -4811,29 +6916,41 @@
       local_wide_decimal_type::from_lst
       (
         {
-          static_cast<local_limb_type>(UINT32_C(       3)),
-          static_cast<local_limb_type>(UINT32_C(14159265)), static_cast<local_limb_type>(UINT32_C(35897932)),
-          static_cast<local_limb_type>(UINT32_C(38462643)), static_cast<local_limb_type>(UINT32_C(38327950)),
-          static_cast<local_limb_type>(UINT32_C(28841971)), static_cast<local_limb_type>(UINT32_C(69399375)),
-          static_cast<local_limb_type>(UINT32_C(10582097)), static_cast<local_limb_type>(UINT32_C(49445923)),
-          static_cast<local_limb_type>(UINT32_C( 7816406)), static_cast<local_limb_type>(UINT32_C(28620899)),
-          static_cast<local_limb_type>(UINT32_C(86280348)), static_cast<local_limb_type>(UINT32_C(25342117))
+          static_cast<local_limb_type>(UINT64_C(                 3)),
+          static_cast<local_limb_type>(UINT64_C(141592653589793238)), static_cast<local_limb_type>(UINT64_C(462643383279502884)),
+          static_cast<local_limb_type>(UINT64_C(197169399375105820)), static_cast<local_limb_type>(UINT64_C(974944592307816406)),
+          static_cast<local_limb_type>(UINT64_C(286208998628034825)), static_cast<local_limb_type>(UINT64_C(342117067982148086))
         }
       );
   }
+  #endif
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto calc_ln_two() -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
+    agm_checkpoint<local_wide_decimal_type> checkpoint { };
+
+    return calc_ln_two(checkpoint, nullptr);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  auto calc_ln_two(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, const typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type& pfn_callback_checkpoint) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(google-runtime-references)
+  #else
+  auto calc_ln_two(agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>& checkpoint, typename agm_checkpoint<decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::callback_type pfn_callback_checkpoint) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(google-runtime-references)
+  #endif
+  {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("ln_two");
+
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
     // Use an AGM method to compute log(2).
 
     // Set a0 = 1
     // Set b0 = 1 / (2^(m-2))
 
-    local_wide_decimal_type ak(static_cast<unsigned>(UINT8_C(1)));
-
     constexpr auto n_times_factor =
       static_cast<float>
       (
@@ -4849,8 +6966,23 @@
         static_cast<std::int32_t>(3)
       );
 
-    local_wide_decimal_type bk =
-      ldexp(one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(), static_cast<std::int32_t>(2 - m));
+    // The iteration state is kept in the checkpoint. Unless the
+    // checkpoint holds a state of this calculation to resume from,
+    // it is initialized with the starting values.
+    if(!checkpoint.can_resume(agm_checkpoint_kind::ln_two))
+    {
+      checkpoint.kind      = agm_checkpoint_kind::ln_two;
+      checkpoint.iteration = static_cast<std::uint32_t>(UINT8_C(0));
+      checkpoint.digits10  = static_cast<std::int32_t>(std::numeric_limits<local_wide_decimal_type>::digits10);
+
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] = one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>();
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] = ldexp(one<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(), static_cast<std::int32_t>(2 - m));
+    }
+
+    // Iterate on copies, which are only stored back into
+    // the checkpoint after each completed iteration.
+    local_wide_decimal_type ak { checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] };
+    local_wide_decimal_type bk { checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] };
 
     const auto digits10_iteration_goal =
       static_cast<std::uint32_t>
@@ -4879,8 +7011,8 @@
         )
       );
 
-    for(auto   k = static_cast<std::uint32_t>(UINT8_C(0));
-               k < static_cast<std::uint32_t>(UINT8_C(128));
+    for(auto   k = checkpoint.iteration;
+               k < agm_checkpoint<local_wide_decimal_type>::max_iteration(agm_checkpoint_kind::ln_two);
              ++k)
     {
       using std::ilogb;
@@ -4906,6 +7038,9 @@
 
       if(digits10_of_iteration > digits10_iteration_goal)
       {
+        checkpoint.kind      = agm_checkpoint_kind::none;
+        checkpoint.iteration = static_cast<std::uint32_t>(UINT8_C(0));
+
         break;
       }
 
@@ -4914,12 +7049,29 @@
       ak /= static_cast<unsigned>(UINT8_C(2));
       bk *= ak_tmp;
       bk  = sqrt(bk);
+
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(0))] = ak;
+      checkpoint.values[static_cast<std::size_t>(UINT8_C(1))] = bk;
+
+      checkpoint.iteration = static_cast<std::uint32_t>(k + static_cast<std::uint32_t>(UINT8_C(1)));
+
+      if(pfn_callback_checkpoint != nullptr)
+      {
+        pfn_callback_checkpoint(checkpoint);
+      }
+
+      if(!WIDE_DECIMAL_PROGRESS(ln_two, digits10_of_iteration, digits10_iteration_goal))
+      {
+        break;
+      }
     }
 
     // We are now finished with the AGM iteration for log(2).
     // Note at this time that (ak = bk) = AGM(...)
     // Retrieve the value of pi and divide by (a * (2 * m)).
 
+    // A cancelled calculation returns the value of its last iterate
+    // and leaves its checkpoint to be resumed.
     return
       (
           pi<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>()
@@ -4928,6 +7080,102 @@
       / m;
   }
 
+  #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+  template<typename WideDecimalType>
+  auto serialize(std::uint8_t* first, std::uint8_t* last, const agm_checkpoint<WideDecimalType>& checkpoint) -> serialize_result
+  {
+    // The layout of the header is described at
+    // detail::checkpoint_serialization_format.
+    using local_checkpoint_type = agm_checkpoint<WideDecimalType>;
+
+    using local_format      = detail::serialization_format;
+    using local_ckpt_format = detail::checkpoint_serialization_format;
+
+    if(static_cast<std::size_t>(std::distance(first, last)) < local_checkpoint_type::serialized_size())
+    {
+      return { last, std::errc::value_too_large };
+    }
+
+    std::fill(first, first + local_ckpt_format::header_size(), static_cast<std::uint8_t>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    local_format::put(first, local_ckpt_format::offset_magic(),       local_ckpt_format::magic());
+    local_format::put(first, local_ckpt_format::offset_version(),     local_ckpt_format::version());
+    local_format::put(first, local_ckpt_format::offset_kind(),        static_cast<std::uint8_t>(checkpoint.kind));
+    local_format::put(first, local_ckpt_format::offset_value_count(), static_cast<std::uint8_t>(checkpoint.values.size()));
+    local_format::put(first, local_ckpt_format::offset_byte_order(),  local_format::byte_order());
+    local_format::put(first, local_ckpt_format::offset_iteration(),   checkpoint.iteration);
+    local_format::put(first, local_ckpt_format::offset_digits10(),    checkpoint.digits10);
+
+    serialize_result result { first + local_ckpt_format::header_size(), std::errc() }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(const auto& value : checkpoint.values)
+    {
+      result = serialize(result.ptr, last, value);
+    }
+
+    return result;
+  }
+
+  template<typename WideDecimalType>
+  auto deserialize(const std::uint8_t* first, const std::uint8_t* last, agm_checkpoint<WideDecimalType>& checkpoint) -> deserialize_result // NOLINT(google-runtime-references)
+  {
+    using local_checkpoint_type = agm_checkpoint<WideDecimalType>;
+
+    using local_format      = detail::serialization_format;
+    using local_ckpt_format = detail::checkpoint_serialization_format;
+
+    if(   (static_cast<std::size_t>(std::distance(first, last)) < local_ckpt_format::header_size())
+       || (local_format::get<std::uint32_t>(first, local_ckpt_format::offset_magic())       != local_ckpt_format::magic())
+       || (local_format::get<std::uint16_t>(first, local_ckpt_format::offset_version())     != local_ckpt_format::version())
+       || (local_format::get<std::uint32_t>(first, local_ckpt_format::offset_byte_order())  != local_format::byte_order())
+       || (local_format::get<std::uint8_t> (first, local_ckpt_format::offset_value_count()) != static_cast<std::uint8_t>(checkpoint.values.size())))
+    {
+      return { first, std::errc::invalid_argument };
+    }
+
+    // Read into a temporary so that the checkpoint is only modified on success.
+    local_checkpoint_type checkpoint_tmp { };
+
+    checkpoint_tmp.kind      = static_cast<agm_checkpoint_kind>(local_format::get<std::uint8_t>(first, local_ckpt_format::offset_kind()));
+    checkpoint_tmp.iteration = local_format::get<std::uint32_t>(first, local_ckpt_format::offset_iteration());
+    checkpoint_tmp.digits10  = local_format::get<std::int32_t> (first, local_ckpt_format::offset_digits10());
+
+    // Only the state of a known, unfinished calculation can be read.
+    // A finished checkpoint (of the kind none) has iteration zero.
+    const auto state_is_ok =
+      (
+           (   (checkpoint_tmp.kind == agm_checkpoint_kind::none)
+            && (checkpoint_tmp.iteration == static_cast<std::uint32_t>(UINT8_C(0))))
+        || (   ((checkpoint_tmp.kind == agm_checkpoint_kind::pi) || (checkpoint_tmp.kind == agm_checkpoint_kind::ln_two))
+            && (checkpoint_tmp.iteration < local_checkpoint_type::max_iteration(checkpoint_tmp.kind)))
+      );
+
+    if(!state_is_ok)
+    {
+      return { first, std::errc::invalid_argument };
+    }
+
+    deserialize_result result { first + local_ckpt_format::header_size(), std::errc() }; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    for(auto& value : checkpoint_tmp.values)
+    {
+      if(result.ec == std::errc())
+      {
+        result = deserialize(result.ptr, last, value);
+      }
+    }
+
+    if(result.ec != std::errc())
+    {
+      return { first, result.ec };
+    }
+
+    checkpoint = checkpoint_tmp;
+
+    return result;
+  }
+  #endif // !WIDE_DECIMAL_DISABLE_SERIALIZATION
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint8_t>::value), decwide_t<ParamDigitsBaseTen, std::uint8_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
@@ -5009,6 +7257,32 @@
       );
   }
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto calc_ln_two() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    // N[Log[2], 121]
+    // 0.6931471805599453094172321214581765680755001343602552541206800094933936219696947156058633269964186875420014810205706857337
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT64_C(693147180559945309)),
+          static_cast<local_limb_type>(UINT64_C(417232121458176568)), static_cast<local_limb_type>(UINT64_C( 75500134360255254)),
+          static_cast<local_limb_type>(UINT64_C(120680009493393621)), static_cast<local_limb_type>(UINT64_C(969694715605863326)),
+          static_cast<local_limb_type>(UINT64_C(996418687542001481))
+        },
+        static_cast<typename local_wide_decimal_type::exponent_type>(INT8_C(-18))
+      );
+  }
+  #endif
+
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint8_t>::value), decwide_t<ParamDigitsBaseTen, std::uint8_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
@@ -5087,6 +7361,31 @@
       );
   }
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
+  auto calc_ln_ten_low_precision() -> typename std::enable_if<((ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))) && std::is_same<LimbType, std::uint64_t>::value), decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    // N[Log[10], 121]
+    // 2.302585092994045684017991454684364207601101488628772976033327900967572609677352480235997205089598298341967784042286248633
+
+    using local_wide_decimal_type =
+      decwide_t<ParamDigitsBaseTen, std::uint64_t, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    using local_limb_type = typename local_wide_decimal_type::limb_type;
+
+    return
+      local_wide_decimal_type::from_lst
+      (
+        {
+          static_cast<local_limb_type>(UINT64_C(                 2)),
+          static_cast<local_limb_type>(UINT64_C(302585092994045684)), static_cast<local_limb_type>(UINT64_C( 17991454684364207)),
+          static_cast<local_limb_type>(UINT64_C(601101488628772976)), static_cast<local_limb_type>(UINT64_C( 33327900967572609)),
+          static_cast<local_limb_type>(UINT64_C(677352480235997205)), static_cast<local_limb_type>(UINT64_C( 89598298341967784))
+        }
+      );
+  }
+  #endif
+
   #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
@@ -5132,10 +7431,16 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator-(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& self) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; local_wide_decimal_type result { self }; result.negate(); return result; }
 
   // Global add/sub/mul/div of const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& with const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&.
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator+(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) += v; }
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator-(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) -= v; }
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator*(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) *= v; }
-  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator/(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) /= v; }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator+(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) + v; }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator-(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) - v; }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator*(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) * v; }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>auto operator/(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; return local_wide_decimal_type(u) / v; }
+
+  // Global add/sub/mul/div of decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& with const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&.
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; u += v; return static_cast<local_wide_decimal_type&&>(u); }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; u -= v; return static_cast<local_wide_decimal_type&&>(u); }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; u *= v; return static_cast<local_wide_decimal_type&&>(u); }
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType> auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u, const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& v) -> decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType> { using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>; u /= v; return static_cast<local_wide_decimal_type&&>(u); }
 
   // Global add/sub/mul/div of const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& with all built-in types.
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
@@ -5146,7 +7451,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).add_signed_long_long(n);
+    return local_wide_decimal_type(u) + n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5157,7 +7462,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).add_unsigned_long_long(n);
+    return local_wide_decimal_type(u) + n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
@@ -5167,7 +7472,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u) += decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(f);
+    return local_wide_decimal_type(u) + f;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
@@ -5178,7 +7483,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).sub_signed_long_long(n);
+    return local_wide_decimal_type(u) - n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5189,7 +7494,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).sub_unsigned_long_long(n);
+    return local_wide_decimal_type(u) - n;
   }
 
   // LCOV_EXCL_START
@@ -5200,7 +7505,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u) -= decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(f);
+    return local_wide_decimal_type(u) - f;
   }
   // LCOV_EXCL_STOP
 
@@ -5212,7 +7517,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).mul_signed_long_long(n);
+    return local_wide_decimal_type(u) * n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5223,7 +7528,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).mul_unsigned_long_long(n);
+    return local_wide_decimal_type(u) * n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
@@ -5233,7 +7538,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u) *= decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(f);
+    return local_wide_decimal_type(u) * f;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
@@ -5244,7 +7549,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).div_signed_long_long(n);
+    return local_wide_decimal_type(u) / n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5255,7 +7560,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).div_unsigned_long_long(n);
+    return local_wide_decimal_type(u) / n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
@@ -5265,7 +7570,162 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u) /= decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>(f);
+    return local_wide_decimal_type(u) / f;
+  }
+
+  // Global add/sub/mul/div of decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& with all built-in types.
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.add_signed_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.add_unsigned_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator+(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u += local_wide_decimal_type(f);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.sub_signed_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.sub_unsigned_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  // LCOV_EXCL_START
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator-(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u -= local_wide_decimal_type(f);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+  // LCOV_EXCL_STOP
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<   std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.mul_signed_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.mul_unsigned_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator*(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u *= local_wide_decimal_type(f);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
+                                                                  && (!std::is_unsigned<SignedIntegralType>::value),
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.div_signed_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
+                                                                    && std::is_unsigned<UnsignedIntegralType>::value,
+                                                                    decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u.div_unsigned_long_long(n);
+
+    return static_cast<local_wide_decimal_type&&>(u);
+  }
+
+  template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
+  auto operator/(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&& u,
+                 FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
+                                                                 decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+  {
+    using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+
+    u /= local_wide_decimal_type(f);
+
+    return static_cast<local_wide_decimal_type&&>(u);
   }
 
   // Global add/sub/mul/div of all built-in types with const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&.
@@ -5277,7 +7737,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).add_signed_long_long(n);
+    return local_wide_decimal_type(u) + n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5288,7 +7748,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).add_unsigned_long_long(n);
+    return local_wide_decimal_type(u) + n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
@@ -5298,7 +7758,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(f) += u;
+    return local_wide_decimal_type(f) + u;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename ArithmeticType>
@@ -5308,7 +7768,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(n) -= u;
+    return local_wide_decimal_type(n) - u;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename SignedIntegralType>
@@ -5319,7 +7779,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).mul_signed_long_long(n);
+    return local_wide_decimal_type(u) * n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename UnsignedIntegralType>
@@ -5330,7 +7790,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(u).mul_unsigned_long_long(n);
+    return local_wide_decimal_type(u) * n;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
@@ -5340,7 +7800,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(f) *= u;
+    return local_wide_decimal_type(f) * u;
   }
 
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename ArithmeticType>
@@ -5350,7 +7810,7 @@
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
-    return local_wide_decimal_type(n) /= u;
+    return local_wide_decimal_type(n) / u;
   }
 
   // Global self add/sub/mul/div of decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& with all built-in types.
@@ -5358,7 +7818,7 @@
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.add_signed_long_long(n);
   }
@@ -5368,7 +7828,7 @@
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.add_unsigned_long_long(n);
   }
@@ -5376,7 +7836,7 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator+=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
@@ -5387,7 +7847,7 @@
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.sub_signed_long_long(n);
   }
@@ -5396,7 +7856,7 @@
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.sub_unsigned_long_long(n);
   }
@@ -5404,7 +7864,7 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator-=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
@@ -5415,7 +7875,7 @@
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<     std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.mul_signed_long_long(n);
   }
@@ -5424,7 +7884,7 @@
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.mul_unsigned_long_long(n);
   }
@@ -5432,7 +7892,7 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator*=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
@@ -5444,7 +7904,7 @@
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   SignedIntegralType n) -> typename std::enable_if<   std::is_integral<SignedIntegralType>::value
                                                                    && (!std::is_unsigned<SignedIntegralType>::value),
-                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                   decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.div_signed_long_long(n);
   }
@@ -5453,7 +7913,7 @@
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   UnsignedIntegralType n) -> typename std::enable_if<   std::is_integral<UnsignedIntegralType>::value
                                                                      && std::is_unsigned<UnsignedIntegralType>::value,
-                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                     decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     return u.div_unsigned_long_long(n);
   }
@@ -5461,7 +7921,7 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType, typename FloatingPointType>
   auto operator/=(decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& u,
                   FloatingPointType f) -> typename std::enable_if<std::is_floating_point<FloatingPointType>::value,
-                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
+                                                                  decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>&>::type
   {
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
@@ -5757,6 +8217,8 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto log(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(misc-no-recursion)
   {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("log");
+
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
     local_wide_decimal_type result { };
@@ -5891,6 +8353,11 @@
         bk *= ak_tmp;
 
         static_cast<void>(bk.calculate_sqrt());
+
+        if(!WIDE_DECIMAL_PROGRESS(log, digits10_of_iteration, digits10_iteration_goal))
+        {
+          break;
+        }
       }
 
       // We are now finished with the AGM iteration for log(x).
@@ -5913,6 +8380,8 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto log(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen <= static_cast<std::int32_t>(INT8_C(51))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type // NOLINT(misc-no-recursion)
   {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("log");
+
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
     local_wide_decimal_type result { };
@@ -6027,6 +8496,8 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto exp(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen > static_cast<std::int32_t>(INT32_C(2000))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("exp");
+
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
     const auto b_neg = x.isneg();
@@ -6069,6 +8540,11 @@
                digits  < precision_of_x; // NOLINT(altera-id-dependent-backward-branch)
                digits *= static_cast<std::int32_t>(INT8_C(2)))
       {
+        if(!WIDE_DECIMAL_PROGRESS(exp, digits, precision_of_x))
+        {
+          break;
+        }
+
         // Adjust precision of the terms.
         const auto min_elem_digits10_plus_one =
           (std::min)
@@ -6123,6 +8599,8 @@
   template<const ::std::int32_t ParamDigitsBaseTen, typename LimbType, typename AllocatorType, typename InternalFloatType, typename ExponentType, typename FftFloatType>
   auto exp(const decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>& x) -> typename std::enable_if<(ParamDigitsBaseTen <= static_cast<std::int32_t>(INT32_C(2000))), decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>>::type
   {
+    const detail::operation_allocation_scope<AllocatorType> allocation_scope("exp");
+
     using local_wide_decimal_type = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
 
     const auto b_neg = x.isneg();
@@ -20,11 +20,20 @@
 
   #include <algorithm>
   #include <array>
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  #include <atomic>
+  #endif
   #include <cmath>
   #include <cstdint>
+  #include <cstring>
   #include <initializer_list>
+  #include <iterator>
   #include <limits>
   #include <memory>
+  #if (!defined(WIDE_DECIMAL_DISABLE_CHARCONV) || !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION))
+  #include <system_error>
+  #endif
+  #include <type_traits>
 
   #if defined(_MSC_VER)
     #if (_MSC_VER >= 1900) && defined(_HAS_CXX20) && (_HAS_CXX20 != 0)
@@ -60,6 +69,37 @@
     #endif
   #endif
 
+  #if !defined(WIDE_DECIMAL_DISABLE_MEMORY_RESOURCE)
+    #if ((defined(__cplusplus) && (__cplusplus >= 201703L)) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))) && defined(__has_include)
+      #if __has_include(<memory_resource>)
+        #include <memory_resource>
+        #if defined(__cpp_lib_memory_resource)
+          #define WIDE_DECIMAL_HAS_MEMORY_RESOURCE // NOLINT(cppcoreguidelines-macro-usage)
+        #endif
+      #endif
+    #endif
+  #endif
+
+  // Limbs of type std::uint64_t (base 10^18) need a 128-bit
+  // double-limb type. They are supported by compilers that provide
+  // unsigned __int128, unless WIDE_DECIMAL_DISABLE_UINT64_LIMB is defined.
+  #if (defined(__SIZEOF_INT128__) && !defined(WIDE_DECIMAL_DISABLE_UINT64_LIMB))
+    #define WIDE_DECIMAL_HAS_UINT64_LIMB // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #include <math/wide_decimal/decwide_t_detail_instrumentation.h>
+  #include <math/wide_decimal/decwide_t_detail_progress.h>
+
+  namespace util {
+
+  // Forward declaration of the tracking_allocator template
+  // (see util/memory/util_tracking_allocator.h).
+  template<typename T,
+           typename BaseAllocatorType>
+  class tracking_allocator;
+
+  } // namespace util
+
   WIDE_DECIMAL_NAMESPACE_BEGIN
 
   #if(__cplusplus >= 201703L)
@@ -77,6 +117,93 @@
            typename FftFloatType      = double>
   class decwide_t;
 
+  // Forward declaration of the decwide_vector template class.
+  template<const std::int32_t ParamDigitsBaseTen,
+           typename LimbType          = std::uint32_t,
+           typename AllocatorType     = std::allocator<void>,
+           typename InternalFloatType = double,
+           typename ExponentType      = std::int64_t,
+           typename FftFloatType      = double>
+  class decwide_vector;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  // Use shared_representation<AllocatorType> as the allocator parameter
+  // of decwide_t in order to obtain reference-counted, copy-on-write limbs.
+  // Copies of such a decwide_t share a single mantissa, which is cloned
+  // only when one of the copies is modified. This is intended for
+  // large, read-mostly values such as cached constants.
+  template<typename AllocatorType = std::allocator<void>>
+  struct shared_representation
+  {
+    using allocator_type = AllocatorType;
+  };
+  #endif
+
+  // Floating-point formats of to_chars() and write_digits(), in
+  // the sense of std::chars_format (which needs C++17).
+  enum class chars_format // NOLINT(performance-enum-size)
+  {
+    scientific,
+    fixed,
+    general
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+
+  struct to_chars_result
+  {
+    char*     ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct from_chars_result
+  {
+    const char* ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc   ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // The batch conversions of a column of values also
+  // report the number of values that have been converted.
+  struct to_chars_batch_result
+  {
+    char*       ptr;   // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t count; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc   ec;    // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct from_chars_batch_result
+  {
+    const char* ptr;   // NOLINT(misc-non-private-member-variables-in-classes)
+    std::size_t count; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc   ec;    // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+  #endif // !WIDE_DECIMAL_DISABLE_CHARCONV
+
+  // Optional grouping of the digits after the decimal point for
+  // write_digits(). For instance, digits_per_group = 10 and
+  // groups_per_line = 10 produce the familiar 100-digit lines
+  // of 10-digit columns. A zero value disables the grouping.
+  struct digit_grouping
+  {
+    std::uint32_t digits_per_group { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint32_t groups_per_line  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    char          separator        { ' ' }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+  struct serialize_result
+  {
+    std::uint8_t* ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc     ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct deserialize_result
+  {
+    const std::uint8_t* ptr; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::errc           ec;  // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+  #endif // !WIDE_DECIMAL_DISABLE_SERIALIZATION
+
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_decimal
   #else
@@ -131,67 +258,22 @@
       }
 
       using std::frexp;
+      using std::ldexp;
 
-      // Get the fraction and base-2 exponent.
+      // Get the fraction and base-2 exponent. The fraction lies in
+      // the range [0.5, 1), so scaling it by 2^digits results in the
+      // integral mantissa (with its most significant bit set) exactly.
 
       // TBD: Need to properly handle frexp when GCC's __float128
       // is active (in case of -std=gnu++XX).
       // This happens when native_float_type is of type __float128.
 
-      auto man = static_cast<native_float_type>(frexp(static_cast<long double>(f), &my_exponent_part));
-
-      auto n2 = static_cast<unsigned>(UINT8_C(0));
-
-      for(auto   i = static_cast<std::uint_fast16_t>(UINT8_C(0));
-                  i < static_cast<std::uint_fast16_t>(std::numeric_limits<native_float_type>::digits);
-                ++i)
-      {
-        // Extract the mantissa of the floating-point type in base-2
-        // (one bit at a time) and store it in a std::uintmax_t.
-
-        man *= 2;
-
-        n2   = static_cast<unsigned>(man);
-        man -= static_cast<native_float_type>(n2);
-
-        if(n2 != static_cast<unsigned>(UINT8_C(0)))
-        {
-          my_mantissa_part |= static_cast<unsigned>(UINT8_C(1));
-        }
-
-        if(i < static_cast<unsigned>(std::numeric_limits<native_float_type>::digits - 1))
-        {
-          my_mantissa_part <<= static_cast<unsigned>(UINT8_C(1));
-        }
-      }
-
-      // Ensure that the value is normalized and adjust the exponent.
-
-      // TBD: Need to properly handle this left shift amount
-      // when GCC's __float128 is active (in case of -std=gnu++XX).
-      // This happens when native_float_type is of type __float128.
-
       static_assert(std::numeric_limits<native_float_type>::digits <= std::numeric_limits<long double>::digits,
                     "Error: The instantiated native float type does not fit in long double");
 
-      constexpr auto max_left_shift_amount =
-        static_cast<int>
-        (
-          (std::numeric_limits<native_float_type>::digits < std::numeric_limits<long double>::digits)
-            ? std::numeric_limits<native_float_type>::digits
-            : std::numeric_limits<long double>::digits
-        );
-
-      #if (defined(__GNUC__) && !defined(__clang__))
-      #pragma GCC diagnostic push
-      #pragma GCC diagnostic ignored "-Wshift-count-overflow"
-      #endif
-
-      my_mantissa_part |= static_cast<std::uintmax_t>(UINTMAX_C(1) << static_cast<unsigned>(max_left_shift_amount - 1));
+      const auto man = frexp(static_cast<long double>(ff), &my_exponent_part);
 
-      #if (defined(__GNUC__) && !defined(__clang__))
-      #pragma GCC diagnostic pop
-      #endif
+      my_mantissa_part = static_cast<std::uintmax_t>(ldexp(man, std::numeric_limits<native_float_type>::digits));
 
       my_exponent_part -= 1;
     }
@@ -230,6 +312,45 @@
     int            my_exponent_part { }; // NOLINT(readability-identifier-naming)
   };
 
+  constexpr auto binary_float_bit_width(const unsigned u) -> std::size_t
+  {
+    return ((u == 0U) ? static_cast<std::size_t>(UINT8_C(0)) : static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) + binary_float_bit_width(u >> 1U)));
+  }
+
+  // The power base^n of a small base, and the largest n
+  // for which base^n stays below the given limit.
+  constexpr auto small_power(const std::uint64_t base, const unsigned n) -> std::uint64_t
+  {
+    return ((n == 0U) ? static_cast<std::uint64_t>(UINT8_C(1)) : static_cast<std::uint64_t>(base * small_power(base, n - 1U)));
+  }
+
+  constexpr auto small_power_count_below(const std::uint64_t base, const std::uint64_t limit, const std::uint64_t power = static_cast<std::uint64_t>(UINT8_C(1))) -> unsigned
+  {
+    return (((power * base) < limit) ? static_cast<unsigned>(1U + small_power_count_below(base, limit, static_cast<std::uint64_t>(power * base))) : 0U);
+  }
+
+  template<typename WideDecimalType,
+           typename FloatingPointType>
+  struct binary_float_scale_table
+  {
+    // Tabulate the powers 2^(2^j) and 5^(2^j) that scale the integral
+    // mantissa of a normalized FloatingPointType by its binary exponent.
+    // A negative binary exponent -k is handled with 2^-k = 5^k * 10^-k.
+
+    static constexpr auto pow2_levels() -> std::size_t
+    {
+      return binary_float_bit_width(static_cast<unsigned>(std::numeric_limits<FloatingPointType>::max_exponent));
+    }
+
+    static constexpr auto pow5_levels() -> std::size_t
+    {
+      return binary_float_bit_width(static_cast<unsigned>(std::numeric_limits<FloatingPointType>::digits - std::numeric_limits<FloatingPointType>::min_exponent + 2));
+    }
+
+    std::array<WideDecimalType, pow2_levels()> pow2 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<WideDecimalType, pow5_levels()> pow5 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
   template<const std::size_t BitCount,
            typename EnableType = void>
   struct uint_type_helper
@@ -367,39 +488,49 @@
   };
 
   // LCOV_EXCL_START
-  constexpr auto pow10_maker(std::uint32_t n) noexcept -> std::uint32_t // NOLINT(misc-no-recursion)
+  constexpr auto pow10_maker(std::uint32_t n) noexcept -> std::uint64_t // NOLINT(misc-no-recursion)
   {
     // Make the constant power of 10^n.
     return
-      static_cast<std::uint32_t>
+      static_cast<std::uint64_t>
       (
         (n == static_cast<std::uint32_t>(UINT8_C(0)))
-          ? static_cast<std::uint32_t>(UINT8_C(1))
-          : static_cast<std::uint32_t>
+          ? static_cast<std::uint64_t>(UINT8_C(1))
+          : static_cast<std::uint64_t>
             (
                 pow10_maker(static_cast<std::uint32_t>(n - static_cast<std::uint32_t>(UINT8_C(1))))
-              * static_cast<std::uint32_t>(UINT8_C(10))
+              * static_cast<std::uint64_t>(UINT8_C(10))
             )
       );
   }
   // LCOV_EXCL_STOP
 
-  inline auto pow10_maker_as_runtime_value(std::uint32_t n) noexcept -> std::uint32_t
+  inline auto pow10_maker_as_runtime_value(std::uint32_t n) noexcept -> std::uint64_t
   {
-    using local_array_type = std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(10))>; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    using local_array_type = std::array<std::uint64_t, static_cast<std::size_t>(UINT8_C(20))>; // NOLINT(,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
     constexpr local_array_type local_p10_table =
     {{
-      static_cast<std::uint32_t>(UINT32_C(1)),
-      static_cast<std::uint32_t>(UINT32_C(10)),
-      static_cast<std::uint32_t>(UINT32_C(100)),
-      static_cast<std::uint32_t>(UINT32_C(1000)),
-      static_cast<std::uint32_t>(UINT32_C(10000)),
-      static_cast<std::uint32_t>(UINT32_C(100000)),
-      static_cast<std::uint32_t>(UINT32_C(1000000)),
-      static_cast<std::uint32_t>(UINT32_C(10000000)),
-      static_cast<std::uint32_t>(UINT32_C(100000000)),
-      static_cast<std::uint32_t>(UINT32_C(1000000000))
+      static_cast<std::uint64_t>(UINT64_C(1)),
+      static_cast<std::uint64_t>(UINT64_C(10)),
+      static_cast<std::uint64_t>(UINT64_C(100)),
+      static_cast<std::uint64_t>(UINT64_C(1000)),
+      static_cast<std::uint64_t>(UINT64_C(10000)),
+      static_cast<std::uint64_t>(UINT64_C(100000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(100000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(1000000000000000000)),
+      static_cast<std::uint64_t>(UINT64_C(10000000000000000000))
     }};
 
     {
@@ -454,6 +585,11 @@
     return expval;
   }
 
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  // The double-limb type of std::uint64_t limbs.
+  __extension__ typedef unsigned __int128 uint128_type; // NOLINT(modernize-use-using,google-runtime-int)
+  #endif
+
   template<typename LimbType>
   struct decwide_t_helper_base
   {
@@ -462,13 +598,38 @@
 
   public:
     static constexpr std::int32_t elem_digits10 =
-      (std::is_same<local_limb_type, std::uint32_t>::value
-        ? static_cast<std::int32_t>(INT8_C(8))
-        : (std::is_same<local_limb_type, std::uint16_t>::value ? static_cast<std::int32_t>(INT8_C(4))
-                                                               : static_cast<std::int32_t>(INT8_C(2))));
+      (std::is_same<local_limb_type, std::uint64_t>::value
+        ? static_cast<std::int32_t>(INT8_C(18))
+        : (std::is_same<local_limb_type, std::uint32_t>::value
+            ? static_cast<std::int32_t>(INT8_C(8))
+            : (std::is_same<local_limb_type, std::uint16_t>::value ? static_cast<std::int32_t>(INT8_C(4))
+                                                                   : static_cast<std::int32_t>(INT8_C(2)))));
+
+    // The limb base 10^18 of std::uint64_t limbs needs a 64-bit mask.
+    using elem_mask_type =
+      typename std::conditional<std::is_same<local_limb_type, std::uint64_t>::value, std::int64_t, std::int32_t>::type;
+
+    // The unsigned type that holds the product of two limbs.
+    #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+    using double_limb_type =
+      typename std::conditional<std::is_same<local_limb_type, std::uint64_t>::value,
+                                uint128_type,
+                                typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
+                                                          std::uint64_t,
+                                                          typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
+                                                                                    std::uint32_t,
+                                                                                    std::uint16_t>::type>::type>::type;
+    #else
+    using double_limb_type =
+      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
+                                std::uint64_t,
+                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
+                                                          std::uint32_t,
+                                                          std::uint16_t>::type>::type;
+    #endif
 
-    static constexpr std::int32_t elem_mask      = static_cast<std::int32_t>(pow10_maker(static_cast<std::uint32_t>(elem_digits10)));
-    static constexpr std::int32_t elem_mask_half = static_cast<std::int32_t>(pow10_maker(static_cast<std::uint32_t>(elem_digits10 / 2)));
+    static constexpr elem_mask_type elem_mask      = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(elem_digits10)));
+    static constexpr elem_mask_type elem_mask_half = static_cast<elem_mask_type>(pow10_maker(static_cast<std::uint32_t>(elem_digits10 / 2)));
 
     static constexpr auto digit_at_pos_in_limb(local_limb_type u, unsigned pos) noexcept -> std::uint8_t
     {
@@ -485,8 +646,8 @@
   };
 
   template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_digits10;  // NOLINT(readability-redundant-declaration)
-  template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_mask;      // NOLINT(readability-redundant-declaration)
-  template<typename LimbType> constexpr std::int32_t decwide_t_helper_base<LimbType>::elem_mask_half; // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::elem_mask;      // NOLINT(readability-redundant-declaration)
+  template<typename LimbType> constexpr typename decwide_t_helper_base<LimbType>::elem_mask_type decwide_t_helper_base<LimbType>::elem_mask_half; // NOLINT(readability-redundant-declaration)
 
   template<const std::int32_t ParamDigitsBaseTen,
            typename LimbType>
@@ -528,17 +689,24 @@
                                  const typename base_class_type::allocator_type& a = typename base_class_type::allocator_type()) noexcept
       : base_class_type(MySize, typename base_class_type::value_type(), a)
     {
+      WIDE_DECIMAL_INSTRUMENT_COUNT(value_allocation, MySize);
+
       std::fill(base_class_type::begin(),
                 base_class_type::begin() + (std::min)(MySize, static_cast<typename base_class_type::size_type>(s)),
                 v);
     }
 
     constexpr fixed_dynamic_array(const fixed_dynamic_array& other)
-      : base_class_type(static_cast<const base_class_type&>(other)) { }
+      : base_class_type(static_cast<const base_class_type&>(other))
+    {
+      WIDE_DECIMAL_INSTRUMENT_COUNT(value_allocation, MySize);
+    }
 
     fixed_dynamic_array(std::initializer_list<typename base_class_type::value_type> lst)
       : base_class_type(MySize)
     {
+      WIDE_DECIMAL_INSTRUMENT_COUNT(value_allocation, MySize);
+
       std::copy(lst.begin(),
                 lst.begin() + (std::min)(static_cast<typename base_class_type::size_type>(lst.size()), MySize),
                 base_class_type::begin());
@@ -551,13 +719,23 @@
     {
       if(this != &other)
       {
-        base_class_type::operator=(static_cast<const base_class_type&>(other));
+        if(base_class_type::size() != MySize)
+        {
+          // This array has been moved from. Re-acquire storage.
+          WIDE_DECIMAL_INSTRUMENT_COUNT(value_allocation, MySize);
+
+          base_class_type::operator=(base_class_type(other.cbegin(), other.cend(), base_class_type::get_allocator()));
+        }
+        else
+        {
+          base_class_type::operator=(static_cast<const base_class_type&>(other));
+        }
       }
 
       return *this;
     }
 
-    auto operator=(fixed_dynamic_array&& other) noexcept -> fixed_dynamic_array&
+    auto operator=(fixed_dynamic_array&& other) noexcept(std::is_nothrow_move_assignable<base_class_type>::value) -> fixed_dynamic_array&
     {
       base_class_type::operator=(static_cast<base_class_type&&>(other));
 
@@ -632,6 +810,424 @@
     auto operator[](const size_type i) const -> typename base_class_type::const_reference { return base_class_type::operator[](static_cast<typename base_class_type::size_type>(i)); }
   };
 
+  template<typename AllocatorType>
+  struct representation_allocator
+  {
+    using type = AllocatorType;
+
+    static constexpr auto is_shared() noexcept -> bool { return false; }
+  };
+
+  // Prepare a representation for writing. Only a shared representation
+  // needs to be detached from the other owners of its elements.
+  template<typename RepresentationType>
+  auto make_representation_unique(RepresentationType&) noexcept -> void { } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  template<typename AllocatorType>
+  struct representation_allocator<shared_representation<AllocatorType>>
+  {
+    using type = AllocatorType;
+
+    static constexpr auto is_shared() noexcept -> bool { return true; }
+  };
+
+  // A fixed-size array whose elements live in a reference-counted block.
+  // Copies share the block. Element access does not check the reference
+  // count. Rather, a mutating operation calls make_unique() once before
+  // writing to the elements, which clones the block if it is shared.
+  template<typename MyType,
+           const std::size_t MySize,
+           typename MyAlloc>
+  class shared_fixed_dynamic_array final
+  {
+  public:
+    using allocator_type         = typename std::allocator_traits<MyAlloc>::template rebind_alloc<MyType>;
+    using value_type             = MyType;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using pointer                = value_type*;
+    using const_pointer          = const value_type*;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using iterator               = pointer;
+    using const_iterator         = const_pointer;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr auto static_size() -> size_type { return MySize; }
+
+    explicit shared_fixed_dynamic_array(const size_type       s = MySize, // NOLINT(hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+                                        const value_type&     v = value_type(),
+                                        const allocator_type& a = allocator_type())
+      : my_block(make_block(block_allocator_type(a)))
+    {
+      std::fill(my_block->elems.begin(),
+                my_block->elems.begin() + (std::min)(MySize, s),
+                v);
+    }
+
+    shared_fixed_dynamic_array(std::initializer_list<value_type> lst)
+      : my_block(make_block(block_allocator_type()))
+    {
+      std::copy(lst.begin(),
+                lst.begin() + (std::min)(static_cast<size_type>(lst.size()), MySize),
+                my_block->elems.begin());
+    }
+
+    shared_fixed_dynamic_array(const shared_fixed_dynamic_array& other) noexcept
+      : my_block(other.my_block)
+    {
+      acquire();
+    }
+
+    shared_fixed_dynamic_array(shared_fixed_dynamic_array&& other) noexcept
+      : my_block(other.my_block)
+    {
+      other.my_block = nullptr;
+    }
+
+    ~shared_fixed_dynamic_array() { release(); }
+
+    auto operator=(const shared_fixed_dynamic_array& other) noexcept -> shared_fixed_dynamic_array&
+    {
+      if(my_block != other.my_block)
+      {
+        release();
+
+        my_block = other.my_block;
+
+        acquire();
+      }
+
+      return *this;
+    }
+
+    auto operator=(shared_fixed_dynamic_array&& other) noexcept -> shared_fixed_dynamic_array&
+    {
+      std::swap(my_block, other.my_block);
+
+      return *this;
+    }
+
+    auto get_allocator() const -> allocator_type { return allocator_type(my_block->alloc); }
+
+    static constexpr auto size() -> size_type { return MySize; }
+
+    auto is_shared() const noexcept -> bool
+    {
+      return (my_block->ref_count.load(std::memory_order_acquire) != static_cast<std::size_t>(UINT8_C(1)));
+    }
+
+    auto begin()        ->       iterator { return my_block->elems.data(); }
+    auto end  ()        ->       iterator { return my_block->elems.data() + MySize; }
+    auto begin () const -> const_iterator { return my_block->elems.data(); }
+    auto end   () const -> const_iterator { return my_block->elems.data() + MySize; }
+    auto cbegin() const -> const_iterator { return my_block->elems.data(); }
+    auto cend  () const -> const_iterator { return my_block->elems.data() + MySize; }
+
+    auto crbegin() const -> const_reverse_iterator { return const_reverse_iterator(cend()); }
+    auto crend  () const -> const_reverse_iterator { return const_reverse_iterator(cbegin()); }
+
+    auto data()       -> pointer       { return my_block->elems.data(); }
+    auto data() const -> const_pointer { return my_block->elems.data(); }
+
+    auto operator[](const size_type i)       -> reference       { return my_block->elems[i]; }
+    auto operator[](const size_type i) const -> const_reference { return my_block->elems[i]; }
+
+    auto front()       -> reference       { return my_block->elems.front(); }
+    auto front() const -> const_reference { return my_block->elems.front(); }
+    auto back ()       -> reference       { return my_block->elems.back(); }
+    auto back () const -> const_reference { return my_block->elems.back(); }
+
+    auto fill(const value_type& v) -> void
+    {
+      if(is_shared())
+      {
+        // The old elements are about to be overwritten, so do not clone them.
+        block_type* p_new = make_block(my_block->alloc);
+
+        release();
+
+        my_block = p_new;
+      }
+
+      my_block->elems.fill(v);
+    }
+
+    auto make_unique() -> void
+    {
+      if(is_shared())
+      {
+        block_type* p_new = make_block(my_block->alloc);
+
+        std::copy(my_block->elems.cbegin(), my_block->elems.cend(), p_new->elems.begin());
+
+        release();
+
+        my_block = p_new;
+      }
+    }
+
+    auto swap(shared_fixed_dynamic_array& other) noexcept -> void
+    {
+      std::swap(my_block, other.my_block);
+    }
+
+    auto swap(shared_fixed_dynamic_array&& other) noexcept -> void
+    {
+      std::swap(my_block, other.my_block);
+    }
+
+  private:
+    struct block_type;
+
+    using block_allocator_type   = typename std::allocator_traits<MyAlloc>::template rebind_alloc<block_type>;
+    using block_allocator_traits = std::allocator_traits<block_allocator_type>;
+
+    struct block_type
+    {
+      block_type(const block_allocator_type& a) : ref_count(static_cast<std::size_t>(UINT8_C(1))), alloc(a) { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+      std::atomic<std::size_t>   ref_count; // NOLINT(misc-non-private-member-variables-in-classes)
+      block_allocator_type       alloc;     // NOLINT(misc-non-private-member-variables-in-classes)
+      std::array<MyType, MySize> elems { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    block_type* my_block; // NOLINT(readability-identifier-naming)
+
+    static auto make_block(const block_allocator_type& a) -> block_type*
+    {
+      block_allocator_type my_a(a);
+
+      WIDE_DECIMAL_INSTRUMENT_COUNT(value_allocation, MySize);
+
+      block_type* p_new = block_allocator_traits::allocate(my_a, static_cast<std::size_t>(UINT8_C(1)));
+
+      ::new(static_cast<void*>(p_new)) block_type(my_a);
+
+      return p_new;
+    }
+
+    auto acquire() noexcept -> void
+    {
+      static_cast<void>(my_block->ref_count.fetch_add(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_relaxed));
+    }
+
+    auto release() noexcept -> void
+    {
+      if(   (my_block != nullptr)
+         && (my_block->ref_count.fetch_sub(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_acq_rel) == static_cast<std::size_t>(UINT8_C(1))))
+      {
+        block_allocator_type my_a(my_block->alloc);
+
+        my_block->~block_type();
+
+        block_allocator_traits::deallocate(my_a, my_block, static_cast<std::size_t>(UINT8_C(1)));
+      }
+
+      my_block = nullptr;
+    }
+  };
+
+  template<typename MyType,
+           const std::size_t MySize,
+           typename MyAlloc>
+  auto make_representation_unique(shared_fixed_dynamic_array<MyType, MySize, MyAlloc>& rep) -> void
+  {
+    rep.make_unique();
+  }
+  #endif
+
+  // Scratch storage (such as the multiplication pools) is allocated
+  // through the allocator of decwide_t only if that allocator can serve
+  // requests of arbitrary size. This is the case for polymorphic allocators.
+  // Fixed-slot allocators like util::n_slot_array_allocator can not,
+  // so scratch storage uses std::allocator for all other allocator types.
+  template<typename AllocatorType,
+           typename ValueType>
+  struct scratch_allocator
+  {
+    using type = std::allocator<ValueType>;
+
+    template<typename RepresentationType>
+    static auto get(const RepresentationType&) -> type { return type(); } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  };
+
+  #if defined(WIDE_DECIMAL_HAS_MEMORY_RESOURCE)
+  template<typename OtherValueType,
+           typename ValueType>
+  struct scratch_allocator<std::pmr::polymorphic_allocator<OtherValueType>, ValueType>
+  {
+    using type = std::pmr::polymorphic_allocator<ValueType>;
+
+    template<typename RepresentationType>
+    static auto get(const RepresentationType& rep) -> type { return type(rep.get_allocator().resource()); }
+  };
+  #endif
+
+  // A tracking allocator takes its scratch storage from the scratch
+  // allocator of its base allocator, and counts it as scratch.
+  template<typename OtherValueType,
+           typename BaseAllocatorType,
+           typename ValueType>
+  struct scratch_allocator<util::tracking_allocator<OtherValueType, BaseAllocatorType>, ValueType>
+  {
+    using base_type = typename scratch_allocator<BaseAllocatorType, ValueType>::type;
+    using type      = util::tracking_allocator<ValueType, base_type>;
+
+    template<typename RepresentationType>
+    static auto get(const RepresentationType& rep) -> type
+    {
+      using rep_base_type = typename RepresentationType::allocator_type::base_allocator_type;
+
+      return type(make_base(rep.get_allocator().base(), std::is_constructible<base_type, const rep_base_type&>()), true);
+    }
+
+  private:
+    template<typename RepBaseType>
+    static auto make_base(const RepBaseType& a, std::true_type) -> base_type { return base_type(a); } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+
+    template<typename RepBaseType>
+    static auto make_base(const RepBaseType&, std::false_type) -> base_type { return base_type(); } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  template<typename AllocatorType,
+           typename ValueType>
+  struct scratch_allocator<shared_representation<AllocatorType>, ValueType> : public scratch_allocator<AllocatorType, ValueType> { };
+  #endif
+
+  // The allocation scope that an operation of decwide_t opens on entry.
+  // It does nothing, unless the allocator is a tracking allocator,
+  // in which case the allocations of the operation are counted under
+  // its name if no other scope is active (see util::allocation_scope).
+  template<typename AllocatorType>
+  struct operation_allocation_scope
+  {
+    explicit operation_allocation_scope(const char*) noexcept { } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  };
+
+  template<typename OtherValueType,
+           typename BaseAllocatorType>
+  struct operation_allocation_scope<util::tracking_allocator<OtherValueType, BaseAllocatorType>>
+  {
+    explicit operation_allocation_scope(const char* name) : my_scope(name, true) { }
+
+    const typename util::tracking_allocator<OtherValueType, BaseAllocatorType>::scope_type my_scope; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  template<typename AllocatorType>
+  struct operation_allocation_scope<shared_representation<AllocatorType>> : public operation_allocation_scope<AllocatorType>
+  {
+    explicit operation_allocation_scope(const char* name) : operation_allocation_scope<AllocatorType>(name) { }
+  };
+  #endif
+
+  // Create an array of the same type as rep, using the same allocator.
+  template<typename MyType,
+           const std::size_t MySize,
+           typename MyAlloc>
+  auto make_representation_like(const fixed_dynamic_array<MyType, MySize, MyAlloc>& rep) -> fixed_dynamic_array<MyType, MySize, MyAlloc>
+  {
+    return fixed_dynamic_array<MyType, MySize, MyAlloc>(MySize, MyType(), rep.get_allocator());
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  template<typename MyType,
+           const std::size_t MySize,
+           typename MyAlloc>
+  auto make_representation_like(const shared_fixed_dynamic_array<MyType, MySize, MyAlloc>& rep) -> shared_fixed_dynamic_array<MyType, MySize, MyAlloc>
+  {
+    return shared_fixed_dynamic_array<MyType, MySize, MyAlloc>(MySize, MyType(), rep.get_allocator());
+  }
+  #endif
+
+  template<typename MyType,
+           const std::size_t MySize>
+  auto make_representation_like(const fixed_static_array<MyType, MySize>&) -> fixed_static_array<MyType, MySize> // NOLINT(hicpp-named-parameter,readability-named-parameter)
+  {
+    return fixed_static_array<MyType, MySize>();
+  }
+
+  // Binary serialization format of decwide_t (version 1).
+  // All fields are stored in the byte order of the host,
+  // which is identified by the byte_order marker.
+  //   offset  0: magic         (std::uint32_t, "DWDT")
+  //   offset  4: version       (std::uint16_t)
+  //   offset  6: limb size     (std::uint8_t, in bytes)
+  //   offset  7: sign          (std::uint8_t, 1 if negative)
+  //   offset  8: byte_order    (std::uint32_t, 0x01020304)
+  //   offset 12: digits10      (std::int32_t)
+  //   offset 16: elem_number   (std::int32_t, count of stored limbs)
+  //   offset 20: prec_elem     (std::int32_t, at most elem_number)
+  //   offset 24: exponent      (std::int64_t)
+  //   offset 32: limbs         (elem_number * limb size)
+  // The limbs start on an 8-byte boundary relative to the
+  // beginning of the data, so that an aligned buffer (such as
+  // a memory-mapped file) can be read without realignment.
+  struct serialization_format
+  {
+    static constexpr auto magic      () noexcept -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(0x54445744)); }
+    static constexpr auto version    () noexcept -> std::uint16_t { return static_cast<std::uint16_t>(UINT8_C(1)); }
+    static constexpr auto byte_order () noexcept -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(0x01020304)); }
+    static constexpr auto header_size() noexcept -> std::size_t   { return static_cast<std::size_t>(UINT8_C(32)); }
+
+    static constexpr auto offset_magic      () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 0)); }
+    static constexpr auto offset_version    () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 4)); }
+    static constexpr auto offset_limb_size  () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 6)); }
+    static constexpr auto offset_sign       () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 7)); }
+    static constexpr auto offset_byte_order () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 8)); }
+    static constexpr auto offset_digits10   () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(12)); }
+    static constexpr auto offset_elem_number() noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(16)); }
+    static constexpr auto offset_prec_elem  () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(20)); }
+    static constexpr auto offset_exponent   () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(24)); }
+
+    template<typename FieldType>
+    static auto put(std::uint8_t* p, const std::size_t offset, const FieldType value) -> void
+    {
+      std::memcpy(p + offset, &value, sizeof(FieldType)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    template<typename FieldType>
+    static auto get(const std::uint8_t* p, const std::size_t offset) -> FieldType
+    {
+      FieldType value { };
+
+      std::memcpy(&value, p + offset, sizeof(FieldType)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      return value;
+    }
+  };
+
+  // Binary serialization format of agm_checkpoint (version 1).
+  // The header uses the byte order marker of serialization_format
+  // and is followed by the serialized values of the checkpoint.
+  //   offset  0: magic         (std::uint32_t, "DWCP")
+  //   offset  4: version       (std::uint16_t)
+  //   offset  6: kind          (std::uint8_t)
+  //   offset  7: value count   (std::uint8_t)
+  //   offset  8: byte_order    (std::uint32_t, 0x01020304)
+  //   offset 12: iteration     (std::uint32_t)
+  //   offset 16: digits10      (std::int32_t)
+  //   offset 20: reserved      (std::uint32_t, zero)
+  // The header size is a multiple of 8, so that the limbs
+  // of the values stay on an 8-byte boundary.
+  struct checkpoint_serialization_format
+  {
+    static constexpr auto magic      () noexcept -> std::uint32_t { return static_cast<std::uint32_t>(UINT32_C(0x50435744)); }
+    static constexpr auto version    () noexcept -> std::uint16_t { return static_cast<std::uint16_t>(UINT8_C(1)); }
+    static constexpr auto header_size() noexcept -> std::size_t   { return static_cast<std::size_t>(UINT8_C(24)); }
+
+    static constexpr auto offset_magic      () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 0)); }
+    static constexpr auto offset_version    () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 4)); }
+    static constexpr auto offset_kind       () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 6)); }
+    static constexpr auto offset_value_count() noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 7)); }
+    static constexpr auto offset_byte_order () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C( 8)); }
+    static constexpr auto offset_iteration  () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(12)); }
+    static constexpr auto offset_digits10   () noexcept -> std::size_t { return static_cast<std::size_t>(UINT8_C(16)); }
+  };
+
   enum class os_float_field_type // NOLINT(performance-enum-size)
   {
     scientific,
@@ -639,6 +1235,166 @@
     none
   };
 
+  // Collect single characters into a fixed-size chunk and hand
+  // each full chunk on to the sink. This keeps the memory needed
+  // for writing huge numbers bounded by the size of the chunk.
+  template<typename SinkType,
+           const std::size_t ChunkSize = static_cast<std::size_t>(UINT16_C(1024))>
+  class chunked_char_writer
+  {
+  public:
+    explicit chunked_char_writer(SinkType& sink) : my_sink(sink) { } // NOLINT(google-runtime-references)
+
+    chunked_char_writer() = delete;
+
+    chunked_char_writer(const chunked_char_writer&) = delete;
+    chunked_char_writer(chunked_char_writer&&) noexcept = delete;
+
+    ~chunked_char_writer() = default;
+
+    auto operator=(const chunked_char_writer&) -> chunked_char_writer& = delete;
+    auto operator=(chunked_char_writer&&) noexcept -> chunked_char_writer& = delete;
+
+    auto operator()(const char c) -> bool
+    {
+      const auto result_is_ok = ((my_count != ChunkSize) || flush());
+
+      if(result_is_ok)
+      {
+        my_chunk[my_count] = c; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        ++my_count;
+      }
+
+      return result_is_ok;
+    }
+
+    auto flush() -> bool
+    {
+      const auto result_is_ok = ((my_count == static_cast<std::size_t>(UINT8_C(0))) || my_sink.write(my_chunk.data(), my_count));
+
+      my_count = static_cast<std::size_t>(UINT8_C(0));
+
+      return result_is_ok;
+    }
+
+  private:
+    SinkType&                      my_sink;     // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    std::array<char, ChunkSize>    my_chunk { };
+    std::size_t                    my_count { };
+  };
+
+  // Convert eight ASCII decimal digits to and from a value below 10^8
+  // with a few multiply-add steps on all of the digits at once (SIMD
+  // within a register), rather than with a loop over the characters.
+  // The first (most significant) character is held in the lowest byte.
+  constexpr auto swar_ascii_zeros = static_cast<std::uint64_t>(UINT64_C(0x3030303030303030));
+
+  inline auto swar_load_eight_chars(const char* p) -> std::uint64_t
+  {
+    #if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+    std::uint64_t word { };
+
+    std::memcpy(&word, p, sizeof(word));
+    #else
+    auto word = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      word |= static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint8_t>(p[i])) << static_cast<unsigned>(i * 8U)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    #endif
+
+    return word;
+  }
+
+  inline auto swar_store_eight_chars(const std::uint64_t word, char* p) -> void
+  {
+    #if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM64)
+    std::memcpy(p, &word, sizeof(word));
+    #else
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      p[i] = static_cast<char>(static_cast<std::uint8_t>(word >> static_cast<unsigned>(i * 8U))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    #endif
+  }
+
+  constexpr auto swar_eight_chars_are_digits(const std::uint64_t word) -> bool
+  {
+    // Every byte must be in 0x30...0x39, so its upper nibble
+    // must be 3 both before and after adding 6.
+    return
+    (
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(word & UINT64_C(0xF0F0F0F0F0F0F0F0))
+        | static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(word + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4U)
+      )
+      == UINT64_C(0x3333333333333333)
+    );
+  }
+
+  inline auto swar_eight_digits_to_value(std::uint64_t word) -> std::uint32_t
+  {
+    word = static_cast<std::uint64_t>(word - swar_ascii_zeros);
+
+    // Combine neighboring digits into two-digit values in every other byte.
+    word = static_cast<std::uint64_t>(static_cast<std::uint64_t>(word * UINT64_C(10)) + static_cast<std::uint64_t>(word >> 8U));
+
+    // Combine the four two-digit values, weighted by 10^6, 10^4, 10^2 and 1,
+    // in the upper half of the products.
+    constexpr auto mask = static_cast<std::uint64_t>(UINT64_C(0x000000FF000000FF));
+
+    constexpr auto mul1 = static_cast<std::uint64_t>(UINT64_C(100) + static_cast<std::uint64_t>(UINT64_C(1000000) << 32U));
+    constexpr auto mul2 = static_cast<std::uint64_t>(UINT64_C(1)   + static_cast<std::uint64_t>(UINT64_C(10000)   << 32U));
+
+    return
+      static_cast<std::uint32_t>
+      (
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(word & mask) * mul1)
+          + static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(word >> 16U) & mask) * mul2)
+        )
+        >> 32U
+      );
+  }
+
+  inline auto swar_value_to_eight_digits(const std::uint32_t value) -> std::uint64_t
+  {
+    // Split the value into two four-digit halves in 32-bit lanes,
+    // then into two-digit quarters in 16-bit lanes and finally into
+    // single digits in bytes. The divisions by 100 and by 10 are
+    // multiplications by reciprocals that are exact in this range.
+    const auto halves =
+      static_cast<std::uint64_t>
+      (
+          static_cast<std::uint64_t>(value / UINT32_C(10000))
+        | static_cast<std::uint64_t>(static_cast<std::uint64_t>(value % UINT32_C(10000)) << 32U)
+      );
+
+    const auto hundreds = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(halves * UINT64_C(10486)) >> 20U) & UINT64_C(0x0000007F0000007F));
+
+    const auto quarters =
+      static_cast<std::uint64_t>
+      (
+          hundreds
+        | static_cast<std::uint64_t>(static_cast<std::uint64_t>(halves - static_cast<std::uint64_t>(hundreds * UINT64_C(100))) << 16U)
+      );
+
+    const auto tens = static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(quarters * UINT64_C(103)) >> 10U) & UINT64_C(0x000F000F000F000F));
+
+    const auto digits =
+      static_cast<std::uint64_t>
+      (
+          tens
+        | static_cast<std::uint64_t>(static_cast<std::uint64_t>(quarters - static_cast<std::uint64_t>(tens * UINT64_C(10))) << 8U)
+      );
+
+    return static_cast<std::uint64_t>(digits + swar_ascii_zeros);
+  }
+
   template<typename UnsignedIntegerType,
            typename SignedIntegerType>
   struct unsigned_wrap
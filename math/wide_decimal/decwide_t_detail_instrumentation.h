@@ -0,0 +1,377 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements optional operation counters for decwide_t.
+// They are compiled in only if WIDE_DECIMAL_ENABLE_INSTRUMENTATION
+// is defined. Otherwise the hooks expand to nothing.
+
+#ifndef DECWIDE_T_DETAIL_INSTRUMENTATION_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_INSTRUMENTATION_2026_10_19_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #if defined(WIDE_DECIMAL_ENABLE_INSTRUMENTATION)
+
+  #include <array>
+  #include <atomic>
+  #include <chrono>
+  #include <cstddef>
+  #include <cstdint>
+  #include <mutex>
+  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  #include <iomanip>
+  #include <ostream>
+  #endif
+
+  // Count a call of the kernel kind on elems limbs and time it
+  // until the end of the enclosing scope.
+  #define WIDE_DECIMAL_INSTRUMENT_SCOPE(kind, elems) const instrumentation::detail::scoped_timer wide_decimal_instrument_scope_timer(instrumentation::counter_kind::kind, static_cast<std::int32_t>(elems)) // NOLINT(cppcoreguidelines-macro-usage)
+
+  // Count an event of the kind on elems limbs without timing it.
+  #define WIDE_DECIMAL_INSTRUMENT_COUNT(kind, elems) instrumentation::detail::count(instrumentation::counter_kind::kind, static_cast<std::int32_t>(elems), static_cast<std::uint64_t>(UINT8_C(0))) // NOLINT(cppcoreguidelines-macro-usage)
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::instrumentation {
+  #else
+  namespace math { namespace wide_decimal { namespace instrumentation { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  // The timed kinds are inclusive. The time of an inverse
+  // contains the time of the multiplications it performs.
+  enum class counter_kind : std::uint8_t
+  {
+    mul_school,
+    mul_kara,
+    mul_fft,
+    mul_by_int,
+    div_by_int,
+    inv,
+    sqrt,
+    rootn_inv,
+    newton_step,
+    value_allocation,
+    scratch_allocation,
+    fft_fallback
+  };
+
+  constexpr auto counter_kind_count() -> std::size_t { return static_cast<std::size_t>(UINT8_C(12)); }
+
+  // Size bucket k counts the calls on [2^k, 2^(k+1)) limbs.
+  constexpr auto size_bucket_count() -> std::size_t { return static_cast<std::size_t>(UINT8_C(32)); }
+
+  inline auto size_bucket(const std::int32_t elems) -> std::size_t
+  {
+    auto bucket = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto n = static_cast<std::uint32_t>(elems); n > static_cast<std::uint32_t>(UINT8_C(1)); n >>= 1U)
+    {
+      ++bucket;
+    }
+
+    return bucket;
+  }
+
+  inline auto counter_kind_name(const counter_kind kind) -> const char*
+  {
+    constexpr std::array<const char*, counter_kind_count()> names =
+    {{
+      "mul_school", "mul_kara", "mul_fft", "mul_by_int", "div_by_int",
+      "inv", "sqrt", "rootn_inv", "newton_step", "value_allocation", "scratch_allocation",
+      "fft_fallback"
+    }};
+
+    return names[static_cast<std::size_t>(kind)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+  }
+
+  struct counter_snapshot
+  {
+    std::array<std::array<std::uint64_t, size_bucket_count()>, counter_kind_count()> calls       { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<std::uint64_t, counter_kind_count()>                                  nanoseconds { }; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    WIDE_DECIMAL_NODISCARD auto total_calls(const counter_kind kind) const -> std::uint64_t
+    {
+      auto total = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(const auto& n : calls[static_cast<std::size_t>(kind)]) { total += n; } // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      return total;
+    }
+
+    WIDE_DECIMAL_NODISCARD auto total_nanoseconds(const counter_kind kind) const -> std::uint64_t
+    {
+      return nanoseconds[static_cast<std::size_t>(kind)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    }
+
+    auto operator+=(const counter_snapshot& other) -> counter_snapshot&
+    {
+      for(auto k = static_cast<std::size_t>(UINT8_C(0)); k < counter_kind_count(); ++k)
+      {
+        for(auto b = static_cast<std::size_t>(UINT8_C(0)); b < size_bucket_count(); ++b)
+        {
+          calls[k][b] += other.calls[k][b]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        nanoseconds[k] += other.nanoseconds[k]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+
+      return *this;
+    }
+  };
+
+  namespace detail {
+
+  // The counters of one thread. Only the owning thread writes them,
+  // so relaxed loads and stores suffice and the hot paths need no
+  // read-modify-write. Other threads read them for the global snapshot.
+  struct thread_counters
+  {
+    using counter_type = std::atomic<std::uint64_t>;
+
+    std::array<std::array<counter_type, size_bucket_count()>, counter_kind_count()> calls       { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::array<counter_type, counter_kind_count()>                                  nanoseconds { }; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    thread_counters* next { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    thread_counters();
+
+    thread_counters(const thread_counters&) = delete;
+    thread_counters(thread_counters&&) noexcept = delete;
+
+    ~thread_counters();
+
+    auto operator=(const thread_counters&) -> thread_counters& = delete;
+    auto operator=(thread_counters&&) noexcept -> thread_counters& = delete;
+
+    WIDE_DECIMAL_NODISCARD auto get() const -> counter_snapshot
+    {
+      counter_snapshot result { };
+
+      for(auto k = static_cast<std::size_t>(UINT8_C(0)); k < counter_kind_count(); ++k)
+      {
+        for(auto b = static_cast<std::size_t>(UINT8_C(0)); b < size_bucket_count(); ++b)
+        {
+          result.calls[k][b] = calls[k][b].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+
+        result.nanoseconds[k] = nanoseconds[k].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      }
+
+      return result;
+    }
+
+    auto clear() -> void
+    {
+      for(auto& kind_calls : calls)
+      {
+        for(auto& n : kind_calls) { n.store(static_cast<std::uint64_t>(UINT8_C(0)), std::memory_order_relaxed); }
+      }
+
+      for(auto& ns : nanoseconds) { ns.store(static_cast<std::uint64_t>(UINT8_C(0)), std::memory_order_relaxed); }
+    }
+  };
+
+  // The live threads and the counts of the threads that have exited.
+  struct registry
+  {
+    std::mutex       mtx     { };         // NOLINT(misc-non-private-member-variables-in-classes)
+    thread_counters* head    { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+    counter_snapshot retired { };         // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  inline auto get_registry() -> registry&
+  {
+    static registry my_registry { };
+
+    return my_registry;
+  }
+
+  inline thread_counters::thread_counters()
+  {
+    registry& r = get_registry();
+
+    const std::lock_guard<std::mutex> lock(r.mtx);
+
+    next   = r.head;
+    r.head = this;
+  }
+
+  inline thread_counters::~thread_counters()
+  {
+    registry& r = get_registry();
+
+    const std::lock_guard<std::mutex> lock(r.mtx);
+
+    r.retired += get();
+
+    for(thread_counters** pp = &r.head; *pp != nullptr; pp = &((*pp)->next))
+    {
+      if(*pp == this)
+      {
+        *pp = next;
+
+        break;
+      }
+    }
+  }
+
+  inline auto this_thread_counters() -> thread_counters&
+  {
+    thread_local thread_counters my_counters { };
+
+    return my_counters;
+  }
+
+  inline auto count(const counter_kind kind, const std::int32_t elems, const std::uint64_t ns) -> void
+  {
+    thread_counters& c = this_thread_counters();
+
+    auto& n = c.calls[static_cast<std::size_t>(kind)][size_bucket(elems)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+    auto& t = c.nanoseconds[static_cast<std::size_t>(kind)];               // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+    n.store(n.load(std::memory_order_relaxed) + static_cast<std::uint64_t>(UINT8_C(1)), std::memory_order_relaxed);
+    t.store(t.load(std::memory_order_relaxed) + ns,                                     std::memory_order_relaxed);
+  }
+
+  class scoped_timer
+  {
+  public:
+    scoped_timer(const counter_kind kind, const std::int32_t elems)
+      : my_kind (kind),
+        my_elems(elems),
+        my_start(clock_type::now()) { }
+
+    scoped_timer() = delete;
+
+    scoped_timer(const scoped_timer&) = delete;
+    scoped_timer(scoped_timer&&) noexcept = delete;
+
+    ~scoped_timer()
+    {
+      const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - my_start).count();
+
+      count(my_kind, my_elems, static_cast<std::uint64_t>(ns));
+    }
+
+    auto operator=(const scoped_timer&) -> scoped_timer& = delete;
+    auto operator=(scoped_timer&&) noexcept -> scoped_timer& = delete;
+
+  private:
+    using clock_type = std::chrono::steady_clock;
+
+    const counter_kind           my_kind;
+    const std::int32_t           my_elems;
+    const clock_type::time_point my_start;
+  };
+
+  } // namespace detail
+
+  // The counters of the calling thread.
+  inline auto thread_snapshot() -> counter_snapshot
+  {
+    return detail::this_thread_counters().get();
+  }
+
+  // The counters of all threads, including the threads that have exited.
+  inline auto snapshot() -> counter_snapshot
+  {
+    detail::registry& r = detail::get_registry();
+
+    const std::lock_guard<std::mutex> lock(r.mtx);
+
+    counter_snapshot result = r.retired;
+
+    for(const detail::thread_counters* p = r.head; p != nullptr; p = p->next)
+    {
+      result += p->get();
+    }
+
+    return result;
+  }
+
+  inline auto reset_thread() -> void
+  {
+    detail::this_thread_counters().clear();
+  }
+
+  // Reset the counters of all threads. A count that another thread
+  // makes during the reset may or may not survive it.
+  inline auto reset() -> void
+  {
+    detail::registry& r = detail::get_registry();
+
+    const std::lock_guard<std::mutex> lock(r.mtx);
+
+    r.retired = counter_snapshot { };
+
+    for(detail::thread_counters* p = r.head; p != nullptr; p = p->next)
+    {
+      p->clear();
+    }
+  }
+
+  #if !defined(WIDE_DECIMAL_DISABLE_IOSTREAM)
+  // Print one line per kind that has been counted, with the calls,
+  // the total and mean time, and the calls per size bucket.
+  inline auto report(std::ostream& os, const counter_snapshot& s) -> void
+  {
+    os << std::left  << std::setw(20) << "kind"
+       << std::right << std::setw(14) << "calls"
+       << std::setw(14) << "total_ms"
+       << std::setw(14) << "mean_ns"
+       << "  calls by limbs\n";
+
+    for(auto k = static_cast<std::size_t>(UINT8_C(0)); k < counter_kind_count(); ++k)
+    {
+      const auto kind  = static_cast<counter_kind>(k);
+      const auto calls = s.total_calls(kind);
+
+      if(calls == static_cast<std::uint64_t>(UINT8_C(0)))
+      {
+        continue;
+      }
+
+      const auto ns = s.total_nanoseconds(kind);
+
+      os << std::left  << std::setw(20) << counter_kind_name(kind)
+         << std::right << std::setw(14) << calls
+         << std::setw(14) << (ns / static_cast<std::uint64_t>(UINT32_C(1000000)))
+         << std::setw(14) << (ns / calls)
+         << " ";
+
+      for(auto b = static_cast<std::size_t>(UINT8_C(0)); b < size_bucket_count(); ++b)
+      {
+        if(s.calls[k][b] != static_cast<std::uint64_t>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        {
+          os << " [" << (static_cast<std::uint64_t>(UINT8_C(1)) << b) << ".." << ((static_cast<std::uint64_t>(UINT8_C(1)) << (b + 1U)) - 1U) << "]:" << s.calls[k][b]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+
+      os << '\n';
+    }
+  }
+  #endif // !WIDE_DECIMAL_DISABLE_IOSTREAM
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::instrumentation
+  #else
+  } // namespace instrumentation
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+  #else
+
+  #define WIDE_DECIMAL_INSTRUMENT_SCOPE(kind, elems) // NOLINT(cppcoreguidelines-macro-usage)
+  #define WIDE_DECIMAL_INSTRUMENT_COUNT(kind, elems) // NOLINT(cppcoreguidelines-macro-usage)
+
+  #endif // WIDE_DECIMAL_ENABLE_INSTRUMENTATION
+
+#endif // DECWIDE_T_DETAIL_INSTRUMENTATION_2026_10_19_H
@@ -19,9 +19,12 @@
 
   #include <math/wide_decimal/decwide_t_detail.h>
   #include <math/wide_decimal/decwide_t_detail_fft.h>
+  #include <math/wide_decimal/decwide_t_detail_simd.h>
 
+  #include <cmath>
   #include <cstdint>
   #include <iterator>
+  #include <limits>
   #include <type_traits>
 
   WIDE_DECIMAL_NAMESPACE_BEGIN
@@ -164,6 +167,9 @@
     return (borrow != static_cast<std::uint_fast8_t>(UINT8_C(0)));
   }
 
+  // The carry is released after each limb product, since the double
+  // limb of std::uint8_t and std::uint64_t limbs has no room for the
+  // sum of a whole column of products.
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType>
   void eval_multiply_n_by_n_to_2n
@@ -172,7 +178,8 @@
           InputLimbIteratorType   a,
           InputLimbIteratorType   b,
     const std::int_fast32_t       count,
-    const typename std::enable_if<std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint8_t>::value>::type* p_nullparam = nullptr
+    const typename std::enable_if<(   std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint8_t>::value
+                                   || std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint64_t>::value)>::type* p_nullparam = nullptr
   )
   {
     static_cast<void>(p_nullparam);
@@ -182,12 +189,7 @@
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using local_double_limb_type = typename decwide_t_helper_base<local_limb_type>::double_limb_type;
 
     const auto fill_dst =
       static_cast<std::uint_fast32_t>
@@ -248,17 +250,18 @@
   {
     static_cast<void>(p_nullparam);
 
+    // Use the vectorized kernel of the processor, if there is one.
+    if(eval_multiply_n_by_n_to_2n_simd(r, a, b, count))
+    {
+      return;
+    }
+
     using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
 
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using local_double_limb_type = typename decwide_t_helper_base<local_limb_type>::double_limb_type;
 
     using local_reverse_iterator_type = std::reverse_iterator<local_limb_type*>;
 
@@ -323,12 +326,7 @@
   {
     using local_limb_type = typename std::iterator_traits<LimbIteratorType>::value_type;
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using local_double_limb_type = typename decwide_t_helper_base<local_limb_type>::double_limb_type;
 
     auto carry = static_cast<local_limb_type>(UINT8_C(0));
 
@@ -363,12 +361,7 @@
     constexpr auto local_elem_mask =
       static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask);
 
-    using local_double_limb_type =
-      typename std::conditional<std::is_same<local_limb_type, std::uint32_t>::value,
-                                std::uint64_t,
-                                typename std::conditional<std::is_same<local_limb_type, std::uint16_t>::value,
-                                                          std::uint32_t,
-                                                          std::uint16_t>::type>::type;
+    using local_double_limb_type = typename decwide_t_helper_base<local_limb_type>::double_limb_type;
 
     auto prev = static_cast<local_limb_type>(UINT8_C(0));
 
@@ -668,39 +661,154 @@
   }
   #endif
 
+  constexpr auto fft_log2_ceil(const std::uint32_t n, const unsigned k = 0U) -> unsigned
+  {
+    return (((static_cast<std::uint32_t>(UINT32_C(1)) << k) < n) ? fft_log2_ceil(n, k + 1U) : k);
+  }
+
+  // An upper bound of the round-off error of an FFT multiplication
+  // of two sequences of n_points points less than point_base each,
+  // after C. Percival, "Rapid multiplication modulo the sum and difference
+  // of highly composite numbers", Math. Comp. 72 (2003), pp. 387-395.
+  // It assumes twiddle factors that are accurate to within the unit
+  // round-off of the floating-point type. The terms are the rounding
+  // in the butterflies, in the products with the twiddle factors (with
+  // a relative error of sqrt(5) times the unit round-off) and in the
+  // twiddle factors themselves.
+  template<typename FftFloatType>
+  constexpr auto fft_roundoff_bound(const std::uint32_t n_points,
+                                    const std::uint64_t point_base, // NOLINT(bugprone-easily-swappable-parameters)
+                                    const std::uint32_t n_fft) -> double
+  {
+    return
+        (  static_cast<double>(n_points)
+         * static_cast<double>(point_base - static_cast<std::uint64_t>(UINT8_C(1)))
+         * static_cast<double>(point_base - static_cast<std::uint64_t>(UINT8_C(1))))
+      * (static_cast<double>(std::numeric_limits<FftFloatType>::epsilon()) / 2.0)
+      * (  (static_cast<double>(3U * fft_log2_ceil(n_fft)) * 2.0)
+         + ((static_cast<double>(3U * fft_log2_ceil(n_fft)) + 1.0) * 2.2360679774997896964)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+  }
+
+  // The bound above for the FFT multiplication of prec_elems_for_multiply
+  // limbs, each of which is split into points_per_limb points.
+  template<typename LimbType,
+           typename FftFloatType>
+  constexpr auto fft_roundoff_bound_of_limbs(const std::int32_t  prec_elems_for_multiply,
+                                             const std::uint32_t points_per_limb) -> double
+  {
+    return
+      fft_roundoff_bound<FftFloatType>
+      (
+        static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * points_per_limb),
+        small_power(static_cast<std::uint64_t>(UINT8_C(10)), static_cast<unsigned>(static_cast<std::uint32_t>(decwide_t_helper_base<LimbType>::elem_digits10) / points_per_limb)),
+        static_cast<std::uint32_t>(a000079::a000079_as_constexpr(static_cast<std::uint32_t>(static_cast<std::uint32_t>(prec_elems_for_multiply) * points_per_limb)) * 2U)
+      );
+  }
+
+  // The number of FFT points into which each limb is split for an FFT
+  // multiplication of prec_elems_for_multiply limbs. This is a divisor
+  // of the number of decimal digits of a limb, such as 1 (full limbs),
+  // 2 (half-limbs) or 4 (quarter-limbs), and at most max_points_per_limb.
+  // The 18-digit limbs of std::uint64_t are split into 3 or 6 points,
+  // since 4 does not divide their digits. Fewer and
+  // larger points make the FFT shorter, so the smallest count whose
+  // round-off error bound does not exceed max_roundoff is taken. If no
+  // count meets the bound, the largest one is taken, and the round-off
+  // check of mul_loop_fft decides about the product.
+  template<typename LimbType,
+           typename FftFloatType>
+  auto fft_points_per_limb(const std::int32_t  prec_elems_for_multiply,
+                           const std::uint32_t max_points_per_limb, // NOLINT(bugprone-easily-swappable-parameters)
+                           const double        max_roundoff) -> std::uint32_t
+  {
+    constexpr auto local_elem_digits10 = static_cast<std::uint32_t>(decwide_t_helper_base<LimbType>::elem_digits10);
+
+    const auto points_per_limb_limit = (std::min)(max_points_per_limb, local_elem_digits10);
+
+    auto points_per_limb = static_cast<std::uint32_t>(UINT8_C(1));
+
+    for(auto count = points_per_limb; count <= points_per_limb_limit; ++count) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      if((local_elem_digits10 % count) != static_cast<std::uint32_t>(UINT8_C(0)))
+      {
+        continue;
+      }
+
+      points_per_limb = count;
+
+      if(fft_roundoff_bound_of_limbs<LimbType, FftFloatType>(prec_elems_for_multiply, points_per_limb) <= max_roundoff)
+      {
+        break;
+      }
+    }
+
+    return points_per_limb;
+  }
+
+  // Multiply u by v with FFTs, splitting each limb into points_per_limb
+  // points. If check_roundoff is true, return the largest distance of a
+  // coefficient of the inverse transform from its nearest integer.
+  // If that round-off error exceeds max_roundoff, the coefficients
+  // can not be rounded reliably, and r (which may alias u) is left
+  // unmodified. If check_roundoff is false (for instance when the bound
+  // of the round-off error is met), or with
+  // WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK, the round-off error is not
+  // measured, and zero is returned.
   template<typename InputLimbIteratorType,
            typename OutputLimbIteratorType,
            typename FftFloatIteratorType>
-  auto mul_loop_fft(      OutputLimbIteratorType r,
-                          InputLimbIteratorType  u,                       // NOLINT(bugprone-easily-swappable-parameters)
-                          InputLimbIteratorType  v,
-                          FftFloatIteratorType   af,
-                          FftFloatIteratorType   bf,
-                    const std::int32_t           prec_elems_for_multiply, // NOLINT(bugprone-easily-swappable-parameters)
-                    const std::uint32_t          n_fft) -> void           // NOLINT(bugprone-easily-swappable-parameters)
+  auto mul_loop_fft(      OutputLimbIteratorType                                          r,
+                          InputLimbIteratorType                                           u,                       // NOLINT(bugprone-easily-swappable-parameters)
+                          InputLimbIteratorType                                           v,
+                          FftFloatIteratorType                                            af,
+                          FftFloatIteratorType                                            bf,
+                    const std::int32_t                                                    prec_elems_for_multiply, // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::uint32_t                                                   n_fft,                   // NOLINT(bugprone-easily-swappable-parameters)
+                    const std::uint32_t                                                   points_per_limb,
+                    const typename std::iterator_traits<FftFloatIteratorType>::value_type max_roundoff,
+                    const bool                                                            check_roundoff) -> typename std::iterator_traits<FftFloatIteratorType>::value_type
   {
     using local_limb_type = typename std::iterator_traits<OutputLimbIteratorType>::value_type;
 
-    constexpr auto local_elem_mask_half =
-      static_cast<local_limb_type>(decwide_t_helper_base<local_limb_type>::elem_mask_half);
+    const auto local_point_base =
+      static_cast<local_limb_type>
+      (
+        pow10_maker_as_runtime_value
+        (
+          static_cast<std::uint32_t>(static_cast<std::uint32_t>(decwide_t_helper_base<local_limb_type>::elem_digits10) / points_per_limb)
+        )
+      );
 
     using local_fft_float_type = typename std::iterator_traits<FftFloatIteratorType>::value_type;
 
+    // Split the limbs into points, the most significant point first.
+    // The most significant point keeps the whole quotient, so that
+    // a limb which is not normalized (such as a leading limb equal
+    // to the limb base after a rounding carry) is still exact.
     for(auto   i = static_cast<std::uint32_t>(UINT8_C(0));
                i < static_cast<std::uint32_t>(prec_elems_for_multiply);
              ++i)
     {
-      af[ i * 2U]       = static_cast<local_fft_float_type>(u[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      af[(i * 2U) + 1U] = static_cast<local_fft_float_type>(u[i] % local_elem_mask_half);
+      auto ui = u[i];
+      auto vi = v[i];
+
+      for(auto k = points_per_limb; k > static_cast<std::uint32_t>(UINT8_C(1)); --k) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        af[(i * points_per_limb) + (k - 1U)] = static_cast<local_fft_float_type>(static_cast<local_limb_type>(ui % local_point_base));
+        bf[(i * points_per_limb) + (k - 1U)] = static_cast<local_fft_float_type>(static_cast<local_limb_type>(vi % local_point_base));
 
-      bf[ i * 2U]       = static_cast<local_fft_float_type>(v[i] / local_elem_mask_half); // NOLINT(bugprone-integer-division)
-      bf[(i * 2U) + 1U] = static_cast<local_fft_float_type>(v[i] % local_elem_mask_half);
+        ui = static_cast<local_limb_type>(ui / local_point_base);
+        vi = static_cast<local_limb_type>(vi / local_point_base);
+      }
+
+      af[i * points_per_limb] = static_cast<local_fft_float_type>(ui);
+      bf[i * points_per_limb] = static_cast<local_fft_float_type>(vi);
     }
 
     const auto fill_distance =
       static_cast<std::size_t>
       (
-        static_cast<std::size_t>(prec_elems_for_multiply) * static_cast<std::size_t>(UINT8_C(2))
+        static_cast<std::size_t>(prec_elems_for_multiply) * static_cast<std::size_t>(points_per_limb)
       );
 
     std::fill(af + fill_distance, af + n_fft, static_cast<local_fft_float_type>(0));
@@ -728,47 +836,106 @@
     // Perform the reverse FFT on the result of the convolution.
     detail::fft::rfft_lanczos_rfft<local_fft_float_type, false>(n_fft, af);
 
-    // Release the carries and re-combine the low and high parts.
-    // This sets the integral data elements in the big number
-    // to the result of multiplication.
-    using fft_carry_type = std::uint_fast64_t;
-
-    auto carry = static_cast<fft_carry_type>(UINT8_C(0));
-
+    // Coefficient j of the product has the weight of point j + 2,
+    // so limb i of the result is made of the coefficients
+    // (i * points_per_limb) - 1 up to (i * points_per_limb) + points_per_limb - 2.
+    // The coefficients beyond the last limb are truncated.
     const auto recombine_size =
       static_cast<std::int32_t>
       (
-          static_cast<std::int32_t>(prec_elems_for_multiply * static_cast<std::int32_t>(INT8_C(2)))
+          static_cast<std::int32_t>(prec_elems_for_multiply * static_cast<std::int32_t>(points_per_limb))
         - static_cast<std::int32_t>(INT8_C(2))
       );
 
-    for(auto                           j   = static_cast<std::uint32_t>(recombine_size);
-             static_cast<std::int32_t>(j) >= static_cast<std::int32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
-                                       j  -= static_cast<std::uint32_t>(UINT8_C(2)))
-    {
-      const auto n_fft_half =
-        static_cast<local_fft_float_type>
+    const auto n_fft_half =
+      static_cast<local_fft_float_type>
+      (
+        static_cast<std::uint32_t>
         (
-          static_cast<std::uint32_t>
+          n_fft >> static_cast<unsigned>(UINT8_C(1))
+        )
+      );
+
+    // Scale the coefficients that are recombined below and track
+    // their largest distance from the nearest integer. A coefficient
+    // that is too large to have fractional bits left, in which this
+    // distance could be observed, counts as the largest possible
+    // error, as does a NaN, which fails every comparison.
+    auto roundoff = static_cast<local_fft_float_type>(0);
+
+    #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+    const auto max_resolvable =
+      static_cast<local_fft_float_type>
+      (
+        static_cast<std::uintmax_t>(UINTMAX_C(1) << static_cast<unsigned>(std::numeric_limits<local_fft_float_type>::digits - 2))
+      );
+    #endif
+
+    for(auto   j = static_cast<std::int32_t>(INT8_C(0));
+               j <= recombine_size;
+             ++j)
+    {
+      af[j] = static_cast<local_fft_float_type>(af[j] / n_fft_half);
+
+      #if !defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+      if(check_roundoff)
+      {
+        using std::fabs;
+        using std::floor;
+
+        const auto err =
+          static_cast<local_fft_float_type>
           (
-            n_fft >> static_cast<unsigned>(UINT8_C(1))
-          )
-        );
+            (fabs(af[j]) < max_resolvable) ? fabs(af[j] - floor(af[j] + detail::fft::template_half<local_fft_float_type>()))
+                                           : detail::fft::template_half<local_fft_float_type>()
+          );
 
-            auto xaj   = static_cast<local_fft_float_type>(af[j] / n_fft_half);
-      const auto xlo   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xlo / local_elem_mask_half);
-      const auto nlo   = static_cast<local_limb_type>(xlo - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+        if(!(err <= roundoff))
+        {
+          roundoff = ((err <= detail::fft::template_half<local_fft_float_type>()) ? err : detail::fft::template_half<local_fft_float_type>());
+        }
+      }
+      #endif
+    }
 
-      const auto j_is_non_zero = (j != static_cast<std::uint32_t>(UINT8_C(0)));
+    #if defined(WIDE_DECIMAL_DISABLE_FFT_ROUNDOFF_CHECK)
+    static_cast<void>(check_roundoff);
+    #endif
+
+    if(!(roundoff <= max_roundoff))
+    {
+      return roundoff;
+    }
 
-                 xaj   = (j_is_non_zero ? static_cast<local_fft_float_type>(af[j - 1U] / n_fft_half) : static_cast<local_fft_float_type>(0));
-      const auto xhi   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
-                 carry = static_cast<fft_carry_type> (xhi / local_elem_mask_half);
-      const auto nhi   = static_cast<local_limb_type>(xhi - static_cast<fft_carry_type>(carry * local_elem_mask_half));
+    // Release the carries and re-combine the points of the limbs.
+    // This sets the integral data elements in the big number
+    // to the result of multiplication.
+    using fft_carry_type = std::uint_fast64_t;
 
-      r[j / 2U] = static_cast<local_limb_type>(static_cast<local_limb_type>(nhi * local_elem_mask_half) + nlo);
+    auto carry = static_cast<fft_carry_type>(UINT8_C(0));
+
+    for(auto i = prec_elems_for_multiply; i > static_cast<std::int32_t>(INT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      auto limb  = static_cast<local_limb_type>(UINT8_C(0));
+      auto scale = static_cast<local_limb_type>(UINT8_C(1));
+
+      auto j = static_cast<std::int32_t>(static_cast<std::int32_t>(i * static_cast<std::int32_t>(points_per_limb)) - static_cast<std::int32_t>(INT8_C(2)));
+
+      for(auto k = static_cast<std::uint32_t>(UINT8_C(0)); k < points_per_limb; ++k, --j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto xaj   = ((j >= static_cast<std::int32_t>(INT8_C(0))) ? af[j] : static_cast<local_fft_float_type>(0));
+        const auto xpt   = static_cast<fft_carry_type> (xaj + detail::fft::template_half<local_fft_float_type>()) + carry;
+                   carry = static_cast<fft_carry_type> (xpt / local_point_base);
+        const auto npt   = static_cast<local_limb_type>(xpt - static_cast<fft_carry_type>(carry * local_point_base));
+
+        limb  = static_cast<local_limb_type>(limb + static_cast<local_limb_type>(npt * scale));
+        scale = static_cast<local_limb_type>(scale * local_point_base);
+      }
+
+      r[i - 1] = limb;
     }
+
+    return roundoff;
   }
 
   #if(__cplusplus >= 201703L)
@@ -0,0 +1,187 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements the progress and cancellation hook of the
+// iterative functions of decwide_t. It can be removed by defining
+// WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK. The hooks then expand
+// to a constant true.
+
+#ifndef DECWIDE_T_DETAIL_PROGRESS_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_PROGRESS_2026_10_19_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #if !defined(WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK)
+
+  #include <cstdint>
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  #include <functional>
+  #include <utility>
+  #endif
+
+  // Report that the iteration of the function kind has reached
+  // digits10 of its goal of goal_digits10 decimal digits.
+  // This is false if the calculation has been cancelled.
+  #define WIDE_DECIMAL_PROGRESS(kind, digits10, goal_digits10) (progress::detail::notify(progress::function_kind::kind, static_cast<std::int32_t>(digits10), static_cast<std::int32_t>(goal_digits10))) // NOLINT(cppcoreguidelines-macro-usage)
+
+  // Do not report or cancel until the end of the enclosing scope.
+  #define WIDE_DECIMAL_PROGRESS_SUSPEND() const progress::detail::suspend_scope wide_decimal_progress_suspend_scope { } // NOLINT(cppcoreguidelines-macro-usage)
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::progress {
+  #else
+  namespace math { namespace wide_decimal { namespace progress { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  enum class function_kind : std::uint8_t
+  {
+    pi,
+    ln_two,
+    log,
+    exp,
+    inv,
+    sqrt,
+    rootn_inv
+  };
+
+  // The progress of an iteration: the decimal digits reached
+  // so far and those at which the iteration is finished.
+  struct report
+  {
+    function_kind kind          { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t  digits10      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::int32_t  goal_digits10 { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // The callback returns true in order to continue and false
+  // in order to cancel the calculation.
+  #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+  using callback_type = std::function<bool(const report&)>;
+  #else
+  using callback_type = bool(*)(const report&);
+  #endif
+
+  namespace detail {
+
+  struct thread_state
+  {
+    const callback_type* p_callback { nullptr }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool                 cancelled  { false };   // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint32_t        suspended  { };         // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  inline auto this_thread_state() -> thread_state&
+  {
+    thread_local thread_state my_state { };
+
+    return my_state;
+  }
+
+  // Once cancelled, every further iteration of the scope
+  // is refused, so that the enclosing functions end, too.
+  inline auto notify(const function_kind kind, const std::int32_t digits10, const std::int32_t goal_digits10) -> bool
+  {
+    thread_state& s = this_thread_state();
+
+    if((s.p_callback == nullptr) || (s.suspended != static_cast<std::uint32_t>(UINT8_C(0))))
+    {
+      return true;
+    }
+
+    if((!s.cancelled) && (!(*s.p_callback)(report { kind, digits10, goal_digits10 })))
+    {
+      s.cancelled = true;
+    }
+
+    return (!s.cancelled);
+  }
+
+  // The cached constants are computed in full under this scope,
+  // since they are kept for all later calculations.
+  class suspend_scope
+  {
+  public:
+    suspend_scope() { ++this_thread_state().suspended; }
+
+    suspend_scope(const suspend_scope&) = delete;
+    suspend_scope(suspend_scope&&) noexcept = delete;
+
+    ~suspend_scope() { --this_thread_state().suspended; }
+
+    auto operator=(const suspend_scope&) -> suspend_scope& = delete;
+    auto operator=(suspend_scope&&) noexcept -> suspend_scope& = delete;
+  };
+
+  } // namespace detail
+
+  // The iterative functions called by this thread within the lifetime
+  // of the scope report each iteration to the callback: calc_pi(),
+  // calc_ln_two(), log(), exp(), sqrt(), rootn_inv() and the inverse.
+  // When the callback has returned false, the running functions end
+  // early, and so do all functions called later in the scope. Their
+  // results are then the values of their last iterates, which are not
+  // accurate, so cancelled() must be checked before they are used. An
+  // inner scope takes the place of the outer one until it ends.
+  class scope
+  {
+  public:
+    explicit scope(callback_type callback)
+      #if !defined(WIDE_DECIMAL_DISABLE_USE_STD_FUNCTION)
+      : my_callback          (std::move(callback)),
+      #else
+      : my_callback          (callback),
+      #endif
+        my_previous_callback (detail::this_thread_state().p_callback),
+        my_previous_cancelled(detail::this_thread_state().cancelled)
+    {
+      detail::this_thread_state().p_callback = &my_callback;
+      detail::this_thread_state().cancelled  = false;
+    }
+
+    scope() = delete;
+
+    scope(const scope&) = delete;
+    scope(scope&&) noexcept = delete;
+
+    ~scope()
+    {
+      detail::this_thread_state().p_callback = my_previous_callback;
+      detail::this_thread_state().cancelled  = my_previous_cancelled;
+    }
+
+    auto operator=(const scope&) -> scope& = delete;
+    auto operator=(scope&&) noexcept -> scope& = delete;
+
+    // True if the callback has cancelled the calculation.
+    static auto cancelled() -> bool { return detail::this_thread_state().cancelled; }
+
+  private:
+    const callback_type  my_callback;
+    const callback_type* my_previous_callback;
+    const bool           my_previous_cancelled;
+  };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::progress
+  #else
+  } // namespace progress
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+  #else
+
+  #define WIDE_DECIMAL_PROGRESS(kind, digits10, goal_digits10) (true) // NOLINT(cppcoreguidelines-macro-usage)
+  #define WIDE_DECIMAL_PROGRESS_SUSPEND() // NOLINT(cppcoreguidelines-macro-usage)
+
+  #endif // !WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK
+
+#endif // DECWIDE_T_DETAIL_PROGRESS_2026_10_19_H
@@ -0,0 +1,292 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements vectorized schoolbook multiplication kernels
+// for limbs of type std::uint32_t (base 10^8). They are selected at
+// run time for x86-64 processors supporting AVX2 or AVX-512 and
+// can be removed by defining WIDE_DECIMAL_DISABLE_SIMD_MULTIPLY.
+// Other limb types and targets use the scalar kernel.
+
+#ifndef DECWIDE_T_DETAIL_SIMD_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_T_DETAIL_SIMD_2026_10_19_H
+
+  #include <math/wide_decimal/decwide_t_detail_namespace.h>
+
+  #include <algorithm>
+  #include <cstdint>
+  #include <iterator>
+  #include <type_traits>
+
+  #if (!defined(WIDE_DECIMAL_DISABLE_SIMD_MULTIPLY) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__))
+    #define WIDE_DECIMAL_HAS_SIMD_MULTIPLY // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if defined(WIDE_DECIMAL_HAS_SIMD_MULTIPLY)
+  #include <array>
+  #include <immintrin.h>
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal::detail {
+  #else
+  namespace math { namespace wide_decimal { namespace detail { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  enum class simd_multiply_kernel : std::uint8_t
+  {
+    scalar,
+    avx2,
+    avx512
+  };
+
+  #if defined(WIDE_DECIMAL_HAS_SIMD_MULTIPLY)
+
+  // The vectorized kernels sum up a block of 4 (AVX2) or 8 (AVX-512)
+  // columns of products in 64-bit lanes and normalize the carries once
+  // at the end. Each product is below 10^16, so a column of up to 1844
+  // products fits in 64 bits. The operand b is zero-padded on both
+  // sides, so that the blocks at the edges need no masks. The scratch
+  // lives on the stack, which limits the kernels to the schoolbook range.
+  constexpr auto simd_multiply_elems_min = static_cast<std::int_fast32_t>(INT8_C(12));
+  constexpr auto simd_multiply_elems_max = static_cast<std::int_fast32_t>(INT16_C(256));
+  constexpr auto simd_multiply_elems_pad = static_cast<std::int_fast32_t>(INT8_C(8));
+
+  using simd_multiply_accumulator_type =
+    std::array<std::uint64_t, static_cast<std::size_t>((simd_multiply_elems_max * static_cast<std::int_fast32_t>(INT8_C(2))) + simd_multiply_elems_pad)>;
+
+  using simd_multiply_padded_type =
+    std::array<std::uint32_t, static_cast<std::size_t>(simd_multiply_elems_max + (simd_multiply_elems_pad * static_cast<std::int_fast32_t>(INT8_C(2))))>;
+
+  inline auto simd_multiply_kernel_detect() -> simd_multiply_kernel
+  {
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f") != 0)
+    {
+      return simd_multiply_kernel::avx512;
+    }
+
+    if(__builtin_cpu_supports("avx2") != 0)
+    {
+      return simd_multiply_kernel::avx2;
+    }
+
+    return simd_multiply_kernel::scalar;
+  }
+
+  // The processor is queried once, at the first multiplication.
+  inline auto simd_multiply_kernel_active() -> simd_multiply_kernel
+  {
+    static const simd_multiply_kernel my_kernel = simd_multiply_kernel_detect();
+
+    return my_kernel;
+  }
+
+  inline auto simd_multiply_kernel_supported(const simd_multiply_kernel kernel) -> bool
+  {
+    return (static_cast<std::uint8_t>(kernel) <= static_cast<std::uint8_t>(simd_multiply_kernel_active()));
+  }
+
+  // The lane l of the block at column k receives the products
+  // a[i] * b[k + l - i], for which b_padded is read contiguously.
+  __attribute__((target("avx2")))
+  inline auto simd_multiply_columns_avx2(      std::uint64_t*     acc,
+                                         const std::uint32_t*     a,
+                                         const std::uint32_t*     b_padded,
+                                         const std::int_fast32_t  count,
+                                         const std::int_fast32_t  acc_range) -> void
+  {
+    constexpr auto lanes = static_cast<std::int_fast32_t>(INT8_C(4));
+
+    for(auto k = static_cast<std::int_fast32_t>(INT8_C(0)); k < acc_range; k += lanes) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto i_first = (std::max)(static_cast<std::int_fast32_t>(INT8_C(0)), static_cast<std::int_fast32_t>(k - (count - static_cast<std::int_fast32_t>(INT8_C(1)))));
+      const auto i_last  = (std::min)(static_cast<std::int_fast32_t>(count - static_cast<std::int_fast32_t>(INT8_C(1))), static_cast<std::int_fast32_t>(k + (lanes - static_cast<std::int_fast32_t>(INT8_C(1)))));
+
+      __m256i sum = _mm256_setzero_si256();
+
+      const std::uint32_t* p_b = b_padded + ((simd_multiply_elems_pad + k) - i_first); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto i = i_first; i <= i_last; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const __m256i bi = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_b--))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        sum = _mm256_add_epi64(sum, _mm256_mul_epu32(_mm256_set1_epi32(static_cast<int>(a[i])), bi)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + k), sum); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  // The AVX-512 intrinsics of GCC 12 start from deliberately
+  // uninitialized vectors, which -Wmaybe-uninitialized reports.
+  #if (defined(__GNUC__) && !defined(__clang__))
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #endif
+
+  __attribute__((target("avx512f")))
+  inline auto simd_multiply_columns_avx512(      std::uint64_t*     acc,
+                                           const std::uint32_t*     a,
+                                           const std::uint32_t*     b_padded,
+                                           const std::int_fast32_t  count,
+                                           const std::int_fast32_t  acc_range) -> void
+  {
+    constexpr auto lanes = static_cast<std::int_fast32_t>(INT8_C(8));
+
+    for(auto k = static_cast<std::int_fast32_t>(INT8_C(0)); k < acc_range; k += lanes) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto i_first = (std::max)(static_cast<std::int_fast32_t>(INT8_C(0)), static_cast<std::int_fast32_t>(k - (count - static_cast<std::int_fast32_t>(INT8_C(1)))));
+      const auto i_last  = (std::min)(static_cast<std::int_fast32_t>(count - static_cast<std::int_fast32_t>(INT8_C(1))), static_cast<std::int_fast32_t>(k + (lanes - static_cast<std::int_fast32_t>(INT8_C(1)))));
+
+      __m512i sum = _mm512_setzero_si512();
+
+      const std::uint32_t* p_b = b_padded + ((simd_multiply_elems_pad + k) - i_first); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(auto i = i_first; i <= i_last; ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const __m512i bi = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_b--))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        sum = _mm512_add_epi64(sum, _mm512_mul_epu32(_mm512_set1_epi32(static_cast<int>(a[i])), bi)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      _mm512_storeu_si512(acc + k, sum); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+  }
+
+  #if (defined(__GNUC__) && !defined(__clang__))
+  #pragma GCC diagnostic pop
+  #endif
+
+  // Multiply with the given kernel. This returns false, leaving r
+  // untouched, if the kernel is scalar, not supported by the processor
+  // or if count is out of the range of the vectorized kernels.
+  inline auto eval_multiply_n_by_n_to_2n_simd(      std::uint32_t*        r,
+                                              const std::uint32_t*        a,
+                                              const std::uint32_t*        b,
+                                              const std::int_fast32_t     count,
+                                              const simd_multiply_kernel  kernel) -> bool
+  {
+    if(   (kernel == simd_multiply_kernel::scalar)
+       || (count < simd_multiply_elems_min)
+       || (count > simd_multiply_elems_max)
+       || (!simd_multiply_kernel_supported(kernel)))
+    {
+      return false;
+    }
+
+    // The column k of the accumulator receives the products a[i] * b[j]
+    // with i + j = k. It is the limb k + 1 of the result.
+    simd_multiply_accumulator_type acc;
+    simd_multiply_padded_type      b_padded;
+
+    const auto acc_range =
+      static_cast<std::int_fast32_t>
+      (
+        (count * static_cast<std::int_fast32_t>(INT8_C(2))) - static_cast<std::int_fast32_t>(INT8_C(1))
+      );
+
+    std::fill(b_padded.begin(), b_padded.begin() + simd_multiply_elems_pad, static_cast<std::uint32_t>(UINT8_C(0)));
+    std::copy(b, b + count, b_padded.begin() + simd_multiply_elems_pad); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::fill(b_padded.begin() + (simd_multiply_elems_pad + count),
+              b_padded.begin() + ((simd_multiply_elems_pad * static_cast<std::int_fast32_t>(INT8_C(2))) + count),
+              static_cast<std::uint32_t>(UINT8_C(0)));
+
+    if(kernel == simd_multiply_kernel::avx512)
+    {
+      simd_multiply_columns_avx512(acc.data(), a, b_padded.data(), count, acc_range);
+    }
+    else
+    {
+      simd_multiply_columns_avx2(acc.data(), a, b_padded.data(), count, acc_range);
+    }
+
+    constexpr auto local_elem_mask = static_cast<std::uint64_t>(UINT32_C(100000000));
+
+    auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+    for(auto   k  = static_cast<std::int_fast32_t>(acc_range - static_cast<std::int_fast32_t>(INT8_C(1)));
+               k >= static_cast<std::int_fast32_t>(INT8_C(0)); // NOLINT(altera-id-dependent-backward-branch)
+             --k)
+    {
+      const auto sum = static_cast<std::uint64_t>(acc[static_cast<std::size_t>(k)] + carry);
+
+      carry = static_cast<std::uint64_t>(sum / local_elem_mask);
+
+      r[k + static_cast<std::int_fast32_t>(INT8_C(1))] = static_cast<std::uint32_t>(sum % local_elem_mask); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    r[0U] = static_cast<std::uint32_t>(carry); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return true;
+  }
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  auto eval_multiply_n_by_n_to_2n_simd(OutputLimbIteratorType r,
+                                       InputLimbIteratorType  a,
+                                       InputLimbIteratorType  b,
+                                       const std::int_fast32_t count,
+                                       const std::true_type&) -> bool
+  {
+    return eval_multiply_n_by_n_to_2n_simd(r, a, b, count, simd_multiply_kernel_active());
+  }
+
+  #endif // WIDE_DECIMAL_HAS_SIMD_MULTIPLY
+
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  auto eval_multiply_n_by_n_to_2n_simd(OutputLimbIteratorType r,
+                                       InputLimbIteratorType  a,
+                                       InputLimbIteratorType  b,
+                                       const std::int_fast32_t count,
+                                       const std::false_type&) -> bool
+  {
+    static_cast<void>(r);
+    static_cast<void>(a);
+    static_cast<void>(b);
+    static_cast<void>(count);
+
+    return false;
+  }
+
+  // Multiply with the vectorized kernel of the processor, if there
+  // is one for the limb and iterator types. Otherwise return false.
+  template<typename InputLimbIteratorType,
+           typename OutputLimbIteratorType>
+  auto eval_multiply_n_by_n_to_2n_simd(OutputLimbIteratorType r,
+                                       InputLimbIteratorType  a,
+                                       InputLimbIteratorType  b,
+                                       const std::int_fast32_t count) -> bool
+  {
+    #if defined(WIDE_DECIMAL_HAS_SIMD_MULTIPLY)
+    using local_is_vectorizable_type =
+      std::integral_constant<bool,
+                                std::is_pointer<OutputLimbIteratorType>::value
+                             && std::is_pointer<InputLimbIteratorType>::value
+                             && std::is_same<typename std::iterator_traits<OutputLimbIteratorType>::value_type, std::uint32_t>::value
+                             && std::is_same<typename std::iterator_traits<InputLimbIteratorType>::value_type,  std::uint32_t>::value>;
+    #else
+    using local_is_vectorizable_type = std::false_type;
+    #endif
+
+    return eval_multiply_n_by_n_to_2n_simd(r, a, b, count, local_is_vectorizable_type());
+  }
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal::detail
+  #else
+  } // namespace detail
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_T_DETAIL_SIMD_2026_10_19_H
@@ -0,0 +1,660 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// This file implements decwide_vector, a container of decwide_t
+// values with struct-of-arrays layout. All mantissas of the vector
+// live in one contiguous limb slab (element-major, i.e., one element
+// after the other), whereas exponents, signs, classes and precisions
+// are held in side arrays. The elementwise kernels (add, mul, fma,
+// scale) are element-sequential: the outer loop runs over the elements
+// and each element is processed limb by limb directly on the slab,
+// with the same limb loops as decwide_t. Nothing is vectorized across
+// elements. What the batch gains is that all elements share one
+// scratch pool, so that a batch of n operations does not lead to n
+// temporaries. Non-finite elements and the rare cases that the
+// kernels decline are handed to decwide_t itself.
+
+// The slab and the side arrays are obtained from AllocatorType
+// (or std::allocator when AllocatorType is void). When dynamic memory
+// allocation is disabled, the scratch pool is a static array and
+// the caller supplies a static allocator, such as
+// util::n_slot_array_allocator, for the slab.
+
+#ifndef DECWIDE_VECTOR_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define DECWIDE_VECTOR_2026_10_19_H
+
+  #include <math/wide_decimal/decwide_t.h>
+
+  #include <util/utility/util_dynamic_array.h>
+
+  #include <algorithm>
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <limits>
+  #include <type_traits>
+
+  WIDE_DECIMAL_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_decimal {
+  #else
+  namespace math { namespace wide_decimal { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  template<const std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  class decwide_vector
+  {
+  public:
+    using value_type    = decwide_t<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>;
+    using limb_type      = typename value_type::limb_type;
+    using exponent_type  = typename value_type::exponent_type;
+    using allocator_type = typename value_type::allocator_type;
+    using size_type      = std::size_t;
+
+    static constexpr std::int32_t elem_number = value_type::decwide_t_elem_number;
+
+  private:
+    using fpclass_type = typename value_type::fpclass_type;
+
+    using limb_array_type      = util::dynamic_array<limb_type,     allocator_type>;
+    using exponent_array_type  = util::dynamic_array<exponent_type, allocator_type>;
+    using sign_array_type      = util::dynamic_array<bool,          allocator_type>;
+    using fpclass_array_type   = util::dynamic_array<fpclass_type,  allocator_type>;
+    using precision_array_type = util::dynamic_array<std::int32_t,  allocator_type>;
+
+  public:
+    // Default constructor and constructor from element count.
+    // All elements are initialized to zero.
+    explicit decwide_vector(const size_type count = static_cast<size_type>(UINT8_C(0)))
+      : my_limbs    (count * static_cast<size_type>(elem_number), static_cast<limb_type>(UINT8_C(0))),
+        my_exp      (count, static_cast<exponent_type>(INT8_C(0))),
+        my_neg      (count, false),
+        my_fpclass  (count, fpclass_type::decwide_t_finite),
+        my_prec_elem(count, elem_number) { }
+
+    // Constructor from element count and fill value.
+    decwide_vector(const size_type count, const value_type& x) : decwide_vector(count)
+    {
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < count; ++i)
+      {
+        set(i, x);
+      }
+    }
+
+    // Copy constructor.
+    decwide_vector(const decwide_vector& other) = default;
+
+    // Move constructor.
+    decwide_vector(decwide_vector&& other) noexcept = default;
+
+    // Destructor.
+    ~decwide_vector() = default;
+
+    // Copy assignment operator.
+    auto operator=(const decwide_vector& other) -> decwide_vector& // NOLINT(cert-oop54-cpp)
+    {
+      if(this != &other)
+      {
+        // The underlying dynamic arrays only assign their common
+        // length, so copy into a temporary and take it over.
+        decwide_vector tmp(other);
+
+        swap(tmp);
+      }
+
+      return *this;
+    }
+
+    // Move assignment operator.
+    auto operator=(decwide_vector&& other) -> decwide_vector& = default;
+
+    WIDE_DECIMAL_NODISCARD auto size () const noexcept -> size_type { return my_exp.size(); }
+    WIDE_DECIMAL_NODISCARD auto empty() const noexcept -> bool      { return my_exp.empty(); }
+
+    auto swap(decwide_vector& other) noexcept -> void
+    {
+      my_limbs.swap    (other.my_limbs);
+      my_exp.swap      (other.my_exp);
+      my_neg.swap      (other.my_neg);
+      my_fpclass.swap  (other.my_fpclass);
+      my_prec_elem.swap(other.my_prec_elem);
+    }
+
+    // Raw access to the limbs of the element at index i.
+    WIDE_DECIMAL_NODISCARD auto limbs(const size_type i)       -> limb_type*       { return my_limbs.data()  + (i * static_cast<size_type>(elem_number)); } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    WIDE_DECIMAL_NODISCARD auto limbs(const size_type i) const -> const limb_type* { return my_limbs.data()  + (i * static_cast<size_type>(elem_number)); } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    WIDE_DECIMAL_NODISCARD auto exponent(const size_type i) const -> exponent_type { return my_exp[i]; }
+    WIDE_DECIMAL_NODISCARD auto isneg   (const size_type i) const -> bool          { return my_neg[i]; }
+    WIDE_DECIMAL_NODISCARD auto isfinite(const size_type i) const -> bool          { return (my_fpclass[i] == fpclass_type::decwide_t_finite); }
+
+    WIDE_DECIMAL_NODISCARD auto get(const size_type i) const -> value_type
+    {
+      value_type x;
+
+      load(i, x);
+
+      return x;
+    }
+
+    auto set(const size_type i, const value_type& x) -> void
+    {
+      store(i, x);
+    }
+
+    // Elementwise this[i] += other[i] over the common length.
+    auto add(const decwide_vector& other) -> decwide_vector&
+    {
+      const auto count = (std::min)(size(), other.size());
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      limb_array_type my_kernel_pool(static_cast<size_type>(elem_number * 2));
+      #endif
+
+      value_type u;
+      value_type v;
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < count; ++i)
+      {
+        if(   (!(isfinite(i) && other.isfinite(i)))
+           || (!eval_add_n(limbs(i), my_exp[i], my_neg[i], my_prec_elem[i],
+                           other.limbs(i), other.my_exp[i], other.my_neg[i], other.my_prec_elem[i],
+                           my_kernel_pool.data())))
+        {
+          load(i, u);
+          other.load(i, v);
+
+          u += v;
+
+          store(i, u);
+        }
+      }
+
+      return *this;
+    }
+
+    // Elementwise this[i] *= other[i] over the common length.
+    auto mul(const decwide_vector& other) -> decwide_vector&
+    {
+      const auto count = (std::min)(size(), other.size());
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      limb_array_type my_kernel_pool(static_cast<size_type>(elem_number * 2));
+      #endif
+
+      value_type u;
+      value_type v;
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < count; ++i)
+      {
+        if(   (!(isfinite(i) && other.isfinite(i)))
+           || (!eval_mul_n(limbs(i), my_exp[i], my_neg[i], my_prec_elem[i],
+                           other.limbs(i), other.my_exp[i], other.my_neg[i], other.my_prec_elem[i],
+                           my_kernel_pool.data())))
+        {
+          load(i, u);
+          other.load(i, v);
+
+          u *= v;
+
+          store(i, u);
+        }
+      }
+
+      return *this;
+    }
+
+    // Elementwise this[i] += a[i] * b[i] over the common length.
+    auto fma(const decwide_vector& a, const decwide_vector& b) -> decwide_vector&
+    {
+      const auto count = (std::min)(size(), (std::min)(a.size(), b.size()));
+
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      limb_array_type my_kernel_pool(static_cast<size_type>(elem_number * 2));
+      #endif
+
+      value_type t;
+      value_type u;
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < count; ++i)
+      {
+        a.load(i, t);
+
+        if(   (!(t.isfinite() && b.isfinite(i)))
+           || (!eval_mul_n(t.my_data.data(), t.my_exp, t.my_neg, t.my_prec_elem,
+                           b.limbs(i), b.my_exp[i], b.my_neg[i], b.my_prec_elem[i],
+                           my_kernel_pool.data())))
+        {
+          b.load(i, u);
+
+          t *= u;
+        }
+
+        if(   (!(isfinite(i) && t.isfinite()))
+           || (!eval_add_n(limbs(i), my_exp[i], my_neg[i], my_prec_elem[i],
+                           t.my_data.data(), t.my_exp, t.my_neg, t.my_prec_elem,
+                           my_kernel_pool.data())))
+        {
+          load(i, u);
+
+          u += t;
+
+          store(i, u);
+        }
+      }
+
+      return *this;
+    }
+
+    // Elementwise this[i] *= s.
+    auto scale(const value_type& s) -> decwide_vector&
+    {
+      #if !defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+      limb_array_type my_kernel_pool(static_cast<size_type>(elem_number * 2));
+      #endif
+
+      value_type u;
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < size(); ++i)
+      {
+        if(   (!(isfinite(i) && s.isfinite()))
+           || (!eval_mul_n(limbs(i), my_exp[i], my_neg[i], my_prec_elem[i],
+                           s.my_data.data(), s.my_exp, s.my_neg, s.my_prec_elem,
+                           my_kernel_pool.data())))
+        {
+          load(i, u);
+
+          u *= s;
+
+          store(i, u);
+        }
+      }
+
+      return *this;
+    }
+
+    // Elementwise this[i] *= n, for an unsigned integral n.
+    template<typename UnsignedIntegralType,
+             typename std::enable_if<(   std::is_integral<UnsignedIntegralType>::value
+                                      && std::is_unsigned<UnsignedIntegralType>::value)>::type const* = nullptr>
+    auto scale(const UnsignedIntegralType n) -> decwide_vector&
+    {
+      if(static_cast<unsigned long long>(n) >= static_cast<unsigned long long>(value_type::decwide_t_elem_mask)) // NOLINT(google-runtime-int)
+      {
+        return scale(value_type(n));
+      }
+
+      value_type u;
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < size(); ++i)
+      {
+        if(   (!isfinite(i))
+           || (!eval_mul_limb(limbs(i), my_exp[i], my_prec_elem[i], static_cast<limb_type>(n))))
+        {
+          load(i, u);
+
+          u *= n;
+
+          store(i, u);
+        }
+      }
+
+      return *this;
+    }
+
+  private:
+    limb_array_type      my_limbs;      // NOLINT(readability-identifier-naming)
+    exponent_array_type  my_exp;        // NOLINT(readability-identifier-naming)
+    sign_array_type      my_neg;        // NOLINT(readability-identifier-naming)
+    fpclass_array_type   my_fpclass;    // NOLINT(readability-identifier-naming)
+    precision_array_type my_prec_elem;  // NOLINT(readability-identifier-naming)
+
+    #if defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+    static std::array<limb_type, static_cast<std::size_t>(elem_number * 2)> my_kernel_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    #endif
+
+    auto load(const size_type i, value_type& x) const -> void
+    {
+      std::copy(limbs(i),
+                limbs(i) + static_cast<std::ptrdiff_t>(elem_number), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                x.my_data.begin());
+
+      x.my_exp       = my_exp[i];
+      x.my_neg       = my_neg[i];
+      x.my_fpclass   = my_fpclass[i];
+      x.my_prec_elem = my_prec_elem[i];
+    }
+
+    auto store(const size_type i, const value_type& x) -> void
+    {
+      std::copy(x.my_data.cbegin(),
+                x.my_data.cbegin() + static_cast<std::ptrdiff_t>(elem_number),
+                limbs(i));
+
+      my_exp[i]       = x.my_exp;
+      my_neg[i]       = x.my_neg;
+      my_fpclass[i]   = x.my_fpclass;
+      my_prec_elem[i] = x.my_prec_elem;
+    }
+
+    static auto limbs_are_one_sign_neutral(const limb_type* p, const exponent_type e) -> bool
+    {
+      // This mirrors decwide_t::isone_sign_neutral() on raw limbs.
+      const auto* p_end = p + static_cast<std::ptrdiff_t>(elem_number); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if((p[0U] == static_cast<limb_type>(UINT8_C(1))) && (e == static_cast<exponent_type>(INT8_C(0)))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        return std::all_of(p + 1U, p_end, [](const limb_type& d) { return (d == static_cast<limb_type>(UINT8_C(0))); }); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,modernize-use-trailing-return-type)
+      }
+
+      if(   (p[0U] == static_cast<limb_type>(value_type::decwide_t_elem_mask - 1)) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         && (e == static_cast<exponent_type>(-value_type::decwide_t_elem_digits10)))
+      {
+        return std::all_of(p + 1U, p_end, [](const limb_type& d) { return (d == static_cast<limb_type>(value_type::decwide_t_elem_mask - 1)); }); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,modernize-use-trailing-return-type)
+      }
+
+      return false;
+    }
+
+    static auto eval_add_n(      limb_type*          u,
+                                 exponent_type&      u_exp,
+                                 bool&               u_neg,
+                                 std::int32_t&       u_prec,
+                           const limb_type*          v,
+                           const exponent_type       v_exp,
+                           const bool                v_neg,
+                           const std::int32_t        v_prec,
+                                 limb_type*          pool) -> bool
+    {
+      // Add v to the element u (in place) in the same way as
+      // decwide_t::operator+=(), using the caller's scratch pool.
+      // Operands of opposite sign are subtracted. The kernel handles
+      // every finite operand and always returns true.
+
+      const auto assign_v =
+        [&u, &u_exp, &u_neg, &u_prec, &v, &v_exp, &v_neg, &v_prec]() // NOLINT(modernize-use-trailing-return-type)
+        {
+          std::copy(v, v + static_cast<std::ptrdiff_t>(elem_number), u); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          u_exp  = v_exp;
+          u_neg  = v_neg;
+          u_prec = v_prec;
+        };
+
+      if(u[0U] == static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        assign_v();
+
+        return true;
+      }
+
+      const auto prec_elems_for_add_sub = (std::min)(u_prec, v_prec);
+
+      const auto max_delta_exp =
+        static_cast<exponent_type>
+        (
+          static_cast<exponent_type>(prec_elems_for_add_sub) * value_type::decwide_t_elem_digits10
+        );
+
+      using local_unsigned_wrap_type = detail::unsigned_wrap<typename value_type::unsigned_exponent_type, exponent_type>;
+
+      const auto ofs_exp = local_unsigned_wrap_type { u_exp } - local_unsigned_wrap_type { v_exp };
+
+      const auto ofs_is_large =
+        (ofs_exp.get_value_unsigned() >= static_cast<typename value_type::unsigned_exponent_type>(max_delta_exp));
+
+      if(   (v[0U] == static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         || ((!ofs_exp.get_is_neg()) && ofs_is_large))
+      {
+        // The result is u unchanged since v is negligible compared to u.
+        return true;
+      }
+
+      if(ofs_exp.get_is_neg() && ofs_is_large)
+      {
+        // The result is v since u is negligible compared to v.
+        assign_v();
+
+        return true;
+      }
+
+      const auto ofs =
+        static_cast<std::ptrdiff_t>
+        (
+          static_cast<std::ptrdiff_t>(ofs_exp.get_value_unsigned() / static_cast<typename value_type::unsigned_exponent_type>(value_type::decwide_t_elem_digits10))
+        );
+
+      if(u_neg == v_neg)
+      {
+        auto carry = limb_type { };
+
+        if(!ofs_exp.get_is_neg())
+        {
+          // Shift v down into the pool and add it to u.
+          std::fill(pool, pool + ofs, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          std::copy(v, v + static_cast<std::ptrdiff_t>(elem_number - ofs), pool + ofs); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          carry = detail::eval_add_n(u, static_cast<const limb_type*>(u), static_cast<const limb_type*>(pool), prec_elems_for_add_sub);
+        }
+        else
+        {
+          // Shift u down into the pool and add v to it, storing the sum in u.
+          std::fill(pool, pool + ofs, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          std::copy(u, u + static_cast<std::ptrdiff_t>(elem_number - ofs), pool + ofs); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          carry = detail::eval_add_n(u, static_cast<const limb_type*>(pool), v, prec_elems_for_add_sub);
+
+          u_exp = v_exp;
+        }
+
+        if(carry != static_cast<limb_type>(UINT8_C(0)))
+        {
+          // Shift the data to make place for the carry
+          // and adjust the exponent accordingly.
+          std::copy_backward(u,
+                             u + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(prec_elems_for_add_sub) - static_cast<std::ptrdiff_t>(INT8_C(1))), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                             u + static_cast<std::ptrdiff_t>(elem_number));                                                                                // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          u[0U] = carry; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          u_exp = static_cast<exponent_type>(u_exp + static_cast<exponent_type>(value_type::decwide_t_elem_digits10));
+        }
+
+        return true;
+      }
+
+      if(   ((!ofs_exp.get_is_neg()) && (ofs != static_cast<std::ptrdiff_t>(INT8_C(0))))
+         || (   (ofs == static_cast<std::ptrdiff_t>(INT8_C(0)))
+             && (detail::compare_ranges(u, v, static_cast<std::uint_fast32_t>(prec_elems_for_add_sub)) > static_cast<std::int_fast8_t>(INT8_C(0)))))
+      {
+        // In this case, |u| > |v|. Shift v down into
+        // the pool and subtract it from u.
+        std::fill(pool, pool + ofs, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        std::copy(v, v + static_cast<std::ptrdiff_t>(elem_number - ofs), pool + ofs); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        static_cast<void>(detail::eval_subtract_n(u, static_cast<const limb_type*>(u), static_cast<const limb_type*>(pool), prec_elems_for_add_sub));
+      }
+      else
+      {
+        // In this case, |u| <= |v|. Shift u down into the
+        // pool, subtract it from v and store the difference in u.
+        std::fill(pool, pool + ofs, static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        std::copy(u, u + static_cast<std::ptrdiff_t>(elem_number - ofs), pool + ofs); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        static_cast<void>(detail::eval_subtract_n(u, v, static_cast<const limb_type*>(pool), prec_elems_for_add_sub));
+
+        u_exp = v_exp;
+        u_neg = v_neg;
+      }
+
+      // Justify the data if the leading limbs have been cancelled.
+      const auto* first_nonzero_limb =
+        std::find_if(static_cast<const limb_type*>(u),
+                     static_cast<const limb_type*>(u) + static_cast<std::ptrdiff_t>(prec_elems_for_add_sub), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                     [](const limb_type& d) // NOLINT(modernize-use-trailing-return-type)
+                     {
+                       return (d != static_cast<limb_type>(UINT8_C(0)));
+                     });
+
+      const auto sj = static_cast<std::ptrdiff_t>(first_nonzero_limb - u);
+
+      if(sj == static_cast<std::ptrdiff_t>(prec_elems_for_add_sub))
+      {
+        // The result of the subtraction is exactly zero (within precision).
+        std::fill(u, u + static_cast<std::ptrdiff_t>(elem_number), static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        u_exp  = static_cast<exponent_type>(INT8_C(0));
+        u_neg  = false;
+        u_prec = elem_number;
+      }
+      else if(sj != static_cast<std::ptrdiff_t>(INT8_C(0)))
+      {
+        std::copy(u + sj, u + static_cast<std::ptrdiff_t>(elem_number), u); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        std::fill(u + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(elem_number) - sj), u + static_cast<std::ptrdiff_t>(elem_number), static_cast<limb_type>(UINT8_C(0))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        u_exp = static_cast<exponent_type>(u_exp - static_cast<exponent_type>(static_cast<exponent_type>(sj) * static_cast<exponent_type>(value_type::decwide_t_elem_digits10)));
+      }
+
+      return true;
+    }
+
+    static auto eval_mul_n(      limb_type*          u,
+                                 exponent_type&      u_exp,
+                                 bool&               u_neg,
+                           const std::int32_t        u_prec,
+                           const limb_type*          v,
+                           const exponent_type       v_exp,
+                           const bool                v_neg,
+                           const std::int32_t        v_prec,
+                                 limb_type*          pool) -> bool
+    {
+      // Multiply the element u (in place) by v with the schoolbook kernel
+      // of decwide_t, using the caller's scratch pool. Zero and unit
+      // operands, exponent overflow/underflow and precisions that call
+      // for Karatsuba or FFT are declined (return false) and left to the
+      // full decwide_t multiplication.
+
+      const auto prec_elems_for_multiply = (std::min)(u_prec, v_prec);
+
+      if(   (prec_elems_for_multiply >= value_type::elems_for_kara())
+         || (u[0U] == static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         || (v[0U] == static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         || limbs_are_one_sign_neutral(u, u_exp)
+         || limbs_are_one_sign_neutral(v, v_exp))
+      {
+        return false;
+      }
+
+      using local_unsigned_wrap_type = detail::unsigned_wrap<typename value_type::unsigned_exponent_type, exponent_type>;
+
+      const auto result_exp = local_unsigned_wrap_type { u_exp } + local_unsigned_wrap_type { v_exp };
+
+      if(result_exp.get_value_unsigned() >= value_type::decwide_t_max_exp10)
+      {
+        return false;
+      }
+
+      u_exp =
+        static_cast<exponent_type>
+        (
+          (!result_exp.get_is_neg())
+            ?                static_cast<exponent_type>(result_exp.get_value_unsigned())
+            : detail::negate(static_cast<exponent_type>(result_exp.get_value_unsigned()))
+        );
+
+      detail::eval_multiply_n_by_n_to_2n(pool, static_cast<const limb_type*>(u), v, prec_elems_for_multiply);
+
+      // Handle a potential carry.
+      if(pool[0U] != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        u_exp = static_cast<exponent_type>(u_exp + static_cast<exponent_type>(value_type::decwide_t_elem_digits10));
+
+        std::copy(pool, pool + static_cast<std::ptrdiff_t>(prec_elems_for_multiply), u); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+      else
+      {
+        std::copy(pool + static_cast<std::ptrdiff_t>(INT8_C(1)),                                                                       // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  pool + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(INT8_C(1)) + prec_elems_for_multiply), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                  u);
+      }
+
+      u_neg = (u_neg != v_neg);
+
+      return true;
+    }
+
+    static auto eval_mul_limb(limb_type* u, exponent_type& u_exp, const std::int32_t u_prec, const limb_type n) -> bool
+    {
+      // Multiply the element u (in place) by a single limb n,
+      // in the same way as decwide_t::mul_unsigned_long_long().
+      // Zero, unit multipliers and exponent overflow are declined.
+
+      if(   (u[0U] == static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+         || (n <= static_cast<limb_type>(UINT8_C(1)))
+         || (u_exp >= static_cast<exponent_type>(value_type::decwide_t_max_exp10 - static_cast<exponent_type>(std::numeric_limits<limb_type>::digits10 + 1))))
+      {
+        return false;
+      }
+
+      const auto carry = detail::mul_loop_n(u, n, u_prec);
+
+      // Handle the carry and adjust the exponent.
+      if(carry != static_cast<limb_type>(UINT8_C(0)))
+      {
+        u_exp = static_cast<exponent_type>(u_exp + static_cast<exponent_type>(value_type::decwide_t_elem_digits10));
+
+        // Shift the result of the multiplication one element to the right.
+        std::copy_backward(u,
+                           u + static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(u_prec) - static_cast<std::ptrdiff_t>(INT8_C(1))), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                           u + static_cast<std::ptrdiff_t>(u_prec));                                                                      // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        u[0U] = static_cast<limb_type>(carry); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      return true;
+    }
+  };
+
+  template<const std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  constexpr std::int32_t decwide_vector<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_number;
+
+  #if defined(WIDE_DECIMAL_DISABLE_DYNAMIC_MEMORY_ALLOCATION)
+  template<const std::int32_t ParamDigitsBaseTen,
+           typename LimbType,
+           typename AllocatorType,
+           typename InternalFloatType,
+           typename ExponentType,
+           typename FftFloatType>
+  std::array<typename decwide_vector<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::limb_type, static_cast<std::size_t>(decwide_vector<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::elem_number * 2)> decwide_vector<ParamDigitsBaseTen, LimbType, AllocatorType, InternalFloatType, ExponentType, FftFloatType>::my_kernel_pool; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  #endif
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_decimal
+  #else
+  } // namespace wide_decimal
+  } // namespace math
+  #endif
+
+  WIDE_DECIMAL_NAMESPACE_END
+
+#endif // DECWIDE_VECTOR_2026_10_19_H
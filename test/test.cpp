@@ -12,7 +12,7 @@
 // On Windows Subsystem for LINUX
 // cd /mnt/c/Users/ckorm/Documents/Ks/PC_Software/NumericalPrograms/ExtendedNumberTypes/wide_decimal
 // When using g++ and -std=c++20 (also with -DWIDE_DECIMAL_NAMESPACE=ckormanyos)
-// g++ -march=native -mtune=native -O3 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -Wshadow -Wunused-parameter -Wuninitialized -Wunreachable-code -Winit-self -Wzero-as-null-pointer-constant -std=c++20 -DWIDE_DECIMAL_NAMESPACE=ckormanyos -I. -I/mnt/c/boost/boost_1_90_0 -pthread -lpthread test/test.cpp test/test_decwide_t_algebra.cpp test/test_decwide_t_algebra_edge.cpp test/test_decwide_t_examples.cpp examples/example000a_multiply_pi_squared.cpp examples/example000_multiply_nines.cpp examples/example001_roots_sqrt.cpp examples/example001a_roots_seventh.cpp examples/example001b_roots_almost_integer.cpp examples/example001c_roots_sqrt_limb08.cpp examples/example001d_pow2_from_list.cpp  examples/example001e_algebra_and_constexpr.cpp examples/example002_pi.cpp examples/example002a_pi_small_limb.cpp examples/example002b_pi_100k.cpp examples/example002c_pi_quintic.cpp examples/example002d_pi_limb08.cpp examples/example003_zeta.cpp examples/example004_bessel_recur.cpp examples/example005_polylog_series.cpp examples/example006_logarithm.cpp examples/example007_catalan_series.cpp examples/example008_bernoulli_tgamma.cpp examples/example009_boost_math_standalone.cpp examples/example009a_boost_math_standalone.cpp examples/example009b_boost_math_standalone.cpp examples/example010_hypergeometric_2f1.cpp examples/example010a_hypergeometric_1f1.cpp examples/example011_trig_trapezoid_integral.cpp examples/example012_rational_floor_ceil.cpp examples/example013_embeddable_sqrt.cpp examples/example013a_embeddable_agm.cpp -o wide_decimal.exe
+// g++ -march=native -mtune=native -O3 -Werror -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -Wshadow -Wunused-parameter -Wuninitialized -Wunreachable-code -Winit-self -Wzero-as-null-pointer-constant -std=c++20 -DWIDE_DECIMAL_NAMESPACE=ckormanyos -I. -I/mnt/c/boost/boost_1_90_0 -pthread -lpthread test/test.cpp test/test_decwide_t_algebra.cpp test/test_decwide_t_algebra_edge.cpp test/test_decwide_t_binary_limbs.cpp test/test_decwide_t_chars_batch.cpp test/test_decwide_t_checkpoint.cpp test/test_decwide_t_examples.cpp test/test_decwide_t_fft_packing.cpp test/test_decwide_t_fft_roundoff.cpp test/test_decwide_t_float_conv.cpp test/test_decwide_t_pmr.cpp test/test_decwide_t_progress.cpp test/test_decwide_t_raw_limbs.cpp test/test_decwide_t_rvalue_ops.cpp test/test_decwide_t_serialize.cpp test/test_decwide_t_shared_rep.cpp test/test_decwide_t_simd.cpp test/test_decwide_t_slot_alloc.cpp test/test_decwide_t_thread_pool.cpp test/test_decwide_t_thresholds.cpp test/test_decwide_t_to_chars.cpp test/test_decwide_t_tracking.cpp test/test_decwide_t_uint64_limbs.cpp test/test_decwide_t_vector.cpp test/test_decwide_t_write_digits.cpp examples/example000a_multiply_pi_squared.cpp examples/example000_multiply_nines.cpp examples/example001_roots_sqrt.cpp examples/example001a_roots_seventh.cpp examples/example001b_roots_almost_integer.cpp examples/example001c_roots_sqrt_limb08.cpp examples/example001d_pow2_from_list.cpp  examples/example001e_algebra_and_constexpr.cpp examples/example002_pi.cpp examples/example002a_pi_small_limb.cpp examples/example002b_pi_100k.cpp examples/example002c_pi_quintic.cpp examples/example002d_pi_limb08.cpp examples/example003_zeta.cpp examples/example004_bessel_recur.cpp examples/example005_polylog_series.cpp examples/example006_logarithm.cpp examples/example007_catalan_series.cpp examples/example008_bernoulli_tgamma.cpp examples/example009_boost_math_standalone.cpp examples/example009a_boost_math_standalone.cpp examples/example009b_boost_math_standalone.cpp examples/example010_hypergeometric_2f1.cpp examples/example010a_hypergeometric_1f1.cpp examples/example011_trig_trapezoid_integral.cpp examples/example012_rational_floor_ceil.cpp examples/example013_embeddable_sqrt.cpp examples/example013a_embeddable_agm.cpp -o wide_decimal.exe
 
 // cd .tidy/make
 // make prepare -f make_tidy_01_generic.gmk MY_BOOST_ROOT=/mnt/c/boost/boost_1_90_0
@@ -25,104 +25,605 @@
 
 // cd /mnt/c/Users/ckorm/Documents/Ks/PC_Software/NumericalPrograms/ExtendedNumberTypes/wide_decimal
 // PATH=/home/chris/coverity/cov-analysis-linux64-2023.12.2/bin:$PATH
-// cov-build --dir cov-int g++ -fno-rtti -fno-exceptions -finline-functions -finline-limit=64 -march=native -mtune=native -O3 -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -Wshadow -Wunused-parameter -Wuninitialized -Wunreachable-code -Winit-self -Wzero-as-null-pointer-constant -std=c++20 -DWIDE_DECIMAL_NAMESPACE=ckormanyos -I. -I/mnt/c/boost/boost_1_90_0 -pthread -lpthread test/test.cpp test/test_decwide_t_algebra.cpp test/test_decwide_t_algebra_edge.cpp test/test_decwide_t_examples.cpp examples/example000a_multiply_pi_squared.cpp examples/example000_multiply_nines.cpp examples/example001_roots_sqrt.cpp examples/example001a_roots_seventh.cpp examples/example001b_roots_almost_integer.cpp examples/example001c_roots_sqrt_limb08.cpp examples/example001d_pow2_from_list.cpp examples/example001e_algebra_and_constexpr.cpp examples/example002_pi.cpp examples/example002a_pi_small_limb.cpp examples/example002b_pi_100k.cpp examples/example002c_pi_quintic.cpp examples/example002d_pi_limb08.cpp examples/example003_zeta.cpp examples/example004_bessel_recur.cpp examples/example005_polylog_series.cpp examples/example006_logarithm.cpp examples/example007_catalan_series.cpp examples/example008_bernoulli_tgamma.cpp examples/example009_boost_math_standalone.cpp examples/example009a_boost_math_standalone.cpp examples/example009b_boost_math_standalone.cpp examples/example010_hypergeometric_2f1.cpp examples/example010a_hypergeometric_1f1.cpp examples/example011_trig_trapezoid_integral.cpp examples/example012_rational_floor_ceil.cpp examples/example013_embeddable_sqrt.cpp examples/example013a_embeddable_agm.cpp -o wide_decimal.exe
+// cov-build --dir cov-int g++ -fno-rtti -fno-exceptions -finline-functions -finline-limit=64 -march=native -mtune=native -O3 -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -Wshadow -Wunused-parameter -Wuninitialized -Wunreachable-code -Winit-self -Wzero-as-null-pointer-constant -std=c++20 -DWIDE_DECIMAL_NAMESPACE=ckormanyos -I. -I/mnt/c/boost/boost_1_90_0 -pthread -lpthread test/test.cpp test/test_decwide_t_algebra.cpp test/test_decwide_t_algebra_edge.cpp test/test_decwide_t_binary_limbs.cpp test/test_decwide_t_chars_batch.cpp test/test_decwide_t_checkpoint.cpp test/test_decwide_t_examples.cpp test/test_decwide_t_fft_packing.cpp test/test_decwide_t_fft_roundoff.cpp test/test_decwide_t_float_conv.cpp test/test_decwide_t_pmr.cpp test/test_decwide_t_progress.cpp test/test_decwide_t_raw_limbs.cpp test/test_decwide_t_rvalue_ops.cpp test/test_decwide_t_serialize.cpp test/test_decwide_t_shared_rep.cpp test/test_decwide_t_simd.cpp test/test_decwide_t_slot_alloc.cpp test/test_decwide_t_thread_pool.cpp test/test_decwide_t_thresholds.cpp test/test_decwide_t_to_chars.cpp test/test_decwide_t_tracking.cpp test/test_decwide_t_uint64_limbs.cpp test/test_decwide_t_vector.cpp test/test_decwide_t_write_digits.cpp examples/example000a_multiply_pi_squared.cpp examples/example000_multiply_nines.cpp examples/example001_roots_sqrt.cpp examples/example001a_roots_seventh.cpp examples/example001b_roots_almost_integer.cpp examples/example001c_roots_sqrt_limb08.cpp examples/example001d_pow2_from_list.cpp examples/example001e_algebra_and_constexpr.cpp examples/example002_pi.cpp examples/example002a_pi_small_limb.cpp examples/example002b_pi_100k.cpp examples/example002c_pi_quintic.cpp examples/example002d_pi_limb08.cpp examples/example003_zeta.cpp examples/example004_bessel_recur.cpp examples/example005_polylog_series.cpp examples/example006_logarithm.cpp examples/example007_catalan_series.cpp examples/example008_bernoulli_tgamma.cpp examples/example009_boost_math_standalone.cpp examples/example009a_boost_math_standalone.cpp examples/example009b_boost_math_standalone.cpp examples/example010_hypergeometric_2f1.cpp examples/example010a_hypergeometric_1f1.cpp examples/example011_trig_trapezoid_integral.cpp examples/example012_rational_floor_ceil.cpp examples/example013_embeddable_sqrt.cpp examples/example013a_embeddable_agm.cpp -o wide_decimal.exe
 // tar caf wide-decimal.bz2 cov-int
 
+// The test runner accepts these options:
+//   --list             print the names of the selected tests and exit
+//   --filter=PATTERNS  run only the tests whose names match one of the
+//                      ':'-separated glob patterns ('*' and '?'), except
+//                      those matching a pattern after a '-', as in
+//                      --filter=example00*:-example002*
+//   --jobs=N           run up to N tests concurrently (default 1,
+//                      0 for one per hardware thread)
+//   --shard=K/N        run only shard K (counting from 0) of N disjoint shards of the
+//                      selected tests, for instance in N processes
+//   --timings=FILE     read the times of a previous --json report, so that
+//                      the longest tests start first and the shards are balanced
+//   --junit=FILE       write the results as JUnit XML
+//   --json=FILE        write the results as JSON
+// Tests of the same group share static state, and they never run
+// at the same time. Exclusive tests change process-wide state, such as
+// the default memory resource or the multiplication thresholds, and they
+// run alone before all other tests. Without options, all tests run one
+// after another.
+
 #include <test/stopwatch.h>
 #include <test/test_decwide_t_algebra.h>
 #include <test/test_decwide_t_examples.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_thread_pool.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <ctime>
+#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <numeric>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace local
 {
-  auto run() -> bool;
+  struct test_case
+  {
+    std::string           name      { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::function<bool()> function  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::string           group     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    double                weight    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool                  exclusive { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct test_result
+  {
+    std::string name  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool        is_ok { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    double      time  { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  struct options
+  {
+    bool        list        { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+    std::string filter      { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned    jobs        { static_cast<unsigned>(UINT8_C(1)) };  // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned    shard_index { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned    shard_count { static_cast<unsigned>(UINT8_C(1)) };  // NOLINT(misc-non-private-member-variables-in-classes)
+    std::string timings     { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+    std::string junit       { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+    std::string json        { };                                    // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // Tests of one group run in order as one task of the scheduler.
+  struct test_task
+  {
+    std::vector<std::size_t> indices   { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    double                   weight    { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    bool                     exclusive { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  auto run(const options& opts) -> bool;
+
+  auto parse_options(const int argc, char** argv, options& opts) -> bool // NOLINT(readability-function-cognitive-complexity)
+  {
+    for(auto i = 1; i < argc; ++i)
+    {
+      const std::string arg(argv[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      if     (arg == "--list")                { opts.list    = true; }
+      else if(arg.find("--filter=")  == 0U)   { opts.filter  = arg.substr(9U); }  // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      else if(arg.find("--timings=") == 0U)   { opts.timings = arg.substr(10U); } // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      else if(arg.find("--junit=")   == 0U)   { opts.junit   = arg.substr(8U); }  // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      else if(arg.find("--json=")    == 0U)   { opts.json    = arg.substr(7U); }  // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+      else if(arg.find("--jobs=")    == 0U)
+      {
+        std::stringstream strm(arg.substr(7U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        if(!(strm >> opts.jobs)) { return false; }
+
+        if(opts.jobs == static_cast<unsigned>(UINT8_C(0)))
+        {
+          opts.jobs = util::thread_pool::default_number_of_workers();
+        }
+      }
+      else if(arg.find("--shard=") == 0U)
+      {
+        std::stringstream strm(arg.substr(8U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        auto separator = char { };
+
+        if(   (!(strm >> opts.shard_index >> separator >> opts.shard_count))
+           || (separator != '/')
+           || (opts.shard_index >= opts.shard_count))
+        {
+          return false;
+        }
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  // Match a name against a glob pattern with '*' and '?'.
+  auto glob_match(const std::string& pattern, const std::string& name) -> bool
+  {
+    auto p = static_cast<std::size_t>(UINT8_C(0));
+    auto n = static_cast<std::size_t>(UINT8_C(0));
+
+    auto star_p = std::string::npos;
+    auto star_n = static_cast<std::size_t>(UINT8_C(0));
+
+    while(n < name.length())
+    {
+      if((p < pattern.length()) && ((pattern[p] == '?') || (pattern[p] == name[n])))
+      {
+        ++p;
+        ++n;
+      }
+      else if((p < pattern.length()) && (pattern[p] == '*'))
+      {
+        star_p = p++;
+        star_n = n;
+      }
+      else if(star_p != std::string::npos)
+      {
+        p = star_p + 1U;
+        n = ++star_n;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    while((p < pattern.length()) && (pattern[p] == '*')) { ++p; }
+
+    return (p == pattern.length());
+  }
+
+  auto name_is_selected(const std::string& filter, const std::string& name) -> bool
+  {
+    if(filter.empty())
+    {
+      return true;
+    }
+
+    const auto minus = filter.find('-');
+
+    const auto positive = filter.substr(static_cast<std::size_t>(UINT8_C(0)), minus);
+    const auto negative = ((minus == std::string::npos) ? std::string { } : filter.substr(minus + 1U));
+
+    const auto matches_one_of =
+      [&name](const std::string& patterns)
+      {
+        std::stringstream strm(patterns);
+
+        std::string pattern { };
+
+        while(std::getline(strm, pattern, ':'))
+        {
+          if((!pattern.empty()) && glob_match(pattern, name)) { return true; }
+        }
+
+        return false;
+      };
+
+    return ((positive.empty() || matches_one_of(positive)) && (!matches_one_of(negative)));
+  }
+
+  auto all_test_cases() -> std::vector<test_case>
+  {
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_entries;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_edge____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_add_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_sub_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_mul_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_div_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_sqrt____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_log_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_vector__________;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_slot_alloc______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_pmr_____________;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_shared_rep______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_rvalue_ops______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_to_chars________;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_write_digits____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_serialize_______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_checkpoint______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_binary_limbs____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_float_conv______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_chars_batch_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_raw_limbs_______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_thresholds______;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_fft_roundoff____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_fft_packing_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_thread_pool_____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_tracking________;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_progress________;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_uint64_limbs____;
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_simd____________;
+    #endif
+
+    std::vector<test_case> cases { };
+
+    for(const auto& entry : test_decwide_t_examples_entries())
+    {
+      cases.push_back({ entry.name, entry.function, entry.group, 0.0, false });
+    }
+
+    // The algebra tests draw from the same random engines of the control.
+    cases.push_back({ "test_decwide_t_algebra_edge", test_decwide_t_algebra_edge____, "",        0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_add",  test_decwide_t_algebra_add_____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_sub",  test_decwide_t_algebra_sub_____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_mul",  test_decwide_t_algebra_mul_____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_div",  test_decwide_t_algebra_div_____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_sqrt", test_decwide_t_algebra_sqrt____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_algebra_log",  test_decwide_t_algebra_log_____, "algebra", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+
+    // The tests of the features have random engines of their own.
+    // The tests of polymorphic allocators, the allocation tracker, the
+    // multiplication thresholds and the FFT round-off check change
+    // process-wide state, so they run alone.
+    cases.push_back({ "test_decwide_t_vector",       test_decwide_t_vector__________, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_slot_alloc",   test_decwide_t_slot_alloc______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_pmr",          test_decwide_t_pmr_____________, "", 0.0, true  }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_shared_rep",   test_decwide_t_shared_rep______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_rvalue_ops",   test_decwide_t_rvalue_ops______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_to_chars",     test_decwide_t_to_chars________, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_write_digits", test_decwide_t_write_digits____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_serialize",    test_decwide_t_serialize_______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_checkpoint",   test_decwide_t_checkpoint______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_binary_limbs", test_decwide_t_binary_limbs____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_float_conv",   test_decwide_t_float_conv______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_chars_batch",  test_decwide_t_chars_batch_____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_raw_limbs",    test_decwide_t_raw_limbs_______, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_thresholds",   test_decwide_t_thresholds______, "", 0.0, true  }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_fft_roundoff", test_decwide_t_fft_roundoff____, "", 0.0, true  }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_fft_packing",  test_decwide_t_fft_packing_____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_thread_pool",  test_decwide_t_thread_pool_____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_tracking",     test_decwide_t_tracking________, "", 0.0, true  }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_progress",     test_decwide_t_progress________, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_uint64_limbs", test_decwide_t_uint64_limbs____, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+    cases.push_back({ "test_decwide_t_simd",         test_decwide_t_simd____________, "", 0.0, false }); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+
+    return cases;
+  }
+
+  // Read the times of a JSON report written by write_json(),
+  // in which each test is on a line of its own.
+  auto read_timings(const std::string& file_name, std::vector<test_case>& cases) -> bool
+  {
+    std::ifstream in(file_name);
+
+    if(!in.is_open())
+    {
+      return false;
+    }
+
+    std::map<std::string, double> times { };
+
+    std::string line { };
+
+    while(std::getline(in, line))
+    {
+      const auto pos_name = line.find("\"name\": \"");
+      const auto pos_time = line.find("\"time\": ");
+
+      if((pos_name != std::string::npos) && (pos_time != std::string::npos))
+      {
+        const auto first = pos_name + 9U; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        std::stringstream strm(line.substr(pos_time + 8U)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+        auto time = 0.0;
 
-  template<typename RunnerFunctionType>
-  auto pfn_runner(const RunnerFunctionType& pfn_test, const char* p_msg) -> bool
+        if(strm >> time)
+        {
+          times[line.substr(first, line.find('"', first) - first)] = time;
+        }
+      }
+    }
+
+    for(auto& tc : cases)
+    {
+      const auto it = times.find(tc.name);
+
+      if(it != times.cend()) { tc.weight = it->second; }
+    }
+
+    return true;
+  }
+
+  // Gather the tests into tasks, one per group, and sort
+  // them so that the longest tasks start first.
+  auto make_tasks(const std::vector<test_case>& cases) -> std::vector<test_task>
   {
-    using stopwatch_type = concurrency::stopwatch;
+    std::vector<test_task> tasks { };
 
-    stopwatch_type my_stopwatch { };
+    std::map<std::string, std::size_t> task_of_group { };
 
-    const auto result_test_is_ok = pfn_test();
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < cases.size(); ++index)
+    {
+      const auto& tc = cases[index];
 
-    const float execution_time { stopwatch_type::elapsed_time<float>(my_stopwatch) };
+      const auto it = task_of_group.find(tc.group);
 
+      if(tc.group.empty() || (it == task_of_group.cend()))
+      {
+        if(!tc.group.empty()) { task_of_group[tc.group] = tasks.size(); }
+
+        tasks.push_back({ { index }, tc.weight, tc.exclusive });
+      }
+      else
+      {
+        tasks[it->second].indices.push_back(index);
+        tasks[it->second].weight += tc.weight;
+        tasks[it->second].exclusive = (tasks[it->second].exclusive || tc.exclusive);
+      }
+    }
+
+    std::stable_sort(tasks.begin(),
+                     tasks.end(),
+                     [](const test_task& a, const test_task& b) { return (a.weight > b.weight); });
+
+    return tasks;
+  }
+
+  // Keep the tasks of one shard. The tasks are dealt out to the shards
+  // in turn, or, when their times are known, each to the shard with
+  // the least time so far. All processes make the same choice.
+  auto select_shard(const std::vector<test_task>& tasks, const unsigned shard_index, const unsigned shard_count) -> std::vector<test_task>
+  {
+    const auto times_are_known =
+      std::any_of(tasks.cbegin(), tasks.cend(), [](const test_task& t) { return (t.weight > 0.0); });
+
+    std::vector<double> load(static_cast<std::size_t>(shard_count), 0.0);
+
+    std::vector<test_task> selected { };
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < tasks.size(); ++index)
     {
-      std::stringstream strm { };
+      const auto shard =
+        (times_are_known
+          ? static_cast<std::size_t>(std::distance(load.cbegin(), std::min_element(load.cbegin(), load.cend())))
+          : static_cast<std::size_t>(index % static_cast<std::size_t>(shard_count)));
 
-      strm << p_msg
-           << std::boolalpha
-           << result_test_is_ok
-           << ", time: "
-           << std::fixed
-           << std::setprecision(1)
-           << execution_time
-           << "s"
-           ;
+      load[shard] += tasks[index].weight;
 
-      std::cout << strm.str() << std::endl;
+      if(shard == static_cast<std::size_t>(shard_index))
+      {
+        selected.push_back(tasks[index]);
+      }
     }
 
-    return result_test_is_ok;
+    return selected;
+  }
+
+  auto run_tasks(const std::vector<test_case>& cases, const std::vector<test_task>& tasks, const unsigned jobs) -> std::vector<test_result>
+  {
+    std::vector<test_result> results(cases.size());
+
+    std::mutex print_mutex { };
+
+    const auto run_task =
+      [&cases, &tasks, &results, &print_mutex](const std::size_t task_index)
+      {
+        for(const auto index : tasks[task_index].indices)
+        {
+          using stopwatch_type = concurrency::stopwatch;
+
+          stopwatch_type my_stopwatch { };
+
+          const auto result_test_is_ok = cases[index].function();
+
+          results[index] = { cases[index].name, result_test_is_ok, stopwatch_type::elapsed_time<double>(my_stopwatch) };
+
+          std::stringstream strm { };
+
+          strm << std::left
+               << std::setw(36)
+               << cases[index].name
+               << ": "
+               << std::boolalpha
+               << result_test_is_ok
+               << ", time: "
+               << std::fixed
+               << std::setprecision(1)
+               << results[index].time
+               << "s"
+               ;
+
+          const std::lock_guard<std::mutex> lock(print_mutex);
+
+          std::cout << strm.str() << std::endl;
+        }
+      };
+
+    // The exclusive tasks run alone, before all of the others.
+    std::vector<std::size_t> shared_task_indices { };
+
+    for(auto task_index = static_cast<std::size_t>(UINT8_C(0)); task_index < tasks.size(); ++task_index)
+    {
+      if(tasks[task_index].exclusive) { run_task(task_index); }
+      else                            { shared_task_indices.push_back(task_index); }
+    }
+
+    if(jobs == static_cast<unsigned>(UINT8_C(1)))
+    {
+      for(const auto task_index : shared_task_indices)
+      {
+        run_task(task_index);
+      }
+    }
+    else
+    {
+      util::thread_pool pool(jobs);
+
+      pool.parallel_for(static_cast<std::size_t>(UINT8_C(0)),
+                        shared_task_indices.size(),
+                        [&run_task, &shared_task_indices](const std::size_t i) { run_task(shared_task_indices[i]); },
+                        static_cast<std::size_t>(UINT8_C(1)));
+    }
+
+    // Keep the results of the tests that were run, in the order of the tests.
+    std::vector<test_result> results_of_run { };
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < cases.size(); ++index)
+    {
+      if(!results[index].name.empty()) { results_of_run.push_back(results[index]); }
+    }
+
+    return results_of_run;
+  }
+
+  auto write_junit(std::ostream& os, const std::vector<test_result>& results, const double total_time) -> void
+  {
+    const auto failures = std::count_if(results.cbegin(), results.cend(), [](const test_result& r) { return (!r.is_ok); });
+
+    os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+       << std::fixed
+       << std::setprecision(3)
+       << "<testsuites tests=\"" << results.size() << "\" failures=\"" << failures << "\" time=\"" << total_time << "\">\n"
+       << "  <testsuite name=\"wide_decimal\" tests=\"" << results.size() << "\" failures=\"" << failures << "\" time=\"" << total_time << "\">\n";
+
+    for(const auto& r : results)
+    {
+      os << "    <testcase classname=\"wide_decimal\" name=\"" << r.name << "\" time=\"" << r.time << "\"";
+
+      if(r.is_ok)
+      {
+        os << "/>\n";
+      }
+      else
+      {
+        os << ">\n"
+           << "      <failure message=\"result_is_ok: false\"/>\n"
+           << "    </testcase>\n";
+      }
+    }
+
+    os << "  </testsuite>\n"
+       << "</testsuites>\n";
+  }
+
+  auto write_json(std::ostream& os, const std::vector<test_result>& results, const bool result_is_ok, const double total_time) -> void
+  {
+    os << "{\n"
+       << std::fixed
+       << std::setprecision(3)
+       << "  \"result\": " << std::boolalpha << result_is_ok << ",\n"
+       << "  \"time\": " << total_time << ",\n"
+       << "  \"tests\":\n"
+       << "  [\n";
+
+    for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < results.size(); ++index)
+    {
+      os << "    { \"name\": \"" << results[index].name << "\", \"result\": " << results[index].is_ok << ", \"time\": " << results[index].time << " }"
+         << (((index + 1U) < results.size()) ? ",\n" : "\n");
+    }
+
+    os << "  ]\n"
+       << "}\n";
+  }
+
+  template<typename WriterFunctionType>
+  auto write_report(const std::string& file_name, WriterFunctionType writer) -> bool
+  {
+    if(file_name.empty())
+    {
+      return true;
+    }
+
+    std::ofstream out(file_name);
+
+    writer(out);
+
+    if(!out.good())
+    {
+      std::cerr << "Cannot write " << file_name << std::endl;
+
+      return false;
+    }
+
+    return true;
   }
 } // namespace local
 
-auto local::run() -> bool
+auto local::run(const options& opts) -> bool
 {
-  #if defined(WIDE_DECIMAL_NAMESPACE)
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_part1__;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_part2__;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_edge____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_add_____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_sub_____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_mul_____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_div_____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_sqrt____;
-  using WIDE_DECIMAL_NAMESPACE::test_decwide_t_algebra_log_____;
-  #endif
-
-  using function_type = std::function<bool()>;
-
-  const auto result_test_examples_part1_is_ok = local::pfn_runner(function_type(test_decwide_t_examples_part1__), "result_test_examples_part1_is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_examples_part2_is_ok = local::pfn_runner(function_type(test_decwide_t_examples_part2__), "result_test_examples_part2_is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_edge___is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_edge____), "result_test_algebra_edge___is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_add____is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_add_____), "result_test_algebra_add____is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_sub____is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_sub_____), "result_test_algebra_sub____is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_mul____is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_mul_____), "result_test_algebra_mul____is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_div____is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_div_____), "result_test_algebra_div____is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_sqrt___is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_sqrt____), "result_test_algebra_sqrt___is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-  const auto result_test_algebra_log____is_ok = local::pfn_runner(function_type(test_decwide_t_algebra_log_____), "result_test_algebra_log____is_ok    : "); // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
-
-  const auto result_is_ok =
-  (
-       result_test_examples_part1_is_ok
-    && result_test_examples_part2_is_ok
-    && result_test_algebra_edge___is_ok
-    && result_test_algebra_add____is_ok
-    && result_test_algebra_sub____is_ok
-    && result_test_algebra_mul____is_ok
-    && result_test_algebra_div____is_ok
-    && result_test_algebra_sqrt___is_ok
-    && result_test_algebra_log____is_ok
-  );
-
-  return result_is_ok;
+  std::vector<test_case> cases { };
+
+  for(auto& tc : all_test_cases())
+  {
+    if(name_is_selected(opts.filter, tc.name)) { cases.push_back(std::move(tc)); }
+  }
+
+  if((!opts.timings.empty()) && (!read_timings(opts.timings, cases)))
+  {
+    std::cerr << "Cannot read " << opts.timings << ", the tests run in the default order" << std::endl;
+  }
+
+  const auto tasks = select_shard(make_tasks(cases), opts.shard_index, opts.shard_count);
+
+  if(opts.list)
+  {
+    for(const auto& task : tasks)
+    {
+      for(const auto index : task.indices) { std::cout << cases[index].name << std::endl; }
+    }
+
+    return true;
+  }
+
+  using stopwatch_type = concurrency::stopwatch;
+
+  stopwatch_type my_stopwatch { };
+
+  const auto results = run_tasks(cases, tasks, opts.jobs);
+
+  const auto total_time = stopwatch_type::elapsed_time<double>(my_stopwatch);
+
+  const auto results_are_ok =
+    std::all_of(results.cbegin(), results.cend(), [](const test_result& r) { return r.is_ok; });
+
+  const auto reports_are_ok =
+    (   write_report(opts.junit, [&results, &total_time](std::ostream& os) { write_junit(os, results, total_time); })
+     && write_report(opts.json,  [&results, &results_are_ok, &total_time](std::ostream& os) { write_json(os, results, results_are_ok, total_time); }));
+
+  return (results_are_ok && reports_are_ok);
 }
 
-auto main() -> int
+auto main(int argc, char** argv) -> int
 {
+  local::options opts { };
+
+  if(!local::parse_options(argc, argv, opts))
+  {
+    std::cerr << "Usage: test_decwide_t [--list] [--filter=PATTERNS] [--jobs=N] [--shard=K/N] [--timings=FILE] [--junit=FILE] [--json=FILE]" << std::endl;
+
+    return static_cast<int>(INT8_C(-1));
+  }
+
   using stopwatch_type = concurrency::stopwatch;
 
   stopwatch_type my_stopwatch { };
 
-  const bool result_is_ok { local::run() };
+  const bool result_is_ok { local::run(opts) };
+
+  if(opts.list)
+  {
+    return static_cast<int>(INT8_C(0));
+  }
 
   const float execution_time { stopwatch_type::elapsed_time<float>(my_stopwatch) };
 
@@ -0,0 +1,160 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_binary_limbs {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+template<typename WideDecimalType,
+         typename BinaryLimbType>
+auto test_binary_limbs_round_trip(const std::size_t count) -> bool
+{
+  using wide_decimal_type = WideDecimalType;
+  using binary_limb_type  = BinaryLimbType;
+
+  std::mt19937 eng_limb(util::util_pseudorandom_time_point_seed::value<typename std::mt19937::result_type>()); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  std::uniform_int_distribution<unsigned long long> dist_limb // NOLINT(google-runtime-int)
+  (
+    static_cast<unsigned long long>(UINT8_C(0)),                             // NOLINT(google-runtime-int)
+    static_cast<unsigned long long>((std::numeric_limits<binary_limb_type>::max)()) // NOLINT(google-runtime-int)
+  );
+
+  std::vector<binary_limb_type> limbs(count);
+
+  for(auto& limb : limbs)
+  {
+    limb = static_cast<binary_limb_type>(dist_limb(eng_limb));
+  }
+
+  limbs.back() = static_cast<binary_limb_type>(limbs.back() | static_cast<binary_limb_type>(UINT8_C(1)));
+
+  wide_decimal_type x { };
+
+  from_binary_limbs(limbs.cbegin(), limbs.cend(), x);
+
+  // Compare with the schoolbook conversion using Horner's rule.
+  const auto half_base = wide_decimal_type(static_cast<unsigned long long>(1ULL << static_cast<unsigned>(std::numeric_limits<binary_limb_type>::digits / 2))); // NOLINT(google-runtime-int)
+
+  wide_decimal_type x_ctrl { 0 };
+
+  for(auto it = limbs.crbegin(); it != limbs.crend(); ++it)
+  {
+    x_ctrl *= half_base;
+    x_ctrl *= half_base;
+    x_ctrl += wide_decimal_type(*it);
+  }
+
+  std::vector<binary_limb_type> limbs_round_trip(count);
+
+  const auto result_to_binary_is_ok = to_binary_limbs(x, limbs_round_trip.begin(), limbs_round_trip.end());
+
+  return
+    (
+         (x == x_ctrl)
+      && result_to_binary_is_ok
+      && (limbs_round_trip == limbs)
+    );
+}
+
+auto test_binary_limbs_conversion() -> bool
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_wide_decimal_binary_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(10001), std::uint32_t, std::allocator<void>>;
+  #else
+  using local_wide_decimal_binary_type = ::math::wide_decimal::decwide_t<INT32_C(10001), std::uint32_t, std::allocator<void>>;
+  #endif
+
+  auto result_is_ok = true;
+
+  result_is_ok = (test_binary_limbs_round_trip<local_wide_decimal_binary_type, std::uint32_t>(static_cast<std::size_t>(UINT16_C(1000))) && result_is_ok);
+  result_is_ok = (test_binary_limbs_round_trip<local_wide_decimal_binary_type, std::uint64_t>(static_cast<std::size_t>(UINT16_C( 333))) && result_is_ok);
+  result_is_ok = (test_binary_limbs_round_trip<local_wide_decimal_binary_type, std::uint8_t >(static_cast<std::size_t>(UINT16_C( 777))) && result_is_ok);
+  result_is_ok = (test_binary_limbs_round_trip<local_wide_decimal_type,        std::uint32_t>(static_cast<std::size_t>(UINT8_C(    3))) && result_is_ok);
+  result_is_ok = (test_binary_limbs_round_trip<local_wide_decimal_type,        std::uint16_t>(static_cast<std::size_t>(UINT8_C(    1))) && result_is_ok);
+
+  {
+    // The integer part of the absolute value is converted.
+    std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(2))> limbs { };
+
+    const auto result_to_binary_is_ok = to_binary_limbs(local_wide_decimal_type(-12345.75), limbs.begin(), limbs.end());
+
+    result_is_ok = (result_to_binary_is_ok && (limbs[0U] == UINT32_C(12345)) && (limbs[1U] == UINT32_C(0)) && result_is_ok);
+  }
+
+  {
+    // 2^64 does not fit in two 32-bit limbs, but fits in three of them.
+    const auto two_pow_64 = local_wide_decimal_type(UINT64_C(0x100000000)) * local_wide_decimal_type(UINT64_C(0x100000000));
+
+    std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(2))> limbs_short { UINT32_C(1), UINT32_C(1) };
+    std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(3))> limbs       { };
+
+    const auto result_short_is_ok = to_binary_limbs(two_pow_64, limbs_short.begin(), limbs_short.end());
+    const auto result_is_ok_three = to_binary_limbs(two_pow_64, limbs.begin(),       limbs.end());
+
+    result_is_ok = ((!result_short_is_ok) && (limbs_short[0U] == UINT32_C(0)) && (limbs_short[1U] == UINT32_C(0)) && result_is_ok);
+    result_is_ok = (result_is_ok_three && (limbs[0U] == UINT32_C(0)) && (limbs[1U] == UINT32_C(0)) && (limbs[2U] == UINT32_C(1)) && result_is_ok);
+
+    local_wide_decimal_type x { 42 };
+
+    from_binary_limbs(limbs.cbegin(), limbs.cend(), x);
+
+    result_is_ok = ((x == two_pow_64) && result_is_ok);
+
+    // Leading zero limbs and empty ranges are zero.
+    const std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(3))> limbs_zero { };
+
+    from_binary_limbs(limbs_zero.cbegin(), limbs_zero.cend(), x);
+
+    result_is_ok = (x.iszero() && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_binary_limbs
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_binary_limbs____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_binary_limbs____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_binary_limbs::test_binary_limbs_conversion() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,334 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_chars_batch {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+#if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+template<typename WideDecimalType>
+auto test_chars_batch_round_trip(const char delimiter) -> bool
+{
+  using wide_decimal_type = WideDecimalType;
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_chars_format = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::chars_format;
+  #else
+  using local_chars_format = ::math::wide_decimal::chars_format;
+  #endif
+
+  std::vector<wide_decimal_type> values(static_cast<std::size_t>(UINT8_C(64)));
+
+  std::generate(values.begin(), values.end(), []() { return generate_wide_decimal_value<wide_decimal_type>(); }); // NOLINT(modernize-use-trailing-return-type)
+
+  // Write all values into one buffer, then read them back.
+  std::vector<char> buf(static_cast<std::size_t>(UINT16_C(16384)));
+
+  const auto precision = static_cast<int>(std::numeric_limits<wide_decimal_type>::digits10 - 3);
+
+  const auto result_to =
+    to_chars_batch(buf.data(), buf.data() + buf.size(), values.data(), values.data() + values.size(), delimiter, local_chars_format::scientific, precision); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  std::vector<wide_decimal_type> values_read(values.size());
+
+  const auto result_from =
+    from_chars_batch(buf.data(), result_to.ptr, values_read.data(), values_read.data() + values_read.size(), delimiter); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  auto result_is_ok =
+    (
+         (result_to.ec      == std::errc())
+      && (result_to.count   == values.size())
+      && (result_from.ec    == std::errc())
+      && (result_from.count == values.size())
+      && (result_from.ptr   == result_to.ptr)
+      && std::equal(values.cbegin(), values.cend(), values_read.cbegin())
+    );
+
+  // Every field is read just as the string constructor reads it.
+  const auto str = std::string(buf.data(), result_to.ptr);
+
+  auto pos = static_cast<std::string::size_type>(UINT8_C(0));
+
+  for(const auto& y : values_read)
+  {
+    const auto pos_next = str.find(delimiter, pos);
+
+    const wide_decimal_type z(str.substr(pos, pos_next - pos).c_str());
+
+    result_is_ok = (   std::equal(y.crepresentation().cbegin(), y.crepresentation().cend(), z.crepresentation().cbegin())
+                    && (ilogb(y) == ilogb(z))
+                    && result_is_ok);
+
+    pos = ((pos_next != std::string::npos) ? static_cast<std::string::size_type>(pos_next + static_cast<std::string::size_type>(UINT8_C(1))) : pos_next);
+  }
+
+  return result_is_ok;
+}
+
+auto test_chars_batch() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_chars_format = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::chars_format;
+
+  namespace local_detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_limb32 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+  using local_wide_decimal_type_limb08 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(53),  std::uint8_t,  std::allocator<void>>;
+  #else
+  using local_chars_format = ::math::wide_decimal::chars_format;
+
+  namespace local_detail = ::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_limb32 = ::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+  using local_wide_decimal_type_limb08 = ::math::wide_decimal::decwide_t<INT32_C(53),  std::uint8_t,  std::allocator<void>>;
+  #endif
+
+  eng_sgn.seed(util::util_pseudorandom_time_point_seed::value<typename eng_sgn_type::result_type>());
+  eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+  eng_exp.seed(util::util_pseudorandom_time_point_seed::value<typename eng_exp_type::result_type>());
+
+  auto result_is_ok = true;
+
+  {
+    // The eight-digit kernels agree with the character-by-character conversion.
+    std::uniform_int_distribution<std::uint32_t> dist_value(UINT32_C(0), UINT32_C(99999999));
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT16_C(1024)); ++i)
+    {
+      const auto value =
+        ((i < static_cast<unsigned>(UINT8_C(2))) ? ((i == static_cast<unsigned>(UINT8_C(0))) ? UINT32_C(0) : UINT32_C(99999999)) : dist_value(eng_exp));
+
+      std::array<char, static_cast<std::size_t>(UINT8_C(8))> chars { };
+
+      local_detail::swar_store_eight_chars(local_detail::swar_value_to_eight_digits(value), chars.data());
+
+      auto str_ctrl = std::to_string(value);
+
+      str_ctrl.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(chars.size() - str_ctrl.length()), '0');
+
+      const auto word = local_detail::swar_load_eight_chars(chars.data());
+
+      result_is_ok = (   (std::string(chars.cbegin(), chars.cend()) == str_ctrl)
+                      && local_detail::swar_eight_chars_are_digits(word)
+                      && (local_detail::swar_eight_digits_to_value(word) == value)
+                      && result_is_ok);
+    }
+
+    for(const auto* p_str : { "1234.678", "/2345678", "1234567:", "12 45678", "-1234567" })
+    {
+      result_is_ok = ((!local_detail::swar_eight_chars_are_digits(local_detail::swar_load_eight_chars(p_str))) && result_is_ok);
+    }
+  }
+
+  result_is_ok = (test_chars_batch_round_trip<local_wide_decimal_type>       ('\n') && result_is_ok);
+  result_is_ok = (test_chars_batch_round_trip<local_wide_decimal_type_limb32>(',')  && result_is_ok);
+
+  {
+    // Read a CSV column with mixed line breaks, using
+    // limbs having two, four and eight decimal digits.
+    const std::string str_csv = "1.25,-3e5\r\n0.000123456789012345678901234567890123456789\n1234567890123456789.0123456789,42";
+
+    const std::array<const char*, static_cast<std::size_t>(UINT8_C(5))> str_ctrl =
+    {{
+      "1.25", "-3e5", "0.000123456789012345678901234567890123456789", "1234567890123456789.0123456789", "42"
+    }};
+
+    std::array<local_wide_decimal_type_limb08, static_cast<std::size_t>(UINT8_C(5))> values_limb08 { };
+    std::array<local_wide_decimal_type,        static_cast<std::size_t>(UINT8_C(5))> values_limb16 { };
+    std::array<local_wide_decimal_type_limb32, static_cast<std::size_t>(UINT8_C(5))> values_limb32 { };
+
+    const auto result_limb08 = from_chars_batch(str_csv.data(), str_csv.data() + str_csv.length(), values_limb08.data(), values_limb08.data() + values_limb08.size(), ','); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto result_limb16 = from_chars_batch(str_csv.data(), str_csv.data() + str_csv.length(), values_limb16.data(), values_limb16.data() + values_limb16.size(), ','); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto result_limb32 = from_chars_batch(str_csv.data(), str_csv.data() + str_csv.length(), values_limb32.data(), values_limb32.data() + values_limb32.size(), ','); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    result_is_ok = (   (result_limb08.ec == std::errc()) && (result_limb08.count == values_limb08.size()) && (result_limb08.ptr == str_csv.data() + str_csv.length()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && (result_limb16.ec == std::errc()) && (result_limb16.count == values_limb16.size()) && (result_limb16.ptr == str_csv.data() + str_csv.length()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && (result_limb32.ec == std::errc()) && (result_limb32.count == values_limb32.size()) && (result_limb32.ptr == str_csv.data() + str_csv.length()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && result_is_ok);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < str_ctrl.size(); ++i)
+    {
+      const local_wide_decimal_type_limb08 z08(str_ctrl[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      const local_wide_decimal_type        z16(str_ctrl[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      const local_wide_decimal_type_limb32 z32(str_ctrl[i]); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+      result_is_ok = (   std::equal(values_limb08[i].crepresentation().cbegin(), values_limb08[i].crepresentation().cend(), z08.crepresentation().cbegin()) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                      && std::equal(values_limb16[i].crepresentation().cbegin(), values_limb16[i].crepresentation().cend(), z16.crepresentation().cbegin()) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                      && std::equal(values_limb32[i].crepresentation().cbegin(), values_limb32[i].crepresentation().cend(), z32.crepresentation().cbegin()) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                      && (values_limb08[i] == z08) && (values_limb16[i] == z16) && (values_limb32[i] == z32) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+                      && result_is_ok);
+    }
+
+    // The digits written with limbs of all widths are the same.
+    std::array<char, static_cast<std::size_t>(UINT16_C(256))> buf08 { };
+    std::array<char, static_cast<std::size_t>(UINT16_C(256))> buf32 { };
+
+    const auto result_to08 = to_chars_batch(buf08.data(), buf08.data() + buf08.size(), values_limb08.data(), values_limb08.data() + values_limb08.size(), ';', local_chars_format::fixed, 30); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    const auto result_to32 = to_chars_batch(buf32.data(), buf32.data() + buf32.size(), values_limb32.data(), values_limb32.data() + values_limb32.size(), ';', local_chars_format::fixed, 30); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (   (result_to08.ec == std::errc())
+                    && (result_to32.ec == std::errc())
+                    && (std::string(buf08.data(), result_to08.ptr) == std::string(buf32.data(), result_to32.ptr))
+                    && (std::string(buf32.data(), result_to32.ptr).substr(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(72))) == "1.250000000000000000000000000000;-300000.000000000000000000000000000000;")
+                    && result_is_ok);
+  }
+
+  {
+    // Stop at a field which is not a number followed by a separator,
+    // and at the end of a too-small output buffer.
+    const std::string str_bad = "1,2x,3";
+
+    std::array<local_wide_decimal_type, static_cast<std::size_t>(UINT8_C(3))> values { };
+
+    const auto result_bad = from_chars_batch(str_bad.data(), str_bad.data() + str_bad.length(), values.data(), values.data() + values.size(), ','); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    result_is_ok = (   (result_bad.ec    == std::errc::invalid_argument)
+                    && (result_bad.count == static_cast<std::size_t>(UINT8_C(2)))
+                    && (result_bad.ptr   == str_bad.data() + static_cast<std::ptrdiff_t>(INT8_C(3))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && (values[static_cast<std::size_t>(UINT8_C(1))] == 2U)
+                    && result_is_ok);
+
+    std::array<char, static_cast<std::size_t>(UINT8_C(8))> buf_small { };
+
+    const auto result_small = to_chars_batch(buf_small.data(), buf_small.data() + buf_small.size(), values.data(), values.data() + values.size(), ',', local_chars_format::fixed, 2); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    result_is_ok = (   (result_small.ec    == std::errc::value_too_large)
+                    && (result_small.count == static_cast<std::size_t>(UINT8_C(1)))
+                    && (result_small.ptr   == buf_small.data() + buf_small.size()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_chars_batch
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_chars_batch_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_chars_batch_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+  result_is_ok = (test_decwide_t_chars_batch::test_chars_batch() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,233 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_checkpoint {
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_checkpoint_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+using local_agm_checkpoint_type          = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::agm_checkpoint<local_wide_decimal_checkpoint_type>;
+using local_agm_checkpoint_kind          = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::agm_checkpoint_kind;
+using local_checkpoint_format            = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail::checkpoint_serialization_format;
+#else
+using local_wide_decimal_checkpoint_type = ::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+using local_agm_checkpoint_type          = ::math::wide_decimal::agm_checkpoint<local_wide_decimal_checkpoint_type>;
+using local_agm_checkpoint_kind          = ::math::wide_decimal::agm_checkpoint_kind;
+using local_checkpoint_format            = ::math::wide_decimal::detail::checkpoint_serialization_format;
+#endif
+
+std::vector<std::uint8_t> saved_checkpoint(local_agm_checkpoint_type::serialized_size()); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uint32_t             saved_checkpoint_iteration { };                                 // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::uint32_t             checkpoint_callback_count  { };                                 // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+#if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+auto test_agm_checkpoints() -> bool
+{
+  auto result_is_ok = true;
+
+  // Save the state after the second iteration, which is
+  // where the calculation could have been interrupted.
+  const auto save_after_two =
+    [](const local_agm_checkpoint_type& checkpoint) // NOLINT(modernize-use-trailing-return-type)
+    {
+      ++checkpoint_callback_count;
+
+      if(checkpoint.iteration == static_cast<std::uint32_t>(UINT8_C(2)))
+      {
+        saved_checkpoint_iteration = checkpoint.iteration;
+
+        static_cast<void>(serialize(saved_checkpoint.data(), saved_checkpoint.data() + saved_checkpoint.size(), checkpoint));
+      }
+    };
+
+  const auto count_only =
+    [](const local_agm_checkpoint_type&) // NOLINT(modernize-use-trailing-return-type,hicpp-named-parameter,readability-named-parameter)
+    {
+      ++checkpoint_callback_count;
+    };
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  const auto pi_ctrl     = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi    <INT32_C(101), std::uint32_t, std::allocator<void>>();
+  const auto ln_two_ctrl = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_ln_two<INT32_C(101), std::uint32_t, std::allocator<void>>();
+  #else
+  const auto pi_ctrl     = ::math::wide_decimal::calc_pi    <INT32_C(101), std::uint32_t, std::allocator<void>>();
+  const auto ln_two_ctrl = ::math::wide_decimal::calc_ln_two<INT32_C(101), std::uint32_t, std::allocator<void>>();
+  #endif
+
+  {
+    local_agm_checkpoint_type checkpoint { };
+
+    checkpoint_callback_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto pi_full = calc_pi(checkpoint, save_after_two);
+
+    const auto count_full = checkpoint_callback_count;
+
+    // Resume from the saved state.
+    local_agm_checkpoint_type checkpoint_resumed { };
+
+    const auto result_deser = deserialize(saved_checkpoint.data(), saved_checkpoint.data() + saved_checkpoint.size(), checkpoint_resumed);
+
+    checkpoint_callback_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto pi_resumed = calc_pi(checkpoint_resumed, count_only);
+
+    const auto result_pi_is_ok =
+      (
+           (pi_full == pi_ctrl)
+        && (result_deser.ec == std::errc())
+        && (pi_resumed == pi_ctrl)
+        && (saved_checkpoint_iteration == static_cast<std::uint32_t>(UINT8_C(2)))
+        && (checkpoint_callback_count == static_cast<std::uint32_t>(count_full - saved_checkpoint_iteration))
+      );
+
+    result_is_ok = (result_pi_is_ok && result_is_ok);
+  }
+
+  {
+    local_agm_checkpoint_type checkpoint { };
+
+    checkpoint_callback_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto ln_two_full = calc_ln_two(checkpoint, save_after_two);
+
+    const auto count_full = checkpoint_callback_count;
+
+    local_agm_checkpoint_type checkpoint_resumed { };
+
+    const auto result_deser = deserialize(saved_checkpoint.data(), saved_checkpoint.data() + saved_checkpoint.size(), checkpoint_resumed);
+
+    checkpoint_callback_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto ln_two_resumed = calc_ln_two(checkpoint_resumed, count_only);
+
+    const auto count_resumed = checkpoint_callback_count;
+
+    // A state of another calculation is not resumed from.
+    checkpoint_callback_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const auto pi_not_resumed = calc_pi(checkpoint_resumed, count_only);
+
+    const auto result_ln_two_is_ok =
+      (
+           (ln_two_full == ln_two_ctrl)
+        && (result_deser.ec == std::errc())
+        && (ln_two_resumed == ln_two_ctrl)
+        && (count_resumed == static_cast<std::uint32_t>(count_full - saved_checkpoint_iteration))
+        && (pi_not_resumed == pi_ctrl)
+        && (checkpoint_callback_count > saved_checkpoint_iteration)
+      );
+
+    result_is_ok = (result_ln_two_is_ok && result_is_ok);
+  }
+
+  {
+    // A finished calculation leaves a checkpoint which is not resumed
+    // from, so that running it again yields the same value.
+    local_agm_checkpoint_type checkpoint { };
+
+    const auto pi_first = calc_pi(checkpoint, count_only);
+
+    const auto checkpoint_is_finished =
+      (
+           (checkpoint.kind == local_agm_checkpoint_kind::none)
+        && (checkpoint.iteration == static_cast<std::uint32_t>(UINT8_C(0)))
+        && (!checkpoint.can_resume(local_agm_checkpoint_kind::pi))
+      );
+
+    const auto pi_second = calc_pi(checkpoint, count_only);
+
+    result_is_ok = (checkpoint_is_finished && (pi_first == pi_ctrl) && (pi_second == pi_ctrl) && result_is_ok);
+  }
+
+  {
+    // Unknown kinds and iterations out of range are rejected.
+    const auto deserialize_modified =
+      [](const std::uint8_t kind, const std::uint32_t iteration) // NOLINT(modernize-use-trailing-return-type)
+      {
+        auto buf = saved_checkpoint;
+
+        buf[local_checkpoint_format::offset_kind()] = kind;
+
+        std::memcpy(buf.data() + local_checkpoint_format::offset_iteration(), &iteration, sizeof(iteration)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        local_agm_checkpoint_type checkpoint { };
+
+        return deserialize(buf.data(), buf.data() + buf.size(), checkpoint).ec;
+      };
+
+    const auto kind_pi     = static_cast<std::uint8_t>(local_agm_checkpoint_kind::pi);
+    const auto kind_ln_two = static_cast<std::uint8_t>(local_agm_checkpoint_kind::ln_two);
+
+    result_is_ok = (   (deserialize_modified(kind_pi,                                  static_cast<std::uint32_t>(UINT8_C(47)))  == std::errc())
+                    && (deserialize_modified(kind_pi,                                  static_cast<std::uint32_t>(UINT8_C(48)))  == std::errc::invalid_argument)
+                    && (deserialize_modified(kind_ln_two,                              static_cast<std::uint32_t>(UINT8_C(127))) == std::errc())
+                    && (deserialize_modified(kind_ln_two,                              static_cast<std::uint32_t>(UINT8_C(128))) == std::errc::invalid_argument)
+                    && (deserialize_modified(static_cast<std::uint8_t>(UINT8_C(3)),    static_cast<std::uint32_t>(UINT8_C(2)))   == std::errc::invalid_argument)
+                    && (deserialize_modified(static_cast<std::uint8_t>(UINT8_C(0)),    static_cast<std::uint32_t>(UINT8_C(2)))   == std::errc::invalid_argument)
+                    && result_is_ok);
+  }
+
+  {
+    // A header with a foreign magic, version, byte order
+    // or value count is rejected.
+    const auto deserialize_corrupted =
+      [](const std::size_t offset) // NOLINT(modernize-use-trailing-return-type)
+      {
+        auto buf = saved_checkpoint;
+
+        buf[offset] = static_cast<std::uint8_t>(buf[offset] ^ static_cast<std::uint8_t>(UINT8_C(0x55)));
+
+        local_agm_checkpoint_type checkpoint { };
+
+        return deserialize(buf.data(), buf.data() + buf.size(), checkpoint).ec;
+      };
+
+    result_is_ok = (   (deserialize_corrupted(local_checkpoint_format::offset_magic())       == std::errc::invalid_argument)
+                    && (deserialize_corrupted(local_checkpoint_format::offset_version())     == std::errc::invalid_argument)
+                    && (deserialize_corrupted(local_checkpoint_format::offset_byte_order())  == std::errc::invalid_argument)
+                    && (deserialize_corrupted(local_checkpoint_format::offset_value_count()) == std::errc::invalid_argument)
+                    && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_checkpoint
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_checkpoint______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_checkpoint______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+  result_is_ok = (test_decwide_t_checkpoint::test_agm_checkpoints() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
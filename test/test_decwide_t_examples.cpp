@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2020 - 2023.                 //
+//  Copyright Christopher Kormanyos 2020 - 2026.                 //
 //  Distributed under the Boost Software License,                //
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
@@ -22,10 +22,34 @@
   #endif
 #endif
 
+namespace local_examples
+{
+  auto run_part(const unsigned part) -> bool
+  {
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_entries;
+    #endif
+
+    bool result_is_ok = true;
+
+    for(const auto& entry : test_decwide_t_examples_entries())
+    {
+      if(entry.part == part)
+      {
+        result_is_ok &= entry.function();
+
+        std::cout << std::left << std::setw(36) << entry.name << ": " << std::boolalpha << result_is_ok << std::endl;
+      }
+    }
+
+    return result_is_ok;
+  }
+} // namespace local_examples
+
 #if defined(WIDE_DECIMAL_NAMESPACE)
-auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_part1__() -> bool // NOLINT(readability-identifier-naming)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_entries() -> const std::vector<test_decwide_t_examples_entry>&
 #else
-auto test_decwide_t_examples_part1__() -> bool // NOLINT(readability-identifier-naming)
+auto test_decwide_t_examples_entries() -> const std::vector<test_decwide_t_examples_entry>&
 #endif
 {
   #if defined(WIDE_DECIMAL_NAMESPACE)
@@ -34,27 +58,55 @@ auto test_decwide_t_examples_part1__() -> bool // NOLINT(readability-identifier-
   using namespace math::wide_decimal;                         // NOLINT(google-build-using-namespace)
   #endif
 
-  bool result_is_ok = true;
+  static const std::vector<test_decwide_t_examples_entry> entries =
+  {
+    { "example000_multiply_nines",         example000_multiply_nines,          1U, ""               },
+    { "example000a_multiply_pi_squared",   example000a_multiply_pi_squared,    1U, ""               },
+    { "example001_roots_sqrt",             example001_roots_sqrt,              1U, "static_memory"  },
+    { "example001a_roots_seventh",         example001a_roots_seventh,          1U, ""               },
+    { "example001b_roots_almost_integer",  example001b_roots_almost_integer,   1U, ""               },
+    { "example001c_roots_sqrt_limb08",     example001c_roots_sqrt_limb08,      1U, "static_memory"  },
+    { "example001d_pow2_from_list",        example001d_pow2_from_list,         1U, ""               },
+    { "example001e_algebra_and_constexpr", example001e_algebra_and_constexpr,  1U, ""               },
+    #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
+    { "example002_pi",                     example002_pi,                      1U, "static_memory"  },
+    { "example002a_pi_small_limb",         example002a_pi_small_limb,          1U, "static_memory"  },
+    #endif
+    { "example002b_pi_100k",               example002b_pi_100k,                1U, "static_memory"  },
+    #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
+    { "example002c_pi_quintic",            example002c_pi_quintic,             1U, "static_memory"  },
+    { "example002d_pi_limb08",             example002d_pi_limb08,              1U, "static_memory"  },
+    #endif
+    { "example003_zeta",                   example003_zeta,                    2U, ""               },
+    { "example004_bessel_recur",           example004_bessel_recur,            2U, ""               },
+    { "example005_polylog_series",         example005_polylog_series,          2U, ""               },
+    #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
+    { "example006_logarithm",              example006_logarithm,               2U, ""               },
+    { "example007_catalan_series",         example007_catalan_series,          2U, ""               },
+    { "example008_bernoulli_tgamma",       example008_bernoulli_tgamma,        2U, "static_memory"  },
+    #endif
+    { "example009_boost_math_standalone",  example009_boost_math_standalone,   2U, ""               },
+    { "example009a_boost_math_standalone", example009a_boost_math_standalone,  2U, ""               },
+    { "example009b_boost_math_standalone", example009b_boost_math_standalone,  2U, ""               },
+    { "example010_hypergeometric_2f1",     example010_hypergeometric_2f1,      2U, ""               },
+    { "example010a_hypergeometric_1f1",    example010a_hypergeometric_1f1,     2U, ""               },
+    { "example011_trig_trapezoid_integral", example011_trig_trapezoid_integral, 2U, ""               },
+    { "example012_rational_floor_ceil",    example012_rational_floor_ceil,     2U, ""               },
+    { "example013_embeddable_sqrt",        example013_embeddable_sqrt,         2U, "static_memory"  },
+    { "example013a_embeddable_agm",        example013a_embeddable_agm,         2U, "static_memory"  },
+    { "example014_instrumentation",        example014_instrumentation,         2U, ""               },
+  };
 
-  result_is_ok &= example000_multiply_nines           (); std::cout << "example000_multiply_nines           : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example000a_multiply_pi_squared     (); std::cout << "example000a_multiply_pi_squared     : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001_roots_sqrt               (); std::cout << "example001_roots_sqrt               : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001a_roots_seventh           (); std::cout << "example001a_roots_seventh           : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001b_roots_almost_integer    (); std::cout << "example001b_roots_almost_integer    : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001c_roots_sqrt_limb08       (); std::cout << "example001c_roots_sqrt_limb08       : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001d_pow2_from_list          (); std::cout << "example001d_pow2_from_list          : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example001e_algebra_and_constexpr   (); std::cout << "example001e_algebra_and_constexpr   : " << std::boolalpha << result_is_ok << std::endl;
-  #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
-  result_is_ok &= example002_pi                       (); std::cout << "example002_pi                       : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example002a_pi_small_limb           (); std::cout << "example002a_pi_small_limb           : " << std::boolalpha << result_is_ok << std::endl;
-  #endif
-  result_is_ok &= example002b_pi_100k                 (); std::cout << "example002b_pi_100k                 : " << std::boolalpha << result_is_ok << std::endl;
-  #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
-  result_is_ok &= example002c_pi_quintic              (); std::cout << "example002c_pi_quintic              : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example002d_pi_limb08               (); std::cout << "example002d_pi_limb08               : " << std::boolalpha << result_is_ok << std::endl;
-  #endif
+  return entries;
+}
 
-  return result_is_ok;
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_part1__() -> bool // NOLINT(readability-identifier-naming)
+#else
+auto test_decwide_t_examples_part1__() -> bool // NOLINT(readability-identifier-naming)
+#endif
+{
+  return local_examples::run_part(1U);
 }
 
 #if defined(WIDE_DECIMAL_NAMESPACE)
@@ -63,31 +115,5 @@ auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_examples_part2__() -> bool // NOLINT
 auto test_decwide_t_examples_part2__() -> bool // NOLINT(readability-identifier-naming)
 #endif
 {
-  #if defined(WIDE_DECIMAL_NAMESPACE)
-  using namespace WIDE_DECIMAL_NAMESPACE::math::wide_decimal; // NOLINT(google-build-using-namespace)
-  #else
-  using namespace math::wide_decimal;                         // NOLINT(google-build-using-namespace)
-  #endif
-
-  bool result_is_ok = true;
-
-  result_is_ok &= example003_zeta                     (); std::cout << "example003_zeta                     : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example004_bessel_recur             (); std::cout << "example004_bessel_recur             : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example005_polylog_series           (); std::cout << "example005_polylog_series           : " << std::boolalpha << result_is_ok << std::endl;
-  #if !defined(DECWIDE_T_REDUCE_TEST_DEPTH)
-  result_is_ok &= example006_logarithm                (); std::cout << "example006_logarithm                : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example007_catalan_series           (); std::cout << "example007_catalan_series           : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example008_bernoulli_tgamma         (); std::cout << "example008_bernoulli_tgamma         : " << std::boolalpha << result_is_ok << std::endl;
-  #endif
-  result_is_ok &= example009_boost_math_standalone    (); std::cout << "example009_boost_math_standalone    : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example009a_boost_math_standalone   (); std::cout << "example009a_boost_math_standalone   : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example009b_boost_math_standalone   (); std::cout << "example009b_boost_math_standalone   : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example010_hypergeometric_2f1       (); std::cout << "example010_hypergeometric_2f1       : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example010a_hypergeometric_1f1      (); std::cout << "example010a_hypergeometric_1f1      : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example011_trig_trapezoid_integral  (); std::cout << "example011_trig_trapezoid_integral  : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example012_rational_floor_ceil      (); std::cout << "example012_rational_floor_ceil      : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example013_embeddable_sqrt          (); std::cout << "example013_embeddable_sqrt          : " << std::boolalpha << result_is_ok << std::endl;
-  result_is_ok &= example013a_embeddable_agm          (); std::cout << "example013a_embeddable_agm          : " << std::boolalpha << result_is_ok << std::endl;
-
-  return result_is_ok;
+  return local_examples::run_part(2U);
 }
@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2020 - 2023.                 //
+//  Copyright Christopher Kormanyos 2020 - 2026.                 //
 //  Distributed under the Boost Software License,                //
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
@@ -8,6 +8,8 @@
 #ifndef TEST_DECWIDE_T_EXAMPLES_2020_11_05_H // NOLINT(llvm-header-guard)
   #define TEST_DECWIDE_T_EXAMPLES_2020_11_05_H
 
+  #include <vector>
+
   #include <math/wide_decimal/decwide_t_detail_namespace.h>
 
   #if !defined(WIDE_DECIMAL_NAMESPACE_BEGIN)
@@ -20,6 +22,22 @@
 
   WIDE_DECIMAL_NAMESPACE_BEGIN
 
+  // One example of the test, which the test runner can schedule on its own.
+  // Examples of the same nonempty group share static memory, such as the
+  // scratch pools of decwide_t without dynamic memory allocation or the
+  // slots of n_slot_array_allocator. They must not run concurrently.
+  struct test_decwide_t_examples_entry
+  {
+    using function_type = auto (*)() -> bool;
+
+    const char*   name;     // NOLINT(misc-non-private-member-variables-in-classes)
+    function_type function; // NOLINT(misc-non-private-member-variables-in-classes)
+    unsigned      part;     // NOLINT(misc-non-private-member-variables-in-classes)
+    const char*   group;    // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  auto test_decwide_t_examples_entries() -> const std::vector<test_decwide_t_examples_entry>&;
+
   auto test_decwide_t_examples_part1__() -> bool; // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
   auto test_decwide_t_examples_part2__() -> bool; // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
 
@@ -0,0 +1,135 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_fft_packing {
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+auto test_fft_packing() -> bool
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  namespace local_detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_fft_float  = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(16001), std::uint32_t, std::allocator<void>, double, std::int64_t, float>;
+  using local_wide_decimal_type_fft_double = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(16001), std::uint32_t, std::allocator<void>, double, std::int64_t, double>;
+  #else
+  namespace local_detail = ::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_fft_float  = ::math::wide_decimal::decwide_t<INT32_C(16001), std::uint32_t, std::allocator<void>, double, std::int64_t, float>;
+  using local_wide_decimal_type_fft_double = ::math::wide_decimal::decwide_t<INT32_C(16001), std::uint32_t, std::allocator<void>, double, std::int64_t, double>;
+  #endif
+
+  // Full uint32 limbs are too large for a double FFT, but half-limbs fit.
+  // No packing meets the bound of a float FFT, which then gets the smallest points.
+  // Full uint16 limbs of 16001 digits fit, whereas those of 4 million digits do not.
+  auto result_is_ok =
+    (   (local_wide_decimal_type_fft_double::fft_points_per_limb(local_wide_decimal_type_fft_double::decwide_t_elem_number) == static_cast<std::uint32_t>(UINT8_C(2)))
+     && (local_wide_decimal_type_fft_float ::fft_points_per_limb(local_wide_decimal_type_fft_float ::decwide_t_elem_number) == static_cast<std::uint32_t>(UINT8_C(4)))
+     && (local_detail::fft_points_per_limb<std::uint16_t, double>(INT32_C(4004),    static_cast<std::uint32_t>(UINT8_C(4)), 0.25) == static_cast<std::uint32_t>(UINT8_C(1)))
+     && (local_detail::fft_points_per_limb<std::uint16_t, double>(INT32_C(1000003), static_cast<std::uint32_t>(UINT8_C(4)), 0.25) == static_cast<std::uint32_t>(UINT8_C(2)))
+     && (local_detail::fft_points_per_limb<std::uint8_t,  double>(INT32_C(4004),    static_cast<std::uint32_t>(UINT8_C(1)), 0.25) == static_cast<std::uint32_t>(UINT8_C(1))));
+
+  // The bound of the round-off error is known at compile time.
+  static_assert(local_detail::fft_roundoff_bound_of_limbs<std::uint32_t, double>(local_wide_decimal_type_fft_double::decwide_t_elem_number, static_cast<std::uint32_t>(UINT8_C(2))) <= 0.25,
+                "Error: The bound of the round-off error of a double FFT of half-limbs is not met");
+
+  static_assert(local_detail::fft_roundoff_bound_of_limbs<std::uint32_t, float>(local_wide_decimal_type_fft_float::decwide_t_elem_number, static_cast<std::uint32_t>(UINT8_C(4))) > 0.25,
+                "Error: The bound of the round-off error of a float FFT of quarter-limbs is met");
+
+  // When the upper halves of the factors are zero, the FFT product is not
+  // truncated. It is then exact with each packing and equal to the
+  // schoolbook product.
+  constexpr auto half_elems = static_cast<std::size_t>(UINT8_C(32));
+  constexpr auto prec_elems = static_cast<std::size_t>(half_elems * 2U);
+
+  std::uniform_int_distribution<std::uint32_t> dist_limb(UINT32_C(0), UINT32_C(9999));
+
+  std::vector<std::uint16_t> u(prec_elems, static_cast<std::uint16_t>(UINT8_C(0)));
+  std::vector<std::uint16_t> v(prec_elems, static_cast<std::uint16_t>(UINT8_C(0)));
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < half_elems; ++i)
+  {
+    u[i] = static_cast<std::uint16_t>(dist_limb(eng_dig));
+    v[i] = static_cast<std::uint16_t>(dist_limb(eng_dig));
+  }
+
+  u.front() = static_cast<std::uint16_t>(UINT16_C(9999));
+  v.front() = static_cast<std::uint16_t>(UINT16_C(9999));
+
+  std::vector<std::uint16_t> r_school(prec_elems, static_cast<std::uint16_t>(UINT8_C(0)));
+
+  local_detail::eval_multiply_n_by_n_to_2n(r_school.data(), u.data(), v.data(), static_cast<std::int_fast32_t>(half_elems));
+
+  for(auto points_per_limb = static_cast<std::uint32_t>(UINT8_C(1)); points_per_limb <= static_cast<std::uint32_t>(UINT8_C(4)); points_per_limb *= 2U)
+  {
+    const auto n_fft = static_cast<std::uint32_t>(local_detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems * points_per_limb)) * 2U);
+
+    std::vector<double> af(static_cast<std::size_t>(n_fft));
+    std::vector<double> bf(static_cast<std::size_t>(n_fft));
+
+    std::vector<std::uint16_t> r_fft(prec_elems, static_cast<std::uint16_t>(UINT8_C(0)));
+
+    const auto roundoff =
+      local_detail::mul_loop_fft(r_fft.data(),
+                                 static_cast<const std::uint16_t*>(u.data()),
+                                 static_cast<const std::uint16_t*>(v.data()),
+                                 af.data(),
+                                 bf.data(),
+                                 static_cast<std::int32_t>(prec_elems),
+                                 n_fft,
+                                 points_per_limb,
+                                 0.25,
+                                 true);
+
+    result_is_ok = (   (roundoff < 0.25)
+                    && (r_fft == r_school)
+                    && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_fft_packing
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_fft_packing_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_fft_packing_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_fft_packing::test_fft_packing() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,148 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_float_conv {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+auto test_builtin_float_conversion() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_wide_decimal_float_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(1001), std::uint32_t, std::allocator<void>>;
+  #else
+  using local_wide_decimal_float_type = ::math::wide_decimal::decwide_t<INT32_C(1001), std::uint32_t, std::allocator<void>>;
+  #endif
+
+  auto result_is_ok = true;
+
+  std::mt19937_64 eng_bits(util::util_pseudorandom_time_point_seed::value<typename std::mt19937_64::result_type>()); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  for(auto   i = static_cast<unsigned>(UINT8_C(0));
+             i < static_cast<unsigned>(UINT16_C(1024));
+           ++i)
+  {
+    // Round trip normalized doubles and floats having random bit patterns.
+    const auto bits = static_cast<std::uint64_t>(eng_bits());
+
+    double d { };
+    float  f { };
+
+    std::memcpy(&d, &bits, sizeof(double));
+    std::memcpy(&f, &bits, sizeof(float));
+
+    using std::fabs;
+    using std::isfinite;
+
+    if(isfinite(d) && (fabs(d) >= (std::numeric_limits<double>::min)()))
+    {
+      const auto result_d_is_ok =
+        (
+             (static_cast<double>(local_wide_decimal_float_type(d)) == d)
+          && (static_cast<double>(local_wide_decimal_type(d))       == d)
+        );
+
+      result_is_ok = (result_d_is_ok && result_is_ok);
+    }
+
+    if(isfinite(f) && (fabs(f) >= (std::numeric_limits<float>::min)()))
+    {
+      const auto result_f_is_ok =
+        (
+             (static_cast<float>(local_wide_decimal_float_type(f)) == f)
+          && (static_cast<float>(local_wide_decimal_type(f))       == f)
+        );
+
+      result_is_ok = (result_f_is_ok && result_is_ok);
+    }
+  }
+
+  {
+    // The conversion from double is exact.
+    std::stringstream strm;
+
+    strm << std::fixed << std::setprecision(55) << local_wide_decimal_float_type(0.1);
+
+    result_is_ok = ((strm.str() == "0.1000000000000000055511151231257827021181583404541015625") && result_is_ok);
+  }
+
+  {
+    // Midpoints between adjacent doubles are rounded to even.
+    const local_wide_decimal_float_type one_plus_half_ulp       ("1.00000000000000011102230246251565404236316680908203125");
+    const local_wide_decimal_float_type one_plus_three_half_ulp ("1.00000000000000033306690738754696212708950042724609375");
+    const local_wide_decimal_float_type one_plus_half_ulp_above ("1.00000000000000011102230246251565404236316680908203126");
+
+    const auto result_ties_are_ok =
+      (
+           (static_cast<double>(one_plus_half_ulp)       == 1.0)
+        && (static_cast<double>(one_plus_three_half_ulp) == 1.0 + (4.0 * std::numeric_limits<double>::epsilon() / 2.0))
+        && (static_cast<double>(one_plus_half_ulp_above) == 1.0 + std::numeric_limits<double>::epsilon())
+        && (static_cast<double>(-one_plus_half_ulp_above) == -(1.0 + std::numeric_limits<double>::epsilon()))
+      );
+
+    result_is_ok = (result_ties_are_ok && result_is_ok);
+  }
+
+  {
+    // Short decimal values take the exact fast path.
+    const auto result_fast_path_is_ok =
+      (
+           (static_cast<double>(local_wide_decimal_type("123.5"))   == 123.5)
+        && (static_cast<double>(local_wide_decimal_type("1e22"))    == 1e22)
+        && (static_cast<double>(local_wide_decimal_type("-4.5e-3")) == -4.5e-3)
+        && (static_cast<float> (local_wide_decimal_type("0.1"))     == 0.1F)
+      );
+
+    result_is_ok = (result_fast_path_is_ok && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_float_conv
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_float_conv______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_float_conv______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_float_conv::test_builtin_float_conversion() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
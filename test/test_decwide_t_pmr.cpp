@@ -0,0 +1,198 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_dynamic_array.h>
+
+namespace test_decwide_t_pmr {
+
+#if defined(WIDE_DECIMAL_HAS_MEMORY_RESOURCE)
+class counting_memory_resource : public std::pmr::memory_resource // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+{
+public:
+  WIDE_DECIMAL_NODISCARD auto allocation_count  () const noexcept -> std::size_t { return my_allocation_count; }
+  WIDE_DECIMAL_NODISCARD auto bytes_outstanding () const noexcept -> std::size_t { return my_bytes_outstanding; }
+
+private:
+  std::size_t my_allocation_count  { }; // NOLINT(readability-identifier-naming)
+  std::size_t my_bytes_outstanding { }; // NOLINT(readability-identifier-naming)
+
+  auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+  {
+    ++my_allocation_count;
+
+    my_bytes_outstanding += bytes;
+
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment) -> void override
+  {
+    my_bytes_outstanding -= bytes;
+
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  WIDE_DECIMAL_NODISCARD auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+  {
+    return (this == &other);
+  }
+};
+
+struct default_memory_resource_guard // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+{
+  explicit default_memory_resource_guard(std::pmr::memory_resource* p_resource)
+    : my_previous_resource(std::pmr::set_default_resource(p_resource)) { }
+
+  ~default_memory_resource_guard() { static_cast<void>(std::pmr::set_default_resource(my_previous_resource)); }
+
+  std::pmr::memory_resource* my_previous_resource; // NOLINT(readability-identifier-naming)
+};
+
+auto test_memory_resource() -> bool
+{
+  auto result_is_ok = true;
+
+  // Use enough digits for the multiplication to run Karatsuba.
+  constexpr std::int32_t local_pmr_digits10 = INT32_C(1001);
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_pmr_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_pmr_digits10, std::uint32_t, std::pmr::polymorphic_allocator<void>>;
+  using local_std_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_pmr_digits10, std::uint32_t, std::allocator<void>>;
+  #else
+  using local_pmr_wide_decimal_type = ::math::wide_decimal::decwide_t<local_pmr_digits10, std::uint32_t, std::pmr::polymorphic_allocator<void>>;
+  using local_std_wide_decimal_type = ::math::wide_decimal::decwide_t<local_pmr_digits10, std::uint32_t, std::allocator<void>>;
+  #endif
+
+  const auto result_matches =
+    [](const local_pmr_wide_decimal_type& a, const local_std_wide_decimal_type& b) // NOLINT(modernize-use-trailing-return-type)
+    {
+      return (   (a.isneg() == b.isneg())
+              && (ilogb(a) == ilogb(b))
+              && std::equal(a.crepresentation().cbegin(), a.crepresentation().cend(), b.crepresentation().cbegin()));
+    };
+
+  counting_memory_resource upstream;
+  counting_memory_resource value_resource;
+
+  {
+    // Hand a monotonic buffer to a whole computation and
+    // release everything at once at the end of the scope.
+    std::pmr::monotonic_buffer_resource buffer_resource(&upstream);
+
+    const default_memory_resource_guard guard(&buffer_resource);
+
+    const auto x_pmr = sqrt(local_pmr_wide_decimal_type(2U)) / 3U;
+    const auto x_std = sqrt(local_std_wide_decimal_type(2U)) / 3U;
+
+    result_is_ok = (result_matches(x_pmr * x_pmr, x_std * x_std) && result_is_ok);
+    result_is_ok = (result_matches(x_pmr + x_pmr / 7U, x_std + x_std / 7U) && result_is_ok);
+  }
+
+  result_is_ok = ((upstream.allocation_count() > static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+  result_is_ok = ((upstream.bytes_outstanding() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+  {
+    // The scratch storage of in-place multiplication is taken
+    // from the memory resource of the value being multiplied.
+    const default_memory_resource_guard guard(&value_resource);
+
+    auto u = local_pmr_wide_decimal_type(1U) / 7U;
+    auto v = local_pmr_wide_decimal_type(1U) / 9U;
+
+    const default_memory_resource_guard guard_other(std::pmr::new_delete_resource());
+
+    const auto count_before = value_resource.allocation_count();
+
+    u *= v;
+
+    result_is_ok = ((value_resource.allocation_count() > count_before) && result_is_ok);
+    result_is_ok = (result_matches(u, (local_std_wide_decimal_type(1U) / 7U) * (local_std_wide_decimal_type(1U) / 9U)) && result_is_ok);
+  }
+
+  {
+    // Move assignment between unequal polymorphic allocators copies
+    // into storage of the target's own resource, whereas swap and move
+    // assignment between equal allocators exchange the storage.
+    using local_pmr_array_type = util::dynamic_array<std::uint32_t, std::pmr::polymorphic_allocator<std::uint32_t>>;
+
+    counting_memory_resource other_resource;
+
+    local_pmr_array_type a(static_cast<std::size_t>(UINT8_C(8)), static_cast<std::uint32_t>(UINT8_C(1)), &value_resource);
+
+    {
+      local_pmr_array_type b(static_cast<std::size_t>(UINT8_C(4)), static_cast<std::uint32_t>(UINT8_C(2)), &other_resource);
+
+      a = std::move(b);
+    }
+
+    result_is_ok = ((a.size() == 4U) && (a.back() == 2U) && (a.get_allocator().resource() == &value_resource) && result_is_ok);
+    result_is_ok = ((other_resource.bytes_outstanding() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+    local_pmr_array_type c(static_cast<std::size_t>(UINT8_C(3)), static_cast<std::uint32_t>(UINT8_C(3)), &value_resource);
+
+    a.swap(c);
+
+    result_is_ok = ((a.size() == 3U) && (c.size() == 4U) && (a.front() == 3U) && (c.front() == 2U) && result_is_ok);
+
+    const auto count_before = value_resource.allocation_count();
+
+    a = std::move(c);
+
+    result_is_ok = ((a.size() == 4U) && (value_resource.allocation_count() == count_before) && result_is_ok);
+  }
+
+  {
+    // The standard allocator propagates on move assignment,
+    // so the storage of the source is adopted.
+    util::dynamic_array<std::uint32_t> a(static_cast<std::size_t>(UINT8_C(3)), static_cast<std::uint32_t>(UINT8_C(5)));
+    util::dynamic_array<std::uint32_t> b(static_cast<std::size_t>(UINT8_C(7)), static_cast<std::uint32_t>(UINT8_C(6)));
+
+    const auto* p_b = b.data();
+
+    a = std::move(b);
+
+    result_is_ok = ((a.size() == 7U) && (a.data() == p_b) && b.empty() && result_is_ok);
+  }
+
+  result_is_ok = ((value_resource.bytes_outstanding() == static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_pmr
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_pmr_____________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_pmr_____________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if defined(WIDE_DECIMAL_HAS_MEMORY_RESOURCE)
+  result_is_ok = (test_decwide_t_pmr::test_memory_resource() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,206 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_progress {
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_checkpoint_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+using local_agm_checkpoint_type          = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::agm_checkpoint<local_wide_decimal_checkpoint_type>;
+using local_agm_checkpoint_kind          = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::agm_checkpoint_kind;
+#else
+using local_wide_decimal_checkpoint_type = ::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+using local_agm_checkpoint_type          = ::math::wide_decimal::agm_checkpoint<local_wide_decimal_checkpoint_type>;
+using local_agm_checkpoint_kind          = ::math::wide_decimal::agm_checkpoint_kind;
+#endif
+
+#if !defined(WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK)
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_progress_report_type   = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::progress::report;
+using local_progress_scope_type    = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::progress::scope;
+using local_progress_function_kind = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::progress::function_kind;
+#else
+using local_progress_report_type   = ::math::wide_decimal::progress::report;
+using local_progress_scope_type    = ::math::wide_decimal::progress::scope;
+using local_progress_function_kind = ::math::wide_decimal::progress::function_kind;
+#endif
+
+std::uint32_t progress_report_count     { };     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::uint32_t progress_log_report_count { };     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+std::uint32_t progress_pi_report_count  { };     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+bool          progress_digits_are_ok    { true }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+auto test_progress_callback() -> bool
+{
+  auto result_is_ok = true;
+
+  const auto count_and_continue =
+    [](const local_progress_report_type& r) // NOLINT(modernize-use-trailing-return-type)
+    {
+      ++progress_report_count;
+
+      if(r.kind == local_progress_function_kind::log)
+      {
+        ++progress_log_report_count;
+      }
+
+      progress_digits_are_ok = ((r.digits10 >= 0) && (r.digits10 <= r.goal_digits10) && progress_digits_are_ok);
+
+      return true;
+    };
+
+  const auto cancel_at_once =
+    [](const local_progress_report_type&) // NOLINT(modernize-use-trailing-return-type,hicpp-named-parameter,readability-named-parameter)
+    {
+      ++progress_report_count;
+
+      return false;
+    };
+
+  // Cancel pi after its second iteration.
+  const auto cancel_pi_after_two =
+    [](const local_progress_report_type& r) // NOLINT(modernize-use-trailing-return-type)
+    {
+      if(r.kind == local_progress_function_kind::pi)
+      {
+        ++progress_pi_report_count;
+      }
+
+      return (progress_pi_report_count < static_cast<std::uint32_t>(UINT8_C(2)));
+    };
+
+  // A cancelled Newton or AGM iteration for sqrt, the inverse or pi
+  // returns its last iterate, which is close to the exact value but
+  // not accurate to full precision.
+  const auto is_partial_result =
+    [](const local_wide_decimal_checkpoint_type& y, const local_wide_decimal_checkpoint_type& y_ctrl) -> bool // NOLINT(modernize-use-trailing-return-type)
+    {
+      using std::fabs;
+
+      return (   (y != y_ctrl)
+              && (!y.iszero())
+              && (fabs(y - y_ctrl) < (fabs(y_ctrl) / 100U)));
+    };
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  const auto pi_ctrl = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<INT32_C(101), std::uint32_t, std::allocator<void>>();
+  #else
+  const auto pi_ctrl = ::math::wide_decimal::calc_pi<INT32_C(101), std::uint32_t, std::allocator<void>>();
+  #endif
+
+  const auto x = local_wide_decimal_checkpoint_type(7U) / 3U;
+
+  const auto log_ctrl  = log(x);
+  const auto sqrt_ctrl = sqrt(x);
+
+  {
+    // Every iteration is reported, and the results are unchanged.
+    progress_report_count     = static_cast<std::uint32_t>(UINT8_C(0));
+    progress_log_report_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const local_progress_scope_type progress_scope(count_and_continue);
+
+    const auto log_x = log(x);
+
+    result_is_ok = (   (log_x == log_ctrl)
+                    && (progress_report_count     > progress_log_report_count)
+                    && (progress_log_report_count > static_cast<std::uint32_t>(UINT8_C(0)))
+                    && progress_digits_are_ok
+                    && (!progress_scope.cancelled())
+                    && result_is_ok);
+  }
+
+  {
+    // A cancellation ends the calculation, and all the
+    // calculations that follow in the scope, at once.
+    progress_report_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    const local_progress_scope_type progress_scope(cancel_at_once);
+
+    const auto log_x = log(x);
+
+    const auto sqrt_x = sqrt(x);
+
+    const auto inv_x = local_wide_decimal_checkpoint_type(x).calculate_inv();
+
+    // The cancelled functions leave their last iterates, and
+    // only the scope tells that they have been cancelled. The
+    // AGM of log() is far from converged after one iteration.
+    result_is_ok = (   (log_x != log_ctrl)
+                    && is_partial_result(sqrt_x, sqrt_ctrl)
+                    && is_partial_result(inv_x,  local_wide_decimal_checkpoint_type(3U) / 7U)
+                    && (progress_report_count == static_cast<std::uint32_t>(UINT8_C(1)))
+                    && progress_scope.cancelled()
+                    && result_is_ok);
+  }
+
+  // The cancellation does not outlast its scope.
+  result_is_ok = (   (!local_progress_scope_type::cancelled())
+                  && (log(x) == log_ctrl)
+                  && (sqrt(x) == sqrt_ctrl)
+                  && result_is_ok);
+
+  {
+    // A cancelled pi leaves a checkpoint that can be resumed.
+    local_agm_checkpoint_type checkpoint { };
+
+    progress_pi_report_count = static_cast<std::uint32_t>(UINT8_C(0));
+
+    auto pi_cancelled = local_wide_decimal_checkpoint_type { };
+
+    {
+      const local_progress_scope_type progress_scope(cancel_pi_after_two);
+
+      pi_cancelled = calc_pi(checkpoint, nullptr);
+
+      result_is_ok = (progress_scope.cancelled() && result_is_ok);
+    }
+
+    const auto iteration_of_cancel = checkpoint.iteration;
+
+    const auto pi_resumed = calc_pi(checkpoint, nullptr);
+
+    result_is_ok = (   is_partial_result(pi_cancelled, pi_ctrl)
+                    && (iteration_of_cancel == static_cast<std::uint32_t>(UINT8_C(2)))
+                    && (pi_resumed == pi_ctrl)
+                    && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_progress
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_progress________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_progress________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_PROGRESS_CALLBACK)
+  result_is_ok = (test_decwide_t_progress::test_progress_callback() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,286 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_raw_limbs {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+auto local_zero    () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_zero(0U); return my_zero; }
+auto local_one     () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_one (1U); return my_one; }
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+#if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+auto test_raw_limbs() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_wide_decimal_type_limb32 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+
+  using WIDE_DECIMAL_NAMESPACE::math::wide_decimal::raw_limbs;
+  using WIDE_DECIMAL_NAMESPACE::math::wide_decimal::noraw_limbs;
+  #else
+  using local_wide_decimal_type_limb32 = ::math::wide_decimal::decwide_t<INT32_C(101), std::uint32_t, std::allocator<void>>;
+
+  using ::math::wide_decimal::raw_limbs;
+  using ::math::wide_decimal::noraw_limbs;
+  #endif
+
+  eng_sgn.seed(util::util_pseudorandom_time_point_seed::value<typename eng_sgn_type::result_type>());
+  eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+  eng_exp.seed(util::util_pseudorandom_time_point_seed::value<typename eng_exp_type::result_type>());
+
+  auto result_is_ok = true;
+
+  const auto is_same_image =
+    [](const local_wide_decimal_type& a, const local_wide_decimal_type& b) -> bool // NOLINT(modernize-use-trailing-return-type)
+    {
+      return (   std::equal(a.crepresentation().cbegin(), a.crepresentation().cend(), b.crepresentation().cbegin())
+              && (ilogb(a) == ilogb(b))
+              && (a.isneg() == b.isneg())
+              && (local_wide_decimal_type::get_precision(a) == local_wide_decimal_type::get_precision(b)));
+    };
+
+  {
+    // Write values of all kinds through the manipulator and read them back.
+    std::vector<local_wide_decimal_type> values(static_cast<std::size_t>(UINT8_C(32)));
+
+    std::generate(values.begin(), values.end(), []() { return generate_wide_decimal_value<local_wide_decimal_type>(); }); // NOLINT(modernize-use-trailing-return-type)
+
+    values[static_cast<std::size_t>(UINT8_C(0))] = local_zero();
+    values[static_cast<std::size_t>(UINT8_C(1))] = -local_one();
+    values[static_cast<std::size_t>(UINT8_C(2))] = (std::numeric_limits<local_wide_decimal_type>::min)();
+    values[static_cast<std::size_t>(UINT8_C(3))] = -(std::numeric_limits<local_wide_decimal_type>::max)();
+
+    values[static_cast<std::size_t>(UINT8_C(4))].precision(static_cast<std::int32_t>(INT8_C(20)));
+
+    std::stringstream strm;
+
+    strm << raw_limbs;
+
+    for(const auto& x : values)
+    {
+      strm << x << ' ';
+    }
+
+    std::vector<local_wide_decimal_type> values_read(values.size());
+
+    for(auto& y : values_read)
+    {
+      strm >> y;
+    }
+
+    result_is_ok = ((!strm.fail()) && result_is_ok);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < values.size(); ++i)
+    {
+      result_is_ok = (is_same_image(values[i], values_read[i]) && result_is_ok);
+    }
+
+    // The manipulator noraw_limbs restores the decimal output.
+    std::stringstream strm_dec;
+
+    strm_dec << raw_limbs << noraw_limbs << std::fixed << std::setprecision(2) << local_wide_decimal_type(1U) / 4U;
+
+    result_is_ok = ((strm_dec.str() == "0.25") && result_is_ok);
+  }
+
+  {
+    // The raw image of 1/3 is spelled out limb by limb.
+    const local_wide_decimal_type_limb32 third = local_wide_decimal_type_limb32(1U) / 3U;
+
+    std::vector<char> buf(local_wide_decimal_type_limb32::raw_chars_max_size());
+
+    const auto result_to = to_chars_raw(buf.data(), buf.data() + buf.size(), third); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto str = std::string(buf.data(), result_to.ptr);
+
+    local_wide_decimal_type_limb32 y { };
+
+    const auto result_from = from_chars_raw(str.data(), str.data() + str.length(), y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    result_is_ok = (   (result_to.ec == std::errc())
+                    && (str.substr(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(33))) == "DW1:4:+:-8:10:10:01fca05501fca055")
+                    && (result_from.ec == std::errc())
+                    && (result_from.ptr == str.data() + str.length()) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    && std::equal(y.crepresentation().cbegin(), y.crepresentation().cend(), third.crepresentation().cbegin())
+                    && (y == third)
+                    && result_is_ok);
+  }
+
+  {
+    // Invalid input is reported and leaves the value untouched.
+    const std::array<const char*, static_cast<std::size_t>(UINT8_C(9))> str_bad =
+    {{
+      "DW2:2:+:0:d:1:0001",
+      "DW1:4:+:0:d:1:0001",
+      "DW1:2:*:0:d:1:0001",
+      "DW1:2:+:1:d:1:0001",
+      "DW1:2:+:0:0:1:0001",
+      "DW1:2:+:0:d:2:0001",
+      "DW1:2:+:0:d:1:2710",
+      "DW1:2:+:0:d:1:00x1",
+      "DW1:2:+:0:d:2:00000001"
+    }};
+
+    for(const auto* p_str : str_bad)
+    {
+      local_wide_decimal_type y(42U);
+
+      const auto result_from = from_chars_raw(p_str, p_str + std::strlen(p_str), y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      result_is_ok = (   (result_from.ec == std::errc::invalid_argument)
+                      && (result_from.ptr == p_str)
+                      && (y == 42U)
+                      && result_is_ok);
+    }
+
+    std::stringstream strm("DW1:2:+:0:d:1:00x1");
+
+    local_wide_decimal_type y { };
+
+    strm >> y;
+
+    result_is_ok = (strm.fail() && result_is_ok);
+
+    std::array<char, static_cast<std::size_t>(UINT8_C(16))> buf_small { };
+
+    const auto result_small = to_chars_raw(buf_small.data(), buf_small.data() + buf_small.size(), local_one()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    result_is_ok = ((result_small.ec == std::errc::value_too_large) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_raw_limbs
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_raw_limbs_______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_raw_limbs_______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+  result_is_ok = (test_decwide_t_raw_limbs::test_raw_limbs() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
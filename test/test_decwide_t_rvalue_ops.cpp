@@ -0,0 +1,158 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+#include <utility>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_rvalue_ops {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+auto counting_allocator_count() -> std::size_t&
+{
+  static std::size_t my_count { };
+
+  return my_count;
+}
+
+template<typename ValueType>
+class counting_allocator
+{
+public:
+  using value_type = ValueType;
+
+  counting_allocator() noexcept = default;
+
+  template<typename OtherValueType>
+  counting_allocator(const counting_allocator<OtherValueType>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions,hicpp-named-parameter,readability-named-parameter)
+
+  auto allocate(std::size_t count) -> value_type*
+  {
+    ++counting_allocator_count();
+
+    return std::allocator<value_type>().allocate(count);
+  }
+
+  auto deallocate(value_type* p, std::size_t count) -> void
+  {
+    std::allocator<value_type>().deallocate(p, count);
+  }
+};
+
+template<typename ValueType, typename OtherValueType> auto operator==(const counting_allocator<ValueType>&, const counting_allocator<OtherValueType>&) -> bool { return true; }  // NOLINT(hicpp-named-parameter,readability-named-parameter)
+template<typename ValueType, typename OtherValueType> auto operator!=(const counting_allocator<ValueType>&, const counting_allocator<OtherValueType>&) -> bool { return false; } // NOLINT(hicpp-named-parameter,readability-named-parameter)
+
+auto test_rvalue_operators() -> bool
+{
+  auto result_is_ok = true;
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_counting_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, counting_allocator<void>>;
+  #else
+  using local_counting_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, counting_allocator<void>>;
+  #endif
+
+  const local_counting_wide_decimal_type a = local_counting_wide_decimal_type(1U) / 3U;
+  const local_counting_wide_decimal_type b = local_counting_wide_decimal_type(2U) / 7U;
+  const local_counting_wide_decimal_type c = local_counting_wide_decimal_type(5U) / 9U;
+
+  {
+    // A chain of binary operators allocates no more often
+    // than the equivalent sequence of compound assignments.
+    const auto count_compound_start = counting_allocator_count();
+
+    local_counting_wide_decimal_type r_compound(a);
+
+    r_compound *= b;
+    r_compound += c;
+    r_compound *= 3U;
+    r_compound -= 1;
+    r_compound /= c;
+
+    const auto count_compound = counting_allocator_count() - count_compound_start;
+
+    const auto count_binary_start = counting_allocator_count();
+
+    const local_counting_wide_decimal_type r_binary = ((((a * b) + c) * 3U) - 1) / c;
+
+    const auto count_binary = counting_allocator_count() - count_binary_start;
+
+    result_is_ok = ((count_binary == count_compound) && (r_binary == r_compound) && result_is_ok);
+  }
+
+  {
+    // A temporary left-hand operand hands its limbs on to the result.
+    local_counting_wide_decimal_type x(a);
+
+    const auto* p_limbs = x.crepresentation().cbegin();
+
+    const local_counting_wide_decimal_type y = std::move(x) * b; // NOLINT(performance-move-const-arg,hicpp-move-const-arg)
+
+    result_is_ok = ((y.crepresentation().cbegin() == p_limbs) && (y == (a * b)) && result_is_ok);
+
+    // A moved-from value can be assigned to again.
+    x = c; // NOLINT(bugprone-use-after-move,hicpp-invalid-access-moved)
+
+    result_is_ok = ((x == c) && (x.crepresentation().size() == c.crepresentation().size()) && result_is_ok);
+  }
+
+  {
+    // Built-in left-hand operands combine with temporaries as well.
+    const local_counting_wide_decimal_type z = (2U * (a + b)) - (1.5F / (b * c));
+
+    local_counting_wide_decimal_type z_compound(a);
+
+    z_compound += b;
+    z_compound *= 2U;
+
+    local_counting_wide_decimal_type z_other(1.5F);
+
+    z_other /= (b * c);
+
+    z_compound -= z_other;
+
+    result_is_ok = ((z == z_compound) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_rvalue_ops
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_rvalue_ops______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_rvalue_ops______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_rvalue_ops::test_rvalue_operators() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,294 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+#include <util/utility/util_memory_mapped_file.h>
+
+namespace test_decwide_t_serialize {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+#if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+auto test_binary_serialization() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  auto result_is_ok = true;
+
+  const auto x = generate_wide_decimal_value<local_wide_decimal_type>();
+
+  std::vector<std::uint8_t> buf(local_wide_decimal_type::serialized_size());
+
+  const auto result_ser = serialize(buf.data(), buf.data() + buf.size(), x);
+
+  result_is_ok = ((result_ser.ec == std::errc()) && (result_ser.ptr == buf.data() + buf.size()) && result_is_ok);
+
+  {
+    local_wide_decimal_type y { };
+
+    const auto result_deser = deserialize(buf.data(), buf.data() + buf.size(), y);
+
+    const auto result_round_trip_is_ok =
+      (
+           (result_deser.ec  == std::errc())
+        && (result_deser.ptr == buf.data() + buf.size())
+        && (y == x)
+        && (y.isneg() == x.isneg())
+        && std::equal(y.crepresentation().cbegin(), y.crepresentation().cend(), x.crepresentation().cbegin())
+      );
+
+    result_is_ok = (result_round_trip_is_ok && result_is_ok);
+  }
+
+  {
+    // Short buffers and corrupted data are reported and leave the value untouched.
+    std::vector<std::uint8_t> buf_short(buf.size() - static_cast<std::size_t>(UINT8_C(1)));
+
+    const auto result_ser_short = serialize(buf_short.data(), buf_short.data() + buf_short.size(), x);
+
+    result_is_ok = ((result_ser_short.ec == std::errc::value_too_large) && result_is_ok);
+
+    local_wide_decimal_type y(42U);
+
+    const auto result_deser_short = deserialize(buf.data(), buf.data() + buf_short.size(), y);
+
+    auto buf_bad_magic = buf;
+
+    buf_bad_magic.front() = static_cast<std::uint8_t>(buf_bad_magic.front() ^ static_cast<std::uint8_t>(UINT8_C(0xFF)));
+
+    const auto result_deser_bad = deserialize(buf_bad_magic.data(), buf_bad_magic.data() + buf_bad_magic.size(), y);
+
+    result_is_ok = (   (result_deser_short.ec == std::errc::invalid_argument)
+                    && (result_deser_bad.ec   == std::errc::invalid_argument)
+                    && (y == 42U)
+                    && result_is_ok);
+  }
+
+  {
+    // Out-of-range limbs, precisions and signs are rejected.
+    const auto deserialize_corrupted =
+      [&buf](const std::size_t offset, const std::uint8_t byte_value) // NOLINT(modernize-use-trailing-return-type)
+      {
+        auto buf_bad = buf;
+
+        buf_bad[offset] = byte_value;
+
+        local_wide_decimal_type y(42U);
+
+        const auto result_deser = deserialize(buf_bad.data(), buf_bad.data() + buf_bad.size(), y);
+
+        return ((result_deser.ec == std::errc::invalid_argument) && (result_deser.ptr == buf_bad.data()) && (y == 42U));
+      };
+
+    // Offsets 7 and 21 hold the sign and the second byte of prec_elem.
+    // The limbs start at offset 32, and a 16-bit limb of 0xFFFF
+    // exceeds the limb mask.
+    result_is_ok = (deserialize_corrupted(static_cast<std::size_t>(UINT8_C( 7)), static_cast<std::uint8_t>(UINT8_C(2)))    && result_is_ok);
+    result_is_ok = (deserialize_corrupted(static_cast<std::size_t>(UINT8_C(21)), static_cast<std::uint8_t>(UINT8_C(0x7F))) && result_is_ok);
+
+    auto buf_big_limb = buf;
+
+    buf_big_limb[static_cast<std::size_t>(UINT8_C(32))] = static_cast<std::uint8_t>(UINT8_C(0xFF));
+    buf_big_limb[static_cast<std::size_t>(UINT8_C(33))] = static_cast<std::uint8_t>(UINT8_C(0xFF));
+
+    local_wide_decimal_type y(42U);
+
+    const auto result_deser_big_limb = deserialize(buf_big_limb.data(), buf_big_limb.data() + buf_big_limb.size(), y);
+
+    result_is_ok = ((result_deser_big_limb.ec == std::errc::invalid_argument) && (y == 42U) && result_is_ok);
+  }
+
+  {
+    // Values can be exchanged between precisions having the same limb type.
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    using local_wide_decimal_wider_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10 * 2, local_limb_type, std::allocator<void>>;
+    #else
+    using local_wide_decimal_wider_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10 * 2, local_limb_type, std::allocator<void>>;
+    #endif
+
+    const local_wide_decimal_wider_type w = local_wide_decimal_wider_type(1U) / 3U;
+
+    std::vector<std::uint8_t> buf_w(local_wide_decimal_wider_type::serialized_size());
+
+    static_cast<void>(serialize(buf_w.data(), buf_w.data() + buf_w.size(), w));
+
+    local_wide_decimal_type y { };
+
+    const auto result_narrow = deserialize(buf_w.data(), buf_w.data() + buf_w.size(), y);
+
+    local_wide_decimal_wider_type z { };
+
+    const auto result_wide = deserialize(buf.data(), buf.data() + buf.size(), z);
+
+    const auto result_exchange_is_ok =
+      (
+           (result_narrow.ec == std::errc())
+        && (result_wide.ec   == std::errc())
+        && (y == local_wide_decimal_type(1U) / 3U)
+        && std::equal(x.crepresentation().cbegin(), x.crepresentation().cend(), z.crepresentation().cbegin())
+        && (z.crepresentation().back() == static_cast<local_limb_type>(UINT8_C(0)))
+      );
+
+    result_is_ok = (result_exchange_is_ok && result_is_ok);
+  }
+
+  {
+    // Read the value back from a memory-mapped file.
+    const char* filename = "test_decwide_t_algebra_edge_serialization.bin";
+
+    std::FILE* p_file = std::fopen(filename, "wb"); // NOLINT(cppcoreguidelines-owning-memory)
+
+    if(p_file != nullptr)
+    {
+      const auto count_written = std::fwrite(buf.data(), static_cast<std::size_t>(UINT8_C(1)), buf.size(), p_file);
+
+      static_cast<void>(std::fclose(p_file)); // NOLINT(cppcoreguidelines-owning-memory)
+
+      local_wide_decimal_type y { };
+
+      {
+        const util::memory_mapped_file mapped_file(filename);
+
+        const auto result_deser = deserialize(mapped_file.begin(), mapped_file.end(), y);
+
+        result_is_ok = (   (count_written == buf.size())
+                        && mapped_file.is_open()
+                        && (mapped_file.size() == buf.size())
+                        && (result_deser.ec == std::errc())
+                        && (y == x)
+                        && result_is_ok);
+      }
+
+      static_cast<void>(std::remove(filename));
+    }
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_serialize
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_serialize_______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_serialize_______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SERIALIZATION)
+  result_is_ok = (test_decwide_t_serialize::test_binary_serialization() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
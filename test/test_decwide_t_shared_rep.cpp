@@ -0,0 +1,160 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_shared_rep {
+
+#if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+auto test_shared_representation() -> bool
+{
+  auto result_is_ok = true;
+
+  constexpr std::int32_t local_shared_digits10 = INT32_C(1001);
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_shared_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_shared_digits10, std::uint32_t, WIDE_DECIMAL_NAMESPACE::math::wide_decimal::shared_representation<std::allocator<void>>>;
+  using local_std_wide_decimal_type    = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_shared_digits10, std::uint32_t, std::allocator<void>>;
+  #else
+  using local_shared_wide_decimal_type = ::math::wide_decimal::decwide_t<local_shared_digits10, std::uint32_t, ::math::wide_decimal::shared_representation<std::allocator<void>>>;
+  using local_std_wide_decimal_type    = ::math::wide_decimal::decwide_t<local_shared_digits10, std::uint32_t, std::allocator<void>>;
+  #endif
+
+  const auto result_matches =
+    [](const local_shared_wide_decimal_type& a, const local_std_wide_decimal_type& b) // NOLINT(modernize-use-trailing-return-type)
+    {
+      return (   (a.isneg() == b.isneg())
+              && (ilogb(a) == ilogb(b))
+              && std::equal(a.crepresentation().cbegin(), a.crepresentation().cend(), b.crepresentation().cbegin()));
+    };
+
+  const auto x_shared = sqrt(local_shared_wide_decimal_type(2U)) / 3U;
+  const auto x_std    = sqrt(local_std_wide_decimal_type   (2U)) / 3U;
+
+  result_is_ok = (result_matches(x_shared, x_std) && result_is_ok);
+
+  {
+    // Copies share the limbs until one of them is modified.
+    auto y = x_shared;
+
+    result_is_ok = ((y.crepresentation().cbegin() == x_shared.crepresentation().cbegin()) && result_is_ok);
+    result_is_ok = (y.crepresentation().is_shared() && result_is_ok);
+
+    y *= y;
+
+    result_is_ok = ((y.crepresentation().cbegin() != x_shared.crepresentation().cbegin()) && result_is_ok);
+    result_is_ok = ((!x_shared.crepresentation().is_shared()) && result_is_ok);
+
+    result_is_ok = (result_matches(x_shared, x_std) && result_is_ok);
+    result_is_ok = (result_matches(y, x_std * x_std) && result_is_ok);
+  }
+
+  {
+    // Copies of the cached constants do not copy their limbs.
+    #if defined(WIDE_DECIMAL_NAMESPACE)
+    const local_shared_wide_decimal_type my_pi       = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, WIDE_DECIMAL_NAMESPACE::math::wide_decimal::shared_representation<std::allocator<void>>>();
+    const local_shared_wide_decimal_type my_pi_again = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, WIDE_DECIMAL_NAMESPACE::math::wide_decimal::shared_representation<std::allocator<void>>>();
+    const local_std_wide_decimal_type    my_pi_std   = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, std::allocator<void>>();
+    #else
+    const local_shared_wide_decimal_type my_pi       = ::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, ::math::wide_decimal::shared_representation<std::allocator<void>>>();
+    const local_shared_wide_decimal_type my_pi_again = ::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, ::math::wide_decimal::shared_representation<std::allocator<void>>>();
+    const local_std_wide_decimal_type    my_pi_std   = ::math::wide_decimal::pi<local_shared_digits10, std::uint32_t, std::allocator<void>>();
+    #endif
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CACHED_CONSTANTS)
+    result_is_ok = ((my_pi.crepresentation().cbegin() == my_pi_again.crepresentation().cbegin()) && result_is_ok);
+    #endif
+
+    auto z = my_pi;
+
+    z += x_shared;
+    z -= my_pi;
+
+    auto z_std = my_pi_std;
+
+    z_std += x_std;
+    z_std -= my_pi_std;
+
+    result_is_ok = (result_matches(exp(log(z)), exp(log(z_std))) && result_is_ok);
+    result_is_ok = (result_matches(my_pi,       my_pi_std) && result_is_ok);
+    result_is_ok = (result_matches(my_pi_again, my_pi_std) && result_is_ok);
+  }
+
+  {
+    // Each mutating operation detaches a copy before writing to it,
+    // so that the value that it shares its limbs with is unchanged.
+    const auto x_ref = x_shared;
+
+    std::array<local_shared_wide_decimal_type, static_cast<std::size_t>(UINT8_C(8))> y { };
+
+    y.fill(x_ref);
+
+    y[0U] += x_ref / 7U;
+    y[1U] -= local_shared_wide_decimal_type(5U);
+    y[2U] *= 7U;
+    y[3U] /= 7U;
+    y[4U].calculate_inv();
+
+    const char str_value[] = "1.25e3"; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+    static_cast<void>(from_chars(str_value, str_value + (sizeof(str_value) - 1U), y[5U])); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    #else
+    y[5U] = local_shared_wide_decimal_type(str_value); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    #endif
+
+    y[6U].representation()[1U] = static_cast<std::uint32_t>(UINT8_C(0));
+
+    y[7U] = floor(y[7U] * 100U);
+
+    result_is_ok = (result_matches(x_ref, x_std) && result_matches(x_shared, x_std) && result_is_ok);
+
+    result_is_ok = (result_matches(y[0U], x_std + x_std / 7U) && result_is_ok);
+    result_is_ok = (result_matches(y[1U], x_std - local_std_wide_decimal_type(5U)) && result_is_ok);
+    result_is_ok = (result_matches(y[2U], x_std * 7U) && result_is_ok);
+    result_is_ok = (result_matches(y[3U], x_std / 7U) && result_is_ok);
+    result_is_ok = (result_matches(y[4U], 1U / x_std) && result_is_ok);
+    result_is_ok = (result_matches(y[5U], local_std_wide_decimal_type(1250U)) && result_is_ok);
+    result_is_ok = ((y[6U].crepresentation()[1U] == static_cast<std::uint32_t>(UINT8_C(0))) && result_is_ok);
+    result_is_ok = (result_matches(y[7U], floor(x_std * 100U)) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_shared_rep
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_shared_rep______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_shared_rep______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_SHARED_REPRESENTATION)
+  result_is_ok = (test_decwide_t_shared_rep::test_shared_representation() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
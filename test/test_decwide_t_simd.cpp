@@ -0,0 +1,149 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_simd {
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+#if defined(WIDE_DECIMAL_HAS_SIMD_MULTIPLY)
+auto test_simd_multiply() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  namespace local_detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+  #else
+  namespace local_detail = ::math::wide_decimal::detail;
+  #endif
+
+  // The reference product is taken with the scalar kernel of uint8
+  // limbs, four of which make up a uint32 limb. The maximum limbs
+  // give the largest column sums and carries.
+  std::uniform_int_distribution<std::uint32_t> dist_limb(UINT32_C(0), UINT32_C(99999999));
+
+  auto result_is_ok = true;
+
+  for(const auto count : { INT32_C(1), INT32_C(11), INT32_C(12), INT32_C(13), INT32_C(31), INT32_C(64), INT32_C(112), INT32_C(113), INT32_C(256), INT32_C(257) })
+  {
+    const auto elems = static_cast<std::size_t>(count);
+
+    for(auto trial = static_cast<unsigned>(UINT8_C(0)); trial < static_cast<unsigned>(UINT8_C(2)); ++trial)
+    {
+      std::vector<std::uint32_t> u(elems);
+      std::vector<std::uint32_t> v(elems);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < elems; ++i)
+      {
+        u[i] = ((trial == 0U) ? dist_limb(eng_dig) : static_cast<std::uint32_t>(UINT32_C(99999999)));
+        v[i] = ((trial == 0U) ? dist_limb(eng_dig) : static_cast<std::uint32_t>(UINT32_C(99999999)));
+      }
+
+      constexpr std::array<std::uint32_t, static_cast<std::size_t>(UINT8_C(4))> places = {{ UINT32_C(1000000), UINT32_C(10000), UINT32_C(100), UINT32_C(1) }};
+
+      std::vector<std::uint8_t> u8(elems * 4U);
+      std::vector<std::uint8_t> v8(elems * 4U);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < u8.size(); ++i)
+      {
+        u8[i] = static_cast<std::uint8_t>((u[i / 4U] / places[i % 4U]) % UINT32_C(100));
+        v8[i] = static_cast<std::uint8_t>((v[i / 4U] / places[i % 4U]) % UINT32_C(100));
+      }
+
+      std::vector<std::uint8_t> r8(elems * 8U);
+
+      local_detail::eval_multiply_n_by_n_to_2n(r8.data(), static_cast<const std::uint8_t*>(u8.data()), static_cast<const std::uint8_t*>(v8.data()), static_cast<std::int_fast32_t>(count * 4));
+
+      std::vector<std::uint32_t> r_reference(elems * 2U, static_cast<std::uint32_t>(UINT8_C(0)));
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < r8.size(); ++i)
+      {
+        r_reference[i / 4U] = static_cast<std::uint32_t>(r_reference[i / 4U] + static_cast<std::uint32_t>(r8[i] * places[i % 4U]));
+      }
+
+      // The dispatched kernel and each vectorized kernel that
+      // the processor supports give the reference product.
+      std::vector<std::uint32_t> r(elems * 2U);
+
+      local_detail::eval_multiply_n_by_n_to_2n(r.data(), static_cast<const std::uint32_t*>(u.data()), static_cast<const std::uint32_t*>(v.data()), static_cast<std::int_fast32_t>(count));
+
+      result_is_ok = ((r == r_reference) && result_is_ok);
+
+      for(const auto kernel : { local_detail::simd_multiply_kernel::avx2, local_detail::simd_multiply_kernel::avx512 })
+      {
+        std::fill(r.begin(), r.end(), static_cast<std::uint32_t>(UINT8_C(0)));
+
+        const auto kernel_is_used =
+          local_detail::eval_multiply_n_by_n_to_2n_simd(r.data(), u.data(), v.data(), static_cast<std::int_fast32_t>(count), kernel);
+
+        const auto kernel_is_expected =
+        (
+             local_detail::simd_multiply_kernel_supported(kernel)
+          && (count >= local_detail::simd_multiply_elems_min)
+          && (count <= local_detail::simd_multiply_elems_max)
+        );
+
+        result_is_ok = (   (kernel_is_used == kernel_is_expected)
+                        && ((!kernel_is_used) || (r == r_reference))
+                        && result_is_ok);
+      }
+    }
+  }
+
+  // The scalar kernel is always supported, but never used here.
+  std::vector<std::uint32_t> u(static_cast<std::size_t>(UINT8_C(32)), static_cast<std::uint32_t>(UINT8_C(1)));
+  std::vector<std::uint32_t> r(u.size() * 2U);
+
+  result_is_ok = (   local_detail::simd_multiply_kernel_supported(local_detail::simd_multiply_kernel::scalar)
+                  && (!local_detail::eval_multiply_n_by_n_to_2n_simd(r.data(), u.data(), u.data(), static_cast<std::int_fast32_t>(u.size()), local_detail::simd_multiply_kernel::scalar))
+                  && result_is_ok);
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_simd
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_simd____________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_simd____________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if defined(WIDE_DECIMAL_HAS_SIMD_MULTIPLY)
+  result_is_ok = (test_decwide_t_simd::test_simd_multiply() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,164 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <test/test_decwide_t_features.h>
+#include <util/memory/util_n_slot_array_allocator.h>
+#include <util/memory/util_n_slot_array_allocator_atomic.h>
+
+namespace test_decwide_t_slot_alloc {
+
+auto test_n_slot_array_allocators() -> bool
+{
+  auto result_is_ok = true;
+
+  {
+    using local_allocator_type = util::n_slot_array_allocator<std::uint32_t, 8U, 16U>; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    local_allocator_type alloc;
+
+    std::array<std::uint32_t*, 16U> p_slots { }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    for(auto& p : p_slots)
+    {
+      p = alloc.allocate(8U);
+
+      result_is_ok = ((p != nullptr) && result_is_ok);
+    }
+
+    result_is_ok = ((local_allocator_type::get_slot_max_index() == 15U) && result_is_ok);
+    result_is_ok = ((local_allocator_type::get_slot_used_count() == 16U) && result_is_ok);
+
+    // All slots are in use, so the next allocation fails.
+    result_is_ok = ((alloc.allocate(8U) == nullptr) && result_is_ok);
+    result_is_ok = ((local_allocator_type::get_slot_failed_allocations() == 1U) && result_is_ok);
+
+    // Recycled slots are handed out again, most recently freed first.
+    alloc.deallocate(p_slots[3U], 8U);
+    alloc.deallocate(p_slots[9U], 8U);
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count() == 14U) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == p_slots[9U]) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == p_slots[3U]) && result_is_ok);
+
+    // A double free is ignored and leaves the free-list intact.
+    alloc.deallocate(p_slots[5U], 8U);
+    alloc.deallocate(p_slots[5U], 8U);
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count() == 15U) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == p_slots[5U]) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == nullptr) && result_is_ok);
+
+    for(auto& p : p_slots)
+    {
+      alloc.deallocate(p, 8U);
+    }
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count() ==  0U) && result_is_ok);
+    result_is_ok = ((local_allocator_type::get_slot_max_index () == 15U) && result_is_ok);
+  }
+
+  {
+    using local_allocator_type = util::n_slot_array_allocator_atomic<std::uint32_t, 8U, 2U>; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    local_allocator_type alloc;
+
+    auto p_first  = alloc.allocate(8U);
+    auto p_second = alloc.allocate(8U);
+
+    // The atomic variant also ignores a double free.
+    alloc.deallocate(p_first, 8U);
+    alloc.deallocate(p_first, 8U);
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count() == 1U) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == p_first) && result_is_ok);
+    result_is_ok = ((alloc.allocate(8U) == nullptr) && result_is_ok);
+
+    alloc.deallocate(p_first,  8U);
+    alloc.deallocate(p_second, 8U);
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count() == 0U) && result_is_ok);
+  }
+
+  {
+    using local_allocator_type = util::n_slot_array_allocator_atomic<std::uint32_t, 8U, 64U>; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    std::atomic<bool> result_threads_are_ok { true };
+
+    const auto churn =
+      [&result_threads_are_ok](const std::uint32_t id) // NOLINT(modernize-use-trailing-return-type)
+      {
+        local_allocator_type alloc;
+
+        for(auto loop = static_cast<unsigned>(UINT8_C(0)); loop < static_cast<unsigned>(UINT16_C(2000)); ++loop)
+        {
+          std::array<std::uint32_t*, 8U> p_slots { }; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+          for(auto& p : p_slots)
+          {
+            p = alloc.allocate(8U);
+
+            if(p == nullptr) { result_threads_are_ok = false; return; }
+
+            std::fill(p, p + 8U, id); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          }
+
+          for(auto& p : p_slots)
+          {
+            // A slot handed out twice would show another thread's id.
+            if(!std::all_of(p, p + 8U, [&id](const std::uint32_t& u) { return (u == id); })) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic,modernize-use-trailing-return-type)
+            {
+              result_threads_are_ok = false;
+            }
+
+            alloc.deallocate(p, 8U);
+          }
+        }
+      };
+
+    std::vector<std::thread> pool { };
+
+    for(auto id = static_cast<std::uint32_t>(UINT8_C(0)); id < static_cast<std::uint32_t>(UINT8_C(4)); ++id)
+    {
+      pool.emplace_back(churn, id);
+    }
+
+    for(auto& th : pool)
+    {
+      th.join();
+    }
+
+    result_is_ok = (result_threads_are_ok.load() && result_is_ok);
+
+    result_is_ok = ((local_allocator_type::get_slot_used_count        () ==  0U) && result_is_ok);
+    result_is_ok = ((local_allocator_type::get_slot_failed_allocations() ==  0U) && result_is_ok);
+    result_is_ok = ((local_allocator_type::get_slot_max_index         ()  < 64U) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_slot_alloc
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_slot_alloc______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_slot_alloc______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_slot_alloc::test_n_slot_array_allocators() && result_is_ok);
+
+  return result_is_ok;
+}
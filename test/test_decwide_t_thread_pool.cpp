@@ -0,0 +1,163 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_thread_pool.h>
+
+namespace test_decwide_t_thread_pool {
+
+auto test_thread_pool() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  util::thread_pool pool(static_cast<unsigned>(UINT8_C(3)));
+
+  // Every index is visited exactly once, also with an explicit grain.
+  std::vector<std::atomic<std::uint32_t>> visits(static_cast<std::size_t>(UINT16_C(1000)));
+
+  for(auto& visit : visits) { visit.store(static_cast<std::uint32_t>(UINT8_C(0))); }
+
+  pool.parallel_for(static_cast<std::size_t>(UINT8_C(0)), visits.size(), [&visits](const std::size_t i) { visits[i].fetch_add(static_cast<std::uint32_t>(UINT8_C(1))); });
+  pool.parallel_for(static_cast<std::size_t>(UINT8_C(0)), visits.size(), [&visits](const std::size_t i) { visits[i].fetch_add(static_cast<std::uint32_t>(UINT8_C(1))); }, static_cast<std::size_t>(UINT8_C(7)));
+
+  auto result_is_ok =
+    std::all_of(visits.cbegin(),
+                visits.cend(),
+                [](const std::atomic<std::uint32_t>& visit) { return (visit.load() == static_cast<std::uint32_t>(UINT8_C(2))); });
+
+  // An empty range does not call the function.
+  auto calls_of_empty = static_cast<std::uint32_t>(UINT8_C(0));
+
+  pool.parallel_for(static_cast<int>(INT8_C(5)), static_cast<int>(INT8_C(5)), [&calls_of_empty](const int) { ++calls_of_empty; });
+
+  result_is_ok = ((calls_of_empty == static_cast<std::uint32_t>(UINT8_C(0))) && result_is_ok);
+
+  // The reduction does not depend on the scheduling, even for
+  // a non-commutative reduction such as string concatenation.
+  const auto sum =
+    pool.parallel_reduce(static_cast<std::uint32_t>(UINT8_C(1)),
+                         static_cast<std::uint32_t>(UINT16_C(10001)),
+                         static_cast<std::uint64_t>(UINT8_C(0)),
+                         [](const std::uint32_t i) { return static_cast<std::uint64_t>(i); },
+                         [](const std::uint64_t a, const std::uint64_t b) { return static_cast<std::uint64_t>(a + b); });
+
+  const auto digits =
+    pool.parallel_reduce(static_cast<int>(INT8_C(0)),
+                         static_cast<int>(INT8_C(10)),
+                         std::string { },
+                         [](const int i) { return std::string(static_cast<std::size_t>(UINT8_C(1)), static_cast<char>('0' + i)); },
+                         [](const std::string& a, const std::string& b) { return a + b; },
+                         static_cast<int>(INT8_C(3)));
+
+  result_is_ok = (   (sum    == static_cast<std::uint64_t>(UINT32_C(50005000)))
+                  && (digits == "0123456789")
+                  && result_is_ok);
+
+  // A nested loop runs on the same pool without deadlocking.
+  std::atomic<std::uint32_t> nested_calls { };
+
+  pool.parallel_for
+  (
+    static_cast<int>(INT8_C(0)),
+    static_cast<int>(INT8_C(8)),
+    [&pool, &nested_calls](const int)
+    {
+      pool.parallel_for(static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(16)), [&nested_calls](const int) { nested_calls.fetch_add(static_cast<std::uint32_t>(UINT8_C(1))); });
+    }
+  );
+
+  result_is_ok = ((nested_calls.load() == static_cast<std::uint32_t>(UINT8_C(128))) && result_is_ok);
+
+  #if defined(UTIL_THREAD_POOL_HAS_EXCEPTIONS)
+  // An exception of the loop body is rethrown by the loop.
+  auto exception_is_ok = false;
+
+  try
+  {
+    pool.parallel_for
+    (
+      static_cast<int>(INT8_C(0)),
+      static_cast<int>(INT8_C(64)),
+      [](const int i)
+      {
+        if(i == static_cast<int>(INT8_C(42))) { throw std::runtime_error("thread_pool"); }
+      }
+    );
+  }
+  catch(const std::runtime_error& ex)
+  {
+    exception_is_ok = (std::string(ex.what()) == "thread_pool");
+  }
+
+  result_is_ok = (exception_is_ok && result_is_ok);
+  #endif
+
+  // The chunks count into the values of the workers without locking.
+  // The calling thread does not belong to the pool, and it runs no chunks.
+  util::per_worker<std::uint32_t> calls_per_worker(pool, [](const unsigned) { return static_cast<std::uint32_t>(UINT8_C(0)); });
+
+  pool.parallel_for(static_cast<int>(INT8_C(0)), static_cast<int>(INT8_C(100)), [&calls_per_worker](const int) { ++calls_per_worker.local(); });
+
+  result_is_ok = (   (pool.worker_index() == pool.size())
+                  && (calls_per_worker.local() == static_cast<std::uint32_t>(UINT8_C(0)))
+                  && (std::accumulate(calls_per_worker.begin(), calls_per_worker.end(), static_cast<std::uint32_t>(UINT8_C(0))) == static_cast<std::uint32_t>(UINT8_C(100)))
+                  && result_is_ok);
+
+  // Each thread outside the pool has a value of its own.
+  {
+    std::vector<std::thread> outside_threads { };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+    {
+      outside_threads.emplace_back
+      (
+        [&calls_per_worker]()
+        {
+          for(auto j = static_cast<unsigned>(UINT8_C(0)); j < static_cast<unsigned>(UINT16_C(1000)); ++j)
+          {
+            ++calls_per_worker.local();
+          }
+        }
+      );
+    }
+
+    for(auto& outside_thread : outside_threads)
+    {
+      outside_thread.join();
+    }
+  }
+
+  result_is_ok = (   (calls_per_worker.local() == static_cast<std::uint32_t>(UINT8_C(0)))
+                  && (static_cast<std::size_t>(std::distance(calls_per_worker.begin(), calls_per_worker.end())) == static_cast<std::size_t>(pool.size() + 5U))
+                  && (std::accumulate(calls_per_worker.begin(), calls_per_worker.end(), static_cast<std::uint32_t>(UINT8_C(0))) == static_cast<std::uint32_t>(UINT16_C(4100)))
+                  && result_is_ok);
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_thread_pool
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_thread_pool_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_thread_pool_____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_thread_pool::test_thread_pool() && result_is_ok);
+
+  return result_is_ok;
+}
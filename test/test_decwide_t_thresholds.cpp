@@ -0,0 +1,199 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_thresholds {
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+#if !defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS)
+auto test_multiplication_thresholds() -> bool
+{
+  // Use enough limbs that all three multiplication methods are compiled in.
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_wide_decimal_type_limb08 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(4001), std::uint8_t, std::allocator<void>>;
+  #else
+  using local_wide_decimal_type_limb08 = ::math::wide_decimal::decwide_t<INT32_C(4001), std::uint8_t, std::allocator<void>>;
+  #endif
+
+  static_assert(local_wide_decimal_type_limb08::decwide_t_elem_number >= local_wide_decimal_type_limb08::decwide_t_elems_for_fft,
+                "Error: The test type is too small to compile in FFT multiplication");
+
+  eng_sgn.seed(util::util_pseudorandom_time_point_seed::value<typename eng_sgn_type::result_type>());
+  eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+  eng_exp.seed(util::util_pseudorandom_time_point_seed::value<typename eng_exp_type::result_type>());
+
+  auto result_is_ok =
+    (   (local_wide_decimal_type_limb08::elems_for_kara() == local_wide_decimal_type_limb08::decwide_t_elems_for_kara)
+     && (local_wide_decimal_type_limb08::elems_for_fft () == local_wide_decimal_type_limb08::decwide_t_elems_for_fft));
+
+  const auto a = generate_wide_decimal_value<local_wide_decimal_type_limb08>();
+  const auto b = generate_wide_decimal_value<local_wide_decimal_type_limb08>();
+
+  const auto c_default = a * b;
+
+  // Force schoolbook, Karatsuba and FFT multiplication in turn.
+  const std::array<std::pair<std::int32_t, std::int32_t>, static_cast<std::size_t>(UINT8_C(3))> thresholds =
+  {{
+    { (std::numeric_limits<std::int32_t>::max)(), (std::numeric_limits<std::int32_t>::max)() },
+    { INT32_C(2),                                 (std::numeric_limits<std::int32_t>::max)() },
+    { INT32_C(2),                                 INT32_C(2) }
+  }};
+
+  std::array<local_wide_decimal_type_limb08, static_cast<std::size_t>(UINT8_C(3))> c { };
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < thresholds.size(); ++i)
+  {
+    result_is_ok = (local_wide_decimal_type_limb08::set_multiplication_thresholds(thresholds[i].first, thresholds[i].second) && result_is_ok);
+
+    c[i] = a * b;
+  }
+
+  // Schoolbook and Karatsuba multiplication agree limb for limb.
+  // The FFT truncates the product and can differ in the guard limbs.
+  const auto tol = static_cast<local_wide_decimal_type_limb08>(std::numeric_limits<local_wide_decimal_type_limb08>::epsilon() * 10U);
+
+  result_is_ok = (   std::equal(c[0U].crepresentation().cbegin(), c[0U].crepresentation().cend(), c[1U].crepresentation().cbegin())
+                  && (ilogb(c[0U]) == ilogb(c[1U]))
+                  && result_is_ok);
+
+  for(const auto& ci : c)
+  {
+    result_is_ok = ((fabs(1 - (ci / c_default)) < tol) && result_is_ok);
+  }
+
+  // Invalid thresholds are rejected and leave the thresholds as they were.
+  result_is_ok = (   (!local_wide_decimal_type_limb08::set_multiplication_thresholds(INT32_C(1), INT32_C(100)))
+                  && (!local_wide_decimal_type_limb08::set_multiplication_thresholds(INT32_C(100), INT32_C(99)))
+                  && (local_wide_decimal_type_limb08::elems_for_kara() == INT32_C(2))
+                  && (local_wide_decimal_type_limb08::elems_for_fft () == INT32_C(2))
+                  && result_is_ok);
+
+  local_wide_decimal_type_limb08::reset_multiplication_thresholds();
+
+  result_is_ok = (   (local_wide_decimal_type_limb08::elems_for_kara() == local_wide_decimal_type_limb08::decwide_t_elems_for_kara)
+                  && (local_wide_decimal_type_limb08::elems_for_fft () == local_wide_decimal_type_limb08::decwide_t_elems_for_fft)
+                  && result_is_ok);
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_thresholds
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_thresholds______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_thresholds______() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_RUNTIME_THRESHOLDS)
+  result_is_ok = (test_decwide_t_thresholds::test_multiplication_thresholds() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,356 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+namespace test_decwide_t_to_chars {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+auto local_zero    () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_zero(0U); return my_zero; }
+auto local_one     () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_one (1U); return my_one; }
+auto local_near_one() -> const local_wide_decimal_type& { static const local_wide_decimal_type my_near_one("0.999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999"); return my_near_one; }
+auto local_not_one () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_not_one ("0.899999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999"); return my_not_one; }
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+#if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+auto test_to_chars_from_chars() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  eng_sgn.seed(util::util_pseudorandom_time_point_seed::value<typename eng_sgn_type::result_type>());
+  eng_dig.seed(util::util_pseudorandom_time_point_seed::value<typename eng_dig_type::result_type>());
+  eng_exp.seed(util::util_pseudorandom_time_point_seed::value<typename eng_exp_type::result_type>());
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_chars_format = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::chars_format;
+  #else
+  using local_chars_format = ::math::wide_decimal::chars_format;
+  #endif
+
+  auto result_is_ok = true;
+
+  using local_buffer_type = std::array<char, static_cast<std::size_t>(UINT16_C(512))>;
+
+  local_buffer_type buf { };
+
+  {
+    // to_chars() writes the same characters as the ostream.
+    const std::array<std::pair<local_chars_format, std::ios::fmtflags>, static_cast<std::size_t>(UINT8_C(3))> formats =
+    {{
+      { local_chars_format::scientific, std::ios::scientific },
+      { local_chars_format::fixed,      std::ios::fixed },
+      { local_chars_format::general,    std::ios::fmtflags() }
+    }};
+
+    const std::array<int, static_cast<std::size_t>(UINT8_C(7))> precisions = {{ 0, 1, 2, 6, 20, 49, 64 }}; // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    std::vector<local_wide_decimal_type> values =
+    {
+      local_zero(),
+      local_one(),
+      local_near_one(),
+      local_not_one(),
+      -local_near_one(),
+      local_wide_decimal_type(  "0.5"),
+      local_wide_decimal_type("-99999.5"),
+      local_wide_decimal_type("123456.789"),
+      local_wide_decimal_type("9.9999999999999999999999999999999999999999999999999999999999999E-7")
+    };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(64)); ++i)
+    {
+      values.push_back(generate_wide_decimal_value<local_wide_decimal_type>(false, 60)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    }
+
+    for(const auto& x : values)
+    {
+      for(const auto& fmt : formats)
+      {
+        for(const auto& prec : precisions)
+        {
+          // A nonzero width selects the string-based formatting of the ostream.
+          std::stringstream strm;
+
+          strm.flags(fmt.second);
+
+          strm << std::setprecision(prec) << std::setw(1) << x;
+
+          std::stringstream strm_streamed;
+
+          strm_streamed.flags(fmt.second);
+
+          strm_streamed << std::setprecision(prec) << x;
+
+          result_is_ok = ((strm_streamed.str() == strm.str()) && result_is_ok);
+
+          const auto result = to_chars(buf.data(), buf.data() + buf.size(), x, fmt.first, prec);
+
+          const auto result_to_chars_is_ok =
+            (
+                 (result.ec == std::errc())
+              && (std::string(buf.data(), result.ptr) == strm.str())
+            );
+
+          result_is_ok = (result_to_chars_is_ok && result_is_ok);
+
+          if(result_to_chars_is_ok)
+          {
+            // A buffer that is one character too short is reported.
+            const auto len = static_cast<std::size_t>(std::distance(buf.data(), result.ptr));
+
+            const auto result_short = to_chars(buf.data(), buf.data() + (len - static_cast<std::size_t>(UINT8_C(1))), x, fmt.first, prec);
+
+            const auto result_short_is_ok =
+              (
+                   (result_short.ec  == std::errc::value_too_large)
+                && (result_short.ptr == (buf.data() + (len - static_cast<std::size_t>(UINT8_C(1)))))
+              );
+
+            result_is_ok = (result_short_is_ok && result_is_ok);
+          }
+        }
+      }
+    }
+
+    // The default to_chars() has the round-trip precision of the stream.
+    const auto x = generate_wide_decimal_value<local_wide_decimal_type>();
+
+    std::stringstream strm;
+
+    strm << std::setprecision(std::numeric_limits<local_wide_decimal_type>::max_digits10) << x;
+
+    const auto result = to_chars(buf.data(), buf.data() + buf.size(), x);
+
+    result_is_ok = ((result.ec == std::errc()) && (std::string(buf.data(), result.ptr) == strm.str()) && result_is_ok);
+  }
+
+  {
+    // from_chars() reads the same value as the string constructor,
+    // including the truncation of excess digits.
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(128)); ++i)
+    {
+      const auto str =
+        std::to_string(i) + "." + std::string(static_cast<std::size_t>(i), '0')
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + std::to_string(static_cast<std::uint32_t>(eng_dig()))
+        + "e" + std::to_string(static_cast<int>(static_cast<int>(i) - 64)); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      const auto str_signed = (((i % 2U) == 0U) ? str : ("-" + str));
+
+      local_wide_decimal_type y { };
+
+      const auto result = from_chars(str_signed.c_str(), str_signed.c_str() + str_signed.length(), y);
+
+      const local_wide_decimal_type z(str_signed.c_str());
+
+      const auto result_from_chars_is_ok =
+        (
+             (result.ec  == std::errc())
+          && (result.ptr == str_signed.c_str() + str_signed.length())
+          && (y == z)
+          && (ilogb(y) == ilogb(z))
+          && std::equal(y.crepresentation().cbegin(), y.crepresentation().cend(), z.crepresentation().cbegin())
+        );
+
+      result_is_ok = (result_from_chars_is_ok && result_is_ok);
+    }
+
+    // Read back what has been written.
+    {
+      const auto x = generate_wide_decimal_value<local_wide_decimal_type>();
+
+      const auto result_to = to_chars(buf.data(), buf.data() + buf.size(), x, local_chars_format::scientific, std::numeric_limits<local_wide_decimal_type>::digits10 - 3);
+
+      local_wide_decimal_type y { };
+
+      const auto result_from = from_chars(buf.data(), result_to.ptr, y);
+
+      result_is_ok = ((result_from.ec == std::errc()) && (result_from.ptr == result_to.ptr) && (y == x) && result_is_ok);
+    }
+
+    // Partial, erroneous and out-of-range input.
+    struct from_chars_case
+    {
+      const char*     str;           // NOLINT(misc-non-private-member-variables-in-classes)
+      std::ptrdiff_t  len_consumed;  // NOLINT(misc-non-private-member-variables-in-classes)
+      std::errc       ec;            // NOLINT(misc-non-private-member-variables-in-classes)
+      const char*     str_expected;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    const std::array<from_chars_case, static_cast<std::size_t>(UINT8_C(12))> cases =
+    {{
+      { "000.00120e+3x",    12, std::errc(),                     "1.2" },
+      { "-.5",               3, std::errc(),                     "-0.5" },
+      { "5.",                2, std::errc(),                     "5" },
+      { "1e",                1, std::errc(),                     "1" },
+      { "7E+",               1, std::errc(),                     "7" },
+      { "-0.000e5",          8, std::errc(),                     "0" },
+      { "25e-1,3",           5, std::errc(),                     "2.5" },
+      { ".",                 0, std::errc::invalid_argument,     "42" },
+      { "+",                 0, std::errc::invalid_argument,     "42" },
+      { "e5",                0, std::errc::invalid_argument,     "42" },
+      { "1e99999999999999999999", 22, std::errc::result_out_of_range, "42" },
+      { "1e-999999999999999999",  21, std::errc::result_out_of_range, "42" }
+    }};
+
+    for(const auto& c : cases)
+    {
+      local_wide_decimal_type y(42U);
+
+      const auto len = static_cast<std::ptrdiff_t>(std::strlen(c.str));
+
+      const auto result = from_chars(c.str, c.str + len, y); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto result_case_is_ok =
+        (
+             (result.ec  == c.ec)
+          && (result.ptr == c.str + c.len_consumed) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          && (y == local_wide_decimal_type(c.str_expected))
+          && (y.isneg() == local_wide_decimal_type(c.str_expected).isneg())
+        );
+
+      result_is_ok = (result_case_is_ok && result_is_ok);
+    }
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_to_chars
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_to_chars________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_to_chars________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+  result_is_ok = (test_decwide_t_to_chars::test_to_chars_from_chars() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,197 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+#include <util/memory/util_tracking_allocator.h>
+
+namespace test_decwide_t_tracking {
+
+auto test_tracking_allocator() -> bool
+{
+  auto result_is_ok = true;
+
+  // Use enough digits for the multiplication to run Karatsuba.
+  constexpr std::int32_t local_tracked_digits10 = INT32_C(1001);
+
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_tracked_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_tracked_digits10, std::uint32_t, util::tracking_allocator<void>>;
+  using local_std_wide_decimal_type     = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_tracked_digits10, std::uint32_t, std::allocator<void>>;
+  #else
+  using local_tracked_wide_decimal_type = ::math::wide_decimal::decwide_t<local_tracked_digits10, std::uint32_t, util::tracking_allocator<void>>;
+  using local_std_wide_decimal_type     = ::math::wide_decimal::decwide_t<local_tracked_digits10, std::uint32_t, std::allocator<void>>;
+  #endif
+
+  const auto result_matches =
+    [](const local_tracked_wide_decimal_type& a, const local_std_wide_decimal_type& b) // NOLINT(modernize-use-trailing-return-type)
+    {
+      return (   (a.isneg() == b.isneg())
+              && (ilogb(a) == ilogb(b))
+              && std::equal(a.crepresentation().cbegin(), a.crepresentation().cend(), b.crepresentation().cbegin()));
+    };
+
+  util::allocation_tracker& tracker = util::allocation_tracker::instance();
+
+  tracker.reset();
+
+  const auto live_bytes_before = tracker.live_bytes();
+
+  {
+    const util::allocation_scope scope("sqrt");
+
+    const auto x_tracked = sqrt(local_tracked_wide_decimal_type(2U)) / 3U;
+    const auto x_std     = sqrt(local_std_wide_decimal_type    (2U)) / 3U;
+
+    result_is_ok = (result_matches(x_tracked * x_tracked, x_std * x_std) && result_is_ok);
+  }
+
+  const auto value_bytes =
+    static_cast<std::size_t>(sizeof(std::uint32_t) * static_cast<std::size_t>(local_tracked_wide_decimal_type::decwide_t_elem_number));
+
+  {
+    // The values and the Karatsuba pools are counted for the
+    // operation, and everything has been deallocated again.
+    const util::allocation_statistics sqrt_statistics = tracker.operation("sqrt");
+
+    result_is_ok = ((sqrt_statistics.allocations         >  sqrt_statistics.scratch_allocations)                                          && result_is_ok);
+    result_is_ok = ((sqrt_statistics.scratch_allocations >  static_cast<std::uint64_t>(UINT8_C(0)))                                       && result_is_ok);
+    result_is_ok = ((sqrt_statistics.peak_bytes          >= static_cast<std::uint64_t>(value_bytes))                                      && result_is_ok);
+    result_is_ok = ((sqrt_statistics.allocations_by_size[util::allocation_size_bucket(value_bytes)] > static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+    result_is_ok = ((tracker.totals().allocations        == sqrt_statistics.allocations)                                                  && result_is_ok);
+    result_is_ok = ((tracker.deallocations()             == sqrt_statistics.allocations)                                                  && result_is_ok);
+    result_is_ok = ((tracker.live_bytes()                == live_bytes_before)                                                            && result_is_ok);
+  }
+
+  {
+    // An inner scope takes the allocations made within it.
+    const util::allocation_scope outer_scope("outer");
+
+    auto u = local_tracked_wide_decimal_type(1U) / 7U;
+
+    {
+      const util::allocation_scope inner_scope("inner");
+
+      u *= u;
+    }
+
+    result_is_ok = (result_matches(u, (local_std_wide_decimal_type(1U) / 7U) * (local_std_wide_decimal_type(1U) / 7U)) && result_is_ok);
+  }
+
+  result_is_ok = ((tracker.operation("outer").allocations         >  static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+  result_is_ok = ((tracker.operation("inner").scratch_allocations >  static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+  result_is_ok = ((tracker.operation("none").allocations          == static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+
+  {
+    std::stringstream strm;
+
+    tracker.report(strm);
+
+    result_is_ok = (   (strm.str().find("sqrt")  != std::string::npos)
+                    && (strm.str().find("inner") != std::string::npos)
+                    && result_is_ok);
+  }
+
+  tracker.reset();
+
+  {
+    // Without a scope of the caller, the operations of decwide_t open
+    // their own, and each of them counts the operations it calls.
+    {
+      const auto y = sqrt(local_tracked_wide_decimal_type(2U));
+
+      result_is_ok = (result_matches(y, sqrt(local_std_wide_decimal_type(2U))) && result_is_ok);
+    }
+
+    result_is_ok = ((tracker.operation("sqrt").scratch_allocations >  static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+    result_is_ok = ((tracker.operation("mul").allocations          == static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+
+    {
+      const auto u = local_tracked_wide_decimal_type(1U) / 7U;
+
+      const auto v = u * u;
+
+      result_is_ok = (result_matches(v, (local_std_wide_decimal_type(1U) / 7U) * (local_std_wide_decimal_type(1U) / 7U)) && result_is_ok);
+    }
+
+    result_is_ok = ((tracker.operation("mul").scratch_allocations  >  static_cast<std::uint64_t>(UINT8_C(0))) && result_is_ok);
+  }
+
+  {
+    // The peak of a scope does not count what other threads hold.
+    std::atomic<bool> other_has_allocated { false };
+    std::atomic<bool> scope_has_ended     { false };
+
+    std::thread other
+    {
+      [&other_has_allocated, &scope_has_ended]() // NOLINT(modernize-use-trailing-return-type)
+      {
+        const local_tracked_wide_decimal_type held(3U);
+
+        other_has_allocated.store(true);
+
+        while(!scope_has_ended.load()) { std::this_thread::yield(); }
+      }
+    };
+
+    while(!other_has_allocated.load()) { std::this_thread::yield(); }
+
+    {
+      const util::allocation_scope scope("this_thread");
+
+      const local_tracked_wide_decimal_type mine(2U);
+
+      result_is_ok = ((!mine.iszero()) && result_is_ok);
+    }
+
+    scope_has_ended.store(true);
+
+    other.join();
+
+    const util::allocation_statistics this_thread_statistics = tracker.operation("this_thread");
+
+    result_is_ok = ((this_thread_statistics.peak_bytes >= static_cast<std::uint64_t>(value_bytes))                                    && result_is_ok);
+    result_is_ok = ((this_thread_statistics.peak_bytes <  static_cast<std::uint64_t>(value_bytes * static_cast<std::size_t>(UINT8_C(2)))) && result_is_ok);
+  }
+
+  tracker.reset();
+
+  result_is_ok = ((tracker.totals().allocations == static_cast<std::uint64_t>(UINT8_C(0))) && tracker.operations().empty() && result_is_ok);
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_tracking
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_tracking________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_tracking________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_tracking::test_tracking_allocator() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
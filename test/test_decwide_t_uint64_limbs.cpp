@@ -0,0 +1,180 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_uint64_limbs {
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+#if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+auto test_uint64_limbs() -> bool // NOLINT(readability-function-cognitive-complexity)
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  namespace local_detail = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_64 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(1001), std::uint64_t, std::allocator<void>>;
+  using local_wide_decimal_type_32 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<INT32_C(1001), std::uint32_t, std::allocator<void>>;
+
+  const auto pi_64 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<INT32_C(1001), std::uint64_t, std::allocator<void>>();
+  const auto pi_32 = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::calc_pi<INT32_C(1001), std::uint32_t, std::allocator<void>>();
+  #else
+  namespace local_detail = ::math::wide_decimal::detail;
+
+  using local_wide_decimal_type_64 = ::math::wide_decimal::decwide_t<INT32_C(1001), std::uint64_t, std::allocator<void>>;
+  using local_wide_decimal_type_32 = ::math::wide_decimal::decwide_t<INT32_C(1001), std::uint32_t, std::allocator<void>>;
+
+  const auto pi_64 = ::math::wide_decimal::calc_pi<INT32_C(1001), std::uint64_t, std::allocator<void>>();
+  const auto pi_32 = ::math::wide_decimal::calc_pi<INT32_C(1001), std::uint32_t, std::allocator<void>>();
+  #endif
+
+  const auto tol_32 =
+    static_cast<local_wide_decimal_type_32>
+    (
+      std::numeric_limits<local_wide_decimal_type_32>::epsilon() * 1000U
+    );
+
+  // Compare a result with 18-digit limbs to the one with 8-digit limbs.
+  const auto is_close =
+    [&tol_32](const local_wide_decimal_type_64& x_64, const local_wide_decimal_type_32& x_32) // NOLINT(modernize-use-trailing-return-type)
+    {
+      std::stringstream strm;
+
+      strm << std::setprecision(std::numeric_limits<local_wide_decimal_type_64>::digits10) << std::scientific << x_64;
+
+      using std::fabs;
+
+      return (fabs(1 - (local_wide_decimal_type_32(strm.str().c_str()) / x_32)) < tol_32);
+    };
+
+  const auto x_64 = local_wide_decimal_type_64(7U) / 3U;
+  const auto x_32 = local_wide_decimal_type_32(7U) / 3U;
+
+  using std::exp;
+  using std::log;
+  using std::sqrt;
+
+  auto result_is_ok =
+    (   (local_wide_decimal_type_64::decwide_t_elem_digits10 == static_cast<std::int32_t>(INT8_C(18)))
+     && is_close(pi_64,                pi_32)
+     && is_close(sqrt(x_64),           sqrt(x_32))
+     && is_close(log(x_64),            log(x_32))
+     && is_close(exp(x_64),            exp(x_32))
+     && is_close(x_64 * pi_64,         x_32 * pi_32)
+     && is_close(x_64 / pi_64,         x_32 / pi_32)
+     && is_close(x_64 / (1ULL << 60U), x_32 / (1ULL << 60U)));
+
+  // Integers of up to 64 bits are exact in one or two limbs.
+  {
+    constexpr auto u_max = (std::numeric_limits<unsigned long long>::max)(); // NOLINT(google-runtime-int)
+
+    const auto u_64 = local_wide_decimal_type_64(u_max);
+
+    result_is_ok = (   (static_cast<unsigned long long>(u_64) == u_max) // NOLINT(google-runtime-int)
+                    && (static_cast<unsigned long long>(local_wide_decimal_type_64(UINT64_C(999999999999999999))) == UINT64_C(999999999999999999)) // NOLINT(google-runtime-int)
+                    && (u_64 == local_wide_decimal_type_64("18446744073709551615"))
+                    && result_is_ok);
+  }
+
+  // The FFT splits the 18-digit limbs into 3 or 6 points. With zero
+  // upper halves of the factors, both products equal the schoolbook one.
+  result_is_ok = (   (local_detail::fft_points_per_limb<std::uint64_t, double>(INT32_C(2224), static_cast<std::uint32_t>(UINT8_C(6)), 0.25) == static_cast<std::uint32_t>(UINT8_C(6)))
+                  && (local_detail::fft_points_per_limb<std::uint64_t, double>(INT32_C(2224), static_cast<std::uint32_t>(UINT8_C(4)), 0.25) == static_cast<std::uint32_t>(UINT8_C(3)))
+                  && result_is_ok);
+
+  constexpr auto half_elems = static_cast<std::size_t>(UINT8_C(16));
+  constexpr auto prec_elems = static_cast<std::size_t>(half_elems * 2U);
+
+  std::uniform_int_distribution<std::uint64_t> dist_limb(UINT64_C(0), UINT64_C(999999999999999999));
+
+  std::vector<std::uint64_t> u(prec_elems, static_cast<std::uint64_t>(UINT8_C(0)));
+  std::vector<std::uint64_t> v(prec_elems, static_cast<std::uint64_t>(UINT8_C(0)));
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < half_elems; ++i)
+  {
+    u[i] = dist_limb(eng_dig);
+    v[i] = dist_limb(eng_dig);
+  }
+
+  std::vector<std::uint64_t> r_school(prec_elems, static_cast<std::uint64_t>(UINT8_C(0)));
+
+  local_detail::eval_multiply_n_by_n_to_2n(r_school.data(), u.data(), v.data(), static_cast<std::int_fast32_t>(half_elems));
+
+  for(auto points_per_limb = static_cast<std::uint32_t>(UINT8_C(3)); points_per_limb <= static_cast<std::uint32_t>(UINT8_C(6)); points_per_limb *= 2U)
+  {
+    const auto n_fft = static_cast<std::uint32_t>(local_detail::a000079::a000079_as_constexpr(static_cast<std::uint32_t>(prec_elems * points_per_limb)) * 2U);
+
+    std::vector<double> af(static_cast<std::size_t>(n_fft));
+    std::vector<double> bf(static_cast<std::size_t>(n_fft));
+
+    std::vector<std::uint64_t> r_fft(prec_elems, static_cast<std::uint64_t>(UINT8_C(0)));
+
+    const auto roundoff =
+      local_detail::mul_loop_fft(r_fft.data(),
+                                 static_cast<const std::uint64_t*>(u.data()),
+                                 static_cast<const std::uint64_t*>(v.data()),
+                                 af.data(),
+                                 bf.data(),
+                                 static_cast<std::int32_t>(prec_elems),
+                                 n_fft,
+                                 points_per_limb,
+                                 0.25,
+                                 true);
+
+    result_is_ok = (   (roundoff < 0.25)
+                    && (r_fft == r_school)
+                    && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_uint64_limbs
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_uint64_limbs____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_uint64_limbs____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if defined(WIDE_DECIMAL_HAS_UINT64_LIMB)
+  result_is_ok = (test_decwide_t_uint64_limbs::test_uint64_limbs() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,313 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <math/wide_decimal/decwide_vector.h>
+#include <test/test_decwide_t_features.h>
+#include <util/utility/util_baselexical_cast.h>
+
+namespace test_decwide_t_vector {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+using local_wide_decimal_vector_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_vector<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+using local_wide_decimal_vector_type = ::math::wide_decimal::decwide_vector<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+std::uniform_int_distribution<std::uint32_t> dist_sgn(UINT32_C(   0), UINT32_C(    1)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+std::uniform_int_distribution<std::uint32_t> dist_dig(UINT32_C(0x31), UINT32_C( 0x39)); // NOLINT(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+using eng_sgn_type = std::ranlux24;
+using eng_dig_type = std::minstd_rand0;
+using eng_exp_type = std::mt19937;
+
+eng_sgn_type eng_sgn; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_dig; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+eng_dig_type eng_exp; // NOLINT(cert-msc32-c,cert-msc51-cpp,cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables)
+
+auto local_zero    () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_zero(0U); return my_zero; }
+auto local_one     () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_one (1U); return my_one; }
+
+template<typename FloatingPointTypeWithStringConstruction>
+auto generate_wide_decimal_value(bool is_positive     = false,
+                                 int  exp_range       = 10000, // NOLINT(bugprone-easily-swappable-parameters)
+                                 int  digits10_to_get = std::numeric_limits<FloatingPointTypeWithStringConstruction>::digits10 - 2) -> FloatingPointTypeWithStringConstruction
+{
+  using local_floating_point_type = FloatingPointTypeWithStringConstruction;
+
+  static_assert(std::numeric_limits<local_floating_point_type>::digits10 > static_cast<int>(INT8_C(9)),
+                "Error: Floating-point type destination does not have enough digits10");
+
+  std::string str_x(static_cast<std::size_t>(digits10_to_get), '0');
+
+  std::generate(str_x.begin(),
+                str_x.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  return static_cast<char>(dist_dig(eng_dig));
+                });
+
+  if(exp_range != 0)
+  {
+    std::uniform_int_distribution<std::uint32_t>
+      dist_exp
+      (
+        static_cast<std::uint32_t>(UINT8_C(0)),
+        static_cast<std::uint32_t>(exp_range)
+      );
+
+    const auto val_exp = dist_exp(eng_exp);
+
+    const auto sgn_exp = (dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0)));
+
+    char p_str_exp[static_cast<std::size_t>(UINT8_C(32))] = { '\0' }; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+    p_str_exp[static_cast<std::size_t>(UINT8_C(0))] = 'E';
+    p_str_exp[static_cast<std::size_t>(UINT8_C(1))] = static_cast<char>(sgn_exp ? '-' : '+');
+
+    {
+      const char* p_end { util::baselexical_cast(val_exp, &p_str_exp[2U], &p_str_exp[0U] + sizeof(p_str_exp)) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      for(const char* ptr { p_str_exp }; ptr != p_end; ++ptr) // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay,cppcoreguidelines-pro-bounds-pointer-arithmetic,llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto len = str_x.length();
+
+        str_x.insert(len, static_cast<std::size_t>(UINT8_C(1)), *ptr);
+      }
+    }
+
+    // Insert a decimal point.
+    str_x.insert(static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(1)), '.');
+  }
+
+  // Insert either a positive sign or a negative sign
+  // (always one or the other) depending on the sign of x.
+  const auto sign_char_to_insert =
+    static_cast<char>
+    (
+      is_positive
+        ? '+'
+        : static_cast<char>((dist_sgn(eng_sgn) != static_cast<std::uint32_t>(UINT8_C(0))) ? '+' : '-')
+    );
+
+  str_x.insert(static_cast<std::size_t>(UINT8_C(0)), static_cast<std::size_t>(UINT8_C(1)), sign_char_to_insert);
+
+  return local_floating_point_type(str_x.c_str());
+}
+
+auto test_vector_kernels() -> bool
+{
+  auto result_is_ok = true;
+
+  constexpr auto count = static_cast<std::size_t>(UINT16_C(256));
+
+  local_wide_decimal_vector_type a(count);
+  local_wide_decimal_vector_type b(count);
+  local_wide_decimal_vector_type c(count);
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+  {
+    // Sprinkle in zero, one and minus one in order to also
+    // exercise the fallback paths of the kernels.
+    const auto x =
+      ((i % static_cast<std::size_t>(UINT8_C(17))) == static_cast<std::size_t>(UINT8_C(3)))
+        ? local_zero()
+        : (((i % static_cast<std::size_t>(UINT8_C(19))) == static_cast<std::size_t>(UINT8_C(5)))
+            ? local_one()
+            : generate_wide_decimal_value<local_wide_decimal_type>(false, 1000));
+
+    const auto y =
+      ((i % static_cast<std::size_t>(UINT8_C(23))) == static_cast<std::size_t>(UINT8_C(7)))
+        ? -local_one()
+        : generate_wide_decimal_value<local_wide_decimal_type>(false, 1000);
+
+    a.set(i, x);
+    b.set(i, y);
+    c.set(i, generate_wide_decimal_value<local_wide_decimal_type>(false, 1000));
+
+    result_is_ok = ((a.get(i) == x) && (b.get(i) == y) && result_is_ok);
+  }
+
+  {
+    auto v = a;
+
+    static_cast<void>(v.add(b));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (a.get(i) + b.get(i))) && result_is_ok);
+    }
+  }
+
+  {
+    auto v = a;
+
+    static_cast<void>(v.mul(b));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (a.get(i) * b.get(i))) && result_is_ok);
+    }
+  }
+
+  {
+    auto v = c;
+
+    static_cast<void>(v.fma(a, b));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (c.get(i) + (a.get(i) * b.get(i)))) && result_is_ok);
+    }
+  }
+
+  {
+    const auto s = generate_wide_decimal_value<local_wide_decimal_type>(false, 1000);
+
+    auto v = a;
+
+    static_cast<void>(v.scale(s));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (a.get(i) * s)) && result_is_ok);
+    }
+  }
+
+  for(const auto n : { static_cast<unsigned>(UINT8_C(0)), static_cast<unsigned>(UINT8_C(1)), static_cast<unsigned>(UINT8_C(7)), static_cast<unsigned>(UINT16_C(9999)), static_cast<unsigned>(UINT32_C(123456789)) })
+  {
+    auto v = a;
+
+    static_cast<void>(v.scale(n));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (a.get(i) * n)) && result_is_ok);
+    }
+  }
+
+  {
+    // Use nearby exponents, so that the slab addition actually
+    // has to align, add with carry and justify the operands.
+    local_wide_decimal_vector_type u(count);
+    local_wide_decimal_vector_type w(count);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      u.set(i, generate_wide_decimal_value<local_wide_decimal_type>(false, 24));
+      w.set(i, generate_wide_decimal_value<local_wide_decimal_type>(((i % static_cast<std::size_t>(UINT8_C(4))) != static_cast<std::size_t>(UINT8_C(0))), 24));
+
+      result_is_ok = (u.isfinite(i) && w.isfinite(i) && result_is_ok);
+    }
+
+    auto v = u;
+
+    static_cast<void>(v.add(w));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (u.get(i) + w.get(i))) && result_is_ok);
+    }
+
+    v = u;
+
+    static_cast<void>(v.fma(w, u));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (u.get(i) + (w.get(i) * u.get(i)))) && result_is_ok);
+    }
+  }
+
+  {
+    // Subtract nearly equal values, so that the leading limbs cancel
+    // and the difference has to be justified (or is exactly zero).
+    local_wide_decimal_vector_type u(count);
+    local_wide_decimal_vector_type w(count);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto x = generate_wide_decimal_value<local_wide_decimal_type>(false, 24);
+
+      const auto k = static_cast<int>(i % static_cast<std::size_t>(UINT8_C(48)));
+
+      const auto y = ((k == 0) ? x : (x * (local_one() + pow(local_wide_decimal_type(10U), static_cast<std::int64_t>(-k)))));
+
+      u.set(i, x);
+      w.set(i, -y);
+    }
+
+    auto v = u;
+
+    static_cast<void>(v.add(w));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      const auto ctrl = u.get(i) + w.get(i);
+
+      result_is_ok = ((v.get(i) == ctrl) && (v.isneg(i) == (ctrl < local_zero())) && result_is_ok);
+    }
+
+    v = w;
+
+    static_cast<void>(v.add(u));
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      result_is_ok = ((v.get(i) == (w.get(i) + u.get(i))) && result_is_ok);
+    }
+  }
+
+  {
+    local_wide_decimal_vector_type v;
+
+    result_is_ok = (v.empty() && result_is_ok);
+
+    v = a;
+
+    result_is_ok = ((v.size() == count) && (v.get(count - 1U) == a.get(count - 1U)) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+} // namespace test_decwide_t_vector
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_vector__________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_vector__________() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  result_is_ok = (test_decwide_t_vector::test_vector_kernels() && result_is_ok);
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,170 @@
+﻿///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <math/wide_decimal/decwide_t.h>
+#include <test/test_decwide_t_features.h>
+
+namespace test_decwide_t_write_digits {
+
+using local_limb_type = std::uint16_t;
+
+constexpr std::int32_t local_wide_decimal_digits10 = INT32_C(51);
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+using local_wide_decimal_type = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#else
+using local_wide_decimal_type = ::math::wide_decimal::decwide_t<local_wide_decimal_digits10, local_limb_type, std::allocator<void>>;
+#endif
+
+auto local_one     () -> const local_wide_decimal_type& { static const local_wide_decimal_type my_one (1U); return my_one; }
+
+#if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+auto test_write_digits() -> bool
+{
+  #if defined(WIDE_DECIMAL_NAMESPACE)
+  using local_chars_format   = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::chars_format;
+  using local_digit_grouping = WIDE_DECIMAL_NAMESPACE::math::wide_decimal::digit_grouping;
+  #else
+  using local_chars_format   = ::math::wide_decimal::chars_format;
+  using local_digit_grouping = ::math::wide_decimal::digit_grouping;
+  #endif
+
+  auto result_is_ok = true;
+
+  // Use a large fixed-point output which spans several chunks of the writer.
+  const auto x = local_wide_decimal_type(local_one() / 7U) * local_wide_decimal_type("1E2500");
+
+  std::vector<char> buf(static_cast<std::size_t>(UINT16_C(4096)));
+
+  const auto result_to = to_chars(buf.data(), buf.data() + buf.size(), x, local_chars_format::fixed, 20); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+  const auto str_ctrl = std::string(buf.data(), result_to.ptr);
+
+  {
+    std::stringstream strm;
+
+    const auto result_write_is_ok = write_digits(strm, x, local_chars_format::fixed, 20); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (result_write_is_ok && (result_to.ec == std::errc()) && (strm.str() == str_ctrl) && result_is_ok);
+  }
+
+  {
+    std::FILE* p_file = std::tmpfile(); // NOLINT(cppcoreguidelines-owning-memory)
+
+    if(p_file != nullptr)
+    {
+      const auto result_write_is_ok = write_digits(p_file, x, local_chars_format::fixed, 20); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+      std::rewind(p_file);
+
+      std::vector<char> buf_file(buf.size());
+
+      const auto count_read = std::fread(buf_file.data(), static_cast<std::size_t>(UINT8_C(1)), buf_file.size(), p_file);
+
+      static_cast<void>(std::fclose(p_file)); // NOLINT(cppcoreguidelines-owning-memory)
+
+      result_is_ok = (result_write_is_ok && (std::string(buf_file.data(), count_read) == str_ctrl) && result_is_ok);
+    }
+  }
+
+  {
+    // Group the digits after the decimal point in columns.
+    std::stringstream strm;
+
+    const local_digit_grouping grouping { 5U, 2U, ' ' };
+
+    const auto result_write_is_ok = write_digits(strm, local_wide_decimal_type(local_one() / 7U), local_chars_format::fixed, 25, grouping); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (result_write_is_ok && (strm.str() == "0.14285 71428\n57142 85714\n28571") && result_is_ok);
+  }
+
+  {
+    std::stringstream strm;
+
+    const local_digit_grouping grouping { 10U, 0U, '_' };
+
+    const auto result_write_is_ok = write_digits(strm, local_wide_decimal_type(-22) / 7, local_chars_format::scientific, 24, grouping); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (result_write_is_ok && (strm.str() == "-3.1428571428_5714285714_2857e+000") && result_is_ok);
+  }
+
+  {
+    // Wide streams receive the same characters, widened.
+    std::wstringstream wstrm;
+
+    const auto result_write_is_ok = write_digits(wstrm, x, local_chars_format::fixed, 20); // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+    result_is_ok = (result_write_is_ok && (wstrm.str() == std::wstring(str_ctrl.cbegin(), str_ctrl.cend())) && result_is_ok);
+  }
+
+  {
+    const auto y = local_wide_decimal_type(-22) / 7;
+
+    std::stringstream  strm;
+    std::wstringstream wstrm;
+
+    strm  << std::setprecision(30) << y << ' ' << std::showpoint << std::setw(40) << std::setfill('*') << y;
+    wstrm << std::setprecision(30) << y << L' ' << std::showpoint << std::setw(40) << std::setfill(L'*') << y;
+
+    const auto str = strm.str();
+
+    result_is_ok = ((wstrm.str() == std::wstring(str.cbegin(), str.cend())) && (str.find('*') != std::string::npos) && result_is_ok);
+  }
+
+  {
+    // Padding and showpoint go through the same formatter as to_chars.
+    const auto y = local_wide_decimal_type(-22) / 7;
+
+    std::stringstream strm;
+
+    strm << std::setprecision(5)  << std::setw(12) << std::setfill('*')               << y                            << '|'
+         << std::setprecision(5)  << std::setw(12) << std::left                       << y                            << '|'
+         << std::setprecision(5)  << std::showpoint << std::setw(0)                   << local_wide_decimal_type(1U) / 2U << '|'
+         << std::setprecision(1)                                                      << local_wide_decimal_type(123U) << '|'
+         << std::setprecision(0)  << std::scientific << std::setw(8) << std::right    << local_wide_decimal_type(5U);
+
+    result_is_ok = ((strm.str() == "*****-3.1429|-3.1429*****|0.50000|100.|*5.e+000") && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+#endif
+
+} // namespace test_decwide_t_write_digits
+
+#if defined(WIDE_DECIMAL_NAMESPACE)
+auto WIDE_DECIMAL_NAMESPACE::test_decwide_t_write_digits____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#else
+auto test_decwide_t_write_digits____() -> bool // NOLINT(readability-identifier-naming,bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+{
+  auto result_is_ok = true;
+
+  #if !defined(WIDE_DECIMAL_DISABLE_CHARCONV)
+  result_is_ok = (test_decwide_t_write_digits::test_write_digits() && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+#if (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12))
+#pragma GCC diagnostic pop
+#endif
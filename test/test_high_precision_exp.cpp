@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////
-//  Copyright Christopher Kormanyos 2022 - 2025.                 //
+//  Copyright Christopher Kormanyos 2022 - 2026.                 //
 //  Distributed under the Boost Software License,                //
 //  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
@@ -22,6 +22,7 @@
 #include <math/wide_decimal/decwide_t.h>
 #include <test/parallel_for.h>
 #include <util/utility/util_pseudorandom_time_point_seed.h>
+#include <util/utility/util_thread_pool.h>
 
 // cd /mnt/c/Users/User/Documents/Ks/PC_Software/NumericalPrograms/ExtendedNumberTypes/wide_decimal
 // When using g++ and -std=c++20
@@ -170,18 +171,31 @@ namespace test_high_precision_exp
   using eng_top_type = std::mt19937;
   using eng_bot_type = std::minstd_rand0;
 
-  eng_top_type eng_sgn;
-  eng_top_type eng_top;
-  eng_bot_type eng_bot;
+  // The random engines of one worker of the thread pool.
+  struct engines_type
+  {
+    eng_top_type eng_sgn; // NOLINT(misc-non-private-member-variables-in-classes)
+    eng_top_type eng_top; // NOLINT(misc-non-private-member-variables-in-classes)
+    eng_bot_type eng_bot; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
 
   auto do_test() -> bool
   {
     const auto my_pi_w = ckormanyos::math::wide_decimal::pi<wide_decimal_type::decwide_t_digits10>();
     const auto my_pi_b = detail::calc_pi<boost_float_type>();
 
-    eng_sgn.seed(util::util_pseudorandom_time_point_seed::value<typename eng_top_type::result_type>());
-    eng_top.seed(util::util_pseudorandom_time_point_seed::value<typename eng_top_type::result_type>());
-    eng_bot.seed(util::util_pseudorandom_time_point_seed::value<typename eng_bot_type::result_type>());
+    util::per_worker<engines_type> engines
+    (
+      util::thread_pool::global(),
+      [](const unsigned index)
+      {
+        const auto seed_sgn = util::util_pseudorandom_time_point_seed::value<typename eng_top_type::result_type>();
+        const auto seed_top = util::util_pseudorandom_time_point_seed::value<typename eng_top_type::result_type>();
+        const auto seed_bot = util::util_pseudorandom_time_point_seed::value<typename eng_bot_type::result_type>();
+
+        return engines_type { eng_top_type(seed_sgn + index), eng_top_type(seed_top + index), eng_bot_type(seed_bot + index) };
+      }
+    );
 
     auto result_is_ok = true;
 
@@ -201,14 +215,19 @@ namespace test_high_precision_exp
       #else
       static_cast<unsigned>(UINT8_C(24)),
       #endif
-      [&my_pi_w, &my_pi_b, &result_is_ok, &do_calcs_exp_lock, &ilogb_tol, &my_one](unsigned count)
+      [&my_pi_w, &my_pi_b, &result_is_ok, &do_calcs_exp_lock, &ilogb_tol, &my_one, &engines](unsigned count)
       {
-        while(do_calcs_exp_lock.test_and_set()) { ; }
-        const auto sgn_top = (dst_sgn(eng_sgn) == static_cast<std::uint32_t>(UINT32_C(1)));
-        const auto sgn_bot = (dst_sgn(eng_sgn) == static_cast<std::uint32_t>(UINT32_C(1)));
+        auto& local_engines = engines.local();
+
+        auto local_dst_sgn = dst_sgn;
+        auto local_dst_top = dst_top;
+        auto local_dst_bot = dst_bot;
 
-        const auto top = dst_top(eng_top);
-        const auto bot = dst_bot(eng_bot);
+        const auto sgn_top = (local_dst_sgn(local_engines.eng_sgn) == static_cast<std::uint32_t>(UINT32_C(1)));
+        const auto sgn_bot = (local_dst_sgn(local_engines.eng_sgn) == static_cast<std::uint32_t>(UINT32_C(1)));
+
+        const auto top = local_dst_top(local_engines.eng_top);
+        const auto bot = local_dst_bot(local_engines.eng_bot);
 
         const auto numer =
           static_cast<std::int32_t>
@@ -222,8 +241,6 @@ namespace test_high_precision_exp
             (!sgn_bot) ? static_cast<std::int32_t>(bot) : static_cast<std::int32_t>(-static_cast<std::int32_t>(bot))
           );
 
-        do_calcs_exp_lock.clear();
-
         const auto yw = wide_decimal_type((wide_decimal_type(numer) * my_pi_w) / denom);
         const auto ew = exp(yw);
 
@@ -168,13 +168,19 @@ namespace example_mixed_wide_decimal_wide_integer
     typename wide_integer_b2n_array_type::value_type(static_cast<std::int32_t>(INT32_C(    33330))),
   };
 
-  wide_decimal_type to_string(const wide_integer_type& x)
+  auto to_wide_decimal(const wide_integer_type& x) -> wide_decimal_type
   {
-    std::stringstream strm;
+    // Convert the binary limbs of the magnitude directly,
+    // without an intermediate string representation.
+    const auto x_is_neg = (x < 0);
 
-    strm << x;
+    const wide_integer_type u = (x_is_neg ? -x : x);
 
-    return wide_decimal_type(strm.str().c_str());
+    wide_decimal_type result { };
+
+    from_binary_limbs(u.crepresentation().cbegin(), u.crepresentation().cend(), result);
+
+    return (x_is_neg ? -result : result);
   }
 
   auto bernoulli_table() -> util::dynamic_array<wide_decimal_type>&
@@ -268,7 +274,7 @@ auto WIDE_DECIMAL_NAMESPACE::math::wide_decimal::example008_bernoulli_tgamma() -
     wide_decimal_type b2n =
       wide_decimal_type
       (
-          wide_decimal_type(to_string(b2n_numerators[i2n]))
+          to_wide_decimal(b2n_numerators[i2n])
         / static_cast<std::int32_t>(b2n_denominators[i2n])
       );
 
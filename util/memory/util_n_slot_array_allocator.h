@@ -49,6 +49,7 @@
 
     using slot_array_type        = std::array<T, static_cast<std::size_t>(slot_width)>;
     using slot_array_memory_type = std::array<slot_array_type, slot_count>;
+    using slot_array_links_type  = std::array<std::size_t, slot_count>;
     using slot_array_flags_type  = std::array<std::uint8_t, slot_count>;
 
   public:
@@ -79,37 +80,54 @@
       static_cast<void>(count);
       static_cast<void>(p_hint);
 
-      pointer p { nullptr };
+      // Allocation is constant-time. Recycled slots are taken from
+      // the head of the free-list. If the free-list is empty, the
+      // next never-used slot is taken from the top of the array.
+      // The free-list is linked through the side array slot_links
+      // (rather than through the slots themselves), so that slots
+      // of any width or limb type are supported. A link holds the
+      // slot index plus one, and zero ends the list. Every index is
+      // checked against slot_count before it is used.
 
-      // TBD: There is most likely significant optimization potential
-      // capable of being unlocked if a storage/lookup mechanism can be
-      // devised that uses a binary search when finding the next free slot.
+      auto index = slot_count;
 
-      // (TBD) In fact, constant-time allocation probably possible, as shown in:
-      // SmallObjectAllocator from Modern C++ Design by Andrei Alexandrescu.
+      if(slot_free_head != static_cast<std::size_t>(UINT8_C(0)))
+      {
+        const auto head_index = static_cast<std::size_t>(slot_free_head - static_cast<std::size_t>(UINT8_C(1)));
+
+        if(head_index < slot_count)
+        {
+          index = head_index;
 
-      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < slot_count; ++i)
+          slot_free_head = slot_links[index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+      else if(slot_fresh_index < slot_count)
       {
-        using local_flags_value_type = typename slot_array_flags_type::value_type;
+        index = slot_fresh_index;
+
+        ++slot_fresh_index;
 
-        if(slot_flags[i] == static_cast<local_flags_value_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        if(index > slot_max_index)
         {
-          slot_flags[i] = static_cast<local_flags_value_type>(UINT8_C(1)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+          slot_max_index = index;
+        }
+      }
 
-          p = static_cast<pointer>(slot_array_memory[i].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      if(index < slot_count)
+      {
+        using local_flags_value_type = typename slot_array_flags_type::value_type;
 
-          if(i > slot_max_index)
-          {
-            slot_max_index = i;
+        slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(1)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-            static_cast<void>(slot_max_index);
-          }
+        ++slot_used_count;
 
-          break;
-        }
+        return static_cast<pointer>(slot_array_memory[index].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
       }
 
-      return p;
+      ++slot_failed_allocations;
+
+      return nullptr;
     }
 
     auto construct(pointer p, const value_type& x) -> void
@@ -127,27 +145,55 @@
     {
       static_cast<void>(sz);
 
-      typename slot_array_memory_type::size_type index { };
+      // Deallocation is constant-time. The slot index is recovered
+      // from the distance to the base of the slot memory, and the slot
+      // is pushed onto the head of the free-list. Foreign pointers and
+      // slots that are not in use (as in a double free) are ignored.
+
+      const auto index = slot_index_of(p_slot);
+
+      using local_flags_value_type = typename slot_array_flags_type::value_type;
 
-      for(auto& slot_array_memory_entry : slot_array_memory)
+      if((index < slot_count) && (slot_flags[index] != static_cast<local_flags_value_type>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
       {
-        if(p_slot == static_cast<pointer>(slot_array_memory_entry.data()))
-        {
-          using local_flags_value_type = typename slot_array_flags_type::value_type;
+        slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-          slot_flags[index] = static_cast<local_flags_value_type>(UINT8_C(0)); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        slot_links[index] = slot_free_head; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
 
-          break;
-        }
+        slot_free_head = static_cast<std::size_t>(index + static_cast<std::size_t>(UINT8_C(1)));
 
-        ++index;
+        --slot_used_count;
       }
     }
 
+    // Allocation statistics. The value of slot_max_index is the
+    // high-water mark, i.e., the largest slot index ever handed out.
+    static auto get_slot_max_index         () noexcept -> std::size_t { return slot_max_index; }
+    static auto get_slot_used_count        () noexcept -> std::size_t { return slot_used_count; }
+    static auto get_slot_failed_allocations() noexcept -> std::size_t { return slot_failed_allocations; }
+
   private:
-    static slot_array_memory_type slot_array_memory; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static slot_array_flags_type  slot_flags;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
-    static std::size_t            slot_max_index;    // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_memory_type slot_array_memory;       // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_links_type  slot_links;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_flags_type  slot_flags;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_free_head;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_fresh_index;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_max_index;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_used_count;         // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::size_t            slot_failed_allocations; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    static auto slot_index_of(const_pointer p_slot) -> std::size_t
+    {
+      const auto address_of_slot = reinterpret_cast<std::uintptr_t>(p_slot);                  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      const auto address_of_base = reinterpret_cast<std::uintptr_t>(slot_array_memory.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+      // Pointers that do not belong to the slot memory map
+      // to an out-of-range index and are thereby ignored.
+      return
+        (address_of_slot < address_of_base)
+          ? slot_count
+          : static_cast<std::size_t>(static_cast<std::uintptr_t>(address_of_slot - address_of_base) / sizeof(slot_array_type));
+    }
   };
 
   template<typename T,
@@ -155,16 +201,41 @@
            const std::size_t SlotCount>
   typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_memory_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_memory; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_links_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_links; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
   template<typename T,
            const std::uint_fast32_t SlotWidth,
            const std::size_t SlotCount>
   typename n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_array_flags_type n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_flags; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_free_head; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_fresh_index; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
   template<typename T,
            const std::uint_fast32_t SlotWidth,
            const std::size_t SlotCount>
   std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_max_index; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
 
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_used_count; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::size_t n_slot_array_allocator<T, SlotWidth, SlotCount>::slot_failed_allocations; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
   // Global comparison operators (required by the standard).
   template<typename T,
            const std::uint_fast32_t SlotWidth,
@@ -0,0 +1,289 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_N_SLOT_ARRAY_ALLOCATOR_ATOMIC_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define UTIL_N_SLOT_ARRAY_ALLOCATOR_ATOMIC_2026_10_19_H
+
+  #include <array>
+  #include <atomic>
+  #include <cstddef>
+  #include <cstdint>
+
+  namespace util {
+
+  // This is a thread-safe variant of util::n_slot_array_allocator.
+  // It has the same interface and static slot memory, but the free-list
+  // is a lock-free stack. The head of the stack holds the slot index
+  // in its lower 32 bits and a modification tag in its upper 32 bits,
+  // which guards the compare-exchange against the ABA problem.
+  // Allocation and deallocation are lock-free wherever
+  // std::atomic<std::uint64_t> is lock-free.
+
+  // Forward declaration of n_slot_array_allocator_atomic template.
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  class n_slot_array_allocator_atomic;
+
+  // Template partial specialization of n_slot_array_allocator_atomic template for void.
+  template<const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  class n_slot_array_allocator_atomic<void, SlotWidth, SlotCount>
+  {
+  public:
+    using value_type    = void;
+    using pointer       = value_type*;
+    using const_pointer = const value_type*;
+
+    template<typename RebindType>
+    struct rebind
+    {
+      using other = n_slot_array_allocator_atomic<RebindType, SlotWidth, SlotCount>;
+    };
+  };
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  class n_slot_array_allocator_atomic // NOLINT(cppcoreguidelines-special-member-functions,hicpp-special-member-functions)
+  {
+  private:
+    static constexpr std::uint_fast32_t slot_width = SlotWidth;
+    static constexpr std::size_t        slot_count = SlotCount;
+
+    static_assert(slot_count < static_cast<std::size_t>(UINT32_C(0xFFFFFFFF)),
+                  "Error: The slot count of the atomic n-slot allocator must fit in 32 bits");
+
+    using slot_array_type        = std::array<T, static_cast<std::size_t>(slot_width)>;
+    using slot_array_memory_type = std::array<slot_array_type, slot_count>;
+    using slot_array_links_type  = std::array<std::atomic<std::uint32_t>, slot_count>;
+    using slot_array_flags_type  = std::array<std::atomic<std::uint8_t>, slot_count>;
+
+  public:
+    using size_type       = std::size_t;
+    using value_type      = typename slot_array_type::value_type;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    constexpr n_slot_array_allocator_atomic() = default; // LCOV_EXCL_LINE
+
+    constexpr n_slot_array_allocator_atomic(const n_slot_array_allocator_atomic&) = default; // LCOV_EXCL_LINE
+
+    template<typename RebindType>
+    struct rebind
+    {
+      using other = n_slot_array_allocator_atomic<RebindType, SlotWidth, SlotCount>;
+    };
+
+    constexpr auto max_size() const noexcept -> size_type { return slot_count; }
+
+    constexpr auto address(      reference x) const ->       pointer { return &x; }
+    constexpr auto address(const_reference x) const -> const_pointer { return &x; }
+
+    auto allocate(size_type count, const_pointer p_hint = nullptr) -> pointer
+    {
+      static_cast<void>(count);
+      static_cast<void>(p_hint);
+
+      // Pop a recycled slot from the free-list.
+      auto head = slot_free_head.load(std::memory_order_acquire);
+
+      while(   (head_index(head) != static_cast<std::uint32_t>(UINT8_C(0)))
+            && (static_cast<std::size_t>(head_index(head)) <= slot_count))
+      {
+        const auto index = static_cast<std::size_t>(head_index(head) - static_cast<std::uint32_t>(UINT8_C(1)));
+
+        const auto next = slot_links[index].load(std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        if(slot_free_head.compare_exchange_weak(head, make_head(next, head), std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          slot_flags[index].store(static_cast<std::uint8_t>(UINT8_C(1)), std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+          slot_used_count.fetch_add(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_relaxed);
+
+          return static_cast<pointer>(slot_array_memory[index].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+
+      // The free-list is empty. Take a never-used slot from the top of the array.
+      auto fresh = slot_fresh_index.load(std::memory_order_relaxed);
+
+      while(fresh < slot_count)
+      {
+        if(slot_fresh_index.compare_exchange_weak(fresh, static_cast<std::size_t>(fresh + static_cast<std::size_t>(UINT8_C(1))), std::memory_order_relaxed))
+        {
+          auto max_index = slot_max_index.load(std::memory_order_relaxed);
+
+          while((fresh > max_index) && (!slot_max_index.compare_exchange_weak(max_index, fresh, std::memory_order_relaxed))) { ; }
+
+          slot_flags[fresh].store(static_cast<std::uint8_t>(UINT8_C(1)), std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+          slot_used_count.fetch_add(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_relaxed);
+
+          return static_cast<pointer>(slot_array_memory[fresh].data()); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+      }
+
+      slot_failed_allocations.fetch_add(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_relaxed);
+
+      return nullptr;
+    }
+
+    auto construct(pointer p, const value_type& x) -> void
+    {
+      // The memory in the n-slot allocator already exists
+      // in an uninitialized form. Construction can safely
+      // simply set the value in the uninitialized memory.
+
+      *p = x;
+    }
+
+    auto destroy(pointer p) const -> void { static_cast<void>(p); } // LCOV_EXCL_LINE
+
+    auto deallocate(pointer p_slot, size_type sz) -> void
+    {
+      static_cast<void>(sz);
+
+      const auto index = slot_index_of(p_slot);
+
+      // Foreign pointers and slots that are not in use (as in a double
+      // free) are ignored. Only one of two racing frees of the same
+      // slot takes its used flag and pushes the slot.
+      if(   (index < slot_count)
+         && (slot_flags[index].exchange(static_cast<std::uint8_t>(UINT8_C(0)), std::memory_order_relaxed) != static_cast<std::uint8_t>(UINT8_C(0)))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+      {
+        // Push the slot onto the free-list.
+        const auto this_link = static_cast<std::uint32_t>(index + static_cast<std::size_t>(UINT8_C(1)));
+
+        auto head = slot_free_head.load(std::memory_order_relaxed);
+
+        do
+        {
+          slot_links[index].store(head_index(head), std::memory_order_relaxed); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+        }
+        while(!slot_free_head.compare_exchange_weak(head, make_head(this_link, head), std::memory_order_release, std::memory_order_relaxed));
+
+        slot_used_count.fetch_sub(static_cast<std::size_t>(UINT8_C(1)), std::memory_order_relaxed);
+      }
+    }
+
+    // Allocation statistics. The value of slot_max_index is the
+    // high-water mark, i.e., the largest slot index ever handed out.
+    static auto get_slot_max_index         () noexcept -> std::size_t { return slot_max_index.load(std::memory_order_relaxed); }
+    static auto get_slot_used_count        () noexcept -> std::size_t { return slot_used_count.load(std::memory_order_relaxed); }
+    static auto get_slot_failed_allocations() noexcept -> std::size_t { return slot_failed_allocations.load(std::memory_order_relaxed); }
+
+  private:
+    static slot_array_memory_type     slot_array_memory;       // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_links_type      slot_links;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static slot_array_flags_type      slot_flags;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::uint64_t> slot_free_head;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::size_t>   slot_fresh_index;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::size_t>   slot_max_index;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::size_t>   slot_used_count;         // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::size_t>   slot_failed_allocations; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    static constexpr auto head_index(const std::uint64_t head) noexcept -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(head);
+    }
+
+    static constexpr auto make_head(const std::uint32_t index, const std::uint64_t previous_head) noexcept -> std::uint64_t
+    {
+      // Bump the modification tag on every change of the head.
+      return
+        static_cast<std::uint64_t>
+        (
+            static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint32_t>(previous_head >> 32U) + 1U) << 32U)
+          | static_cast<std::uint64_t>(index)
+        );
+    }
+
+    static auto slot_index_of(const_pointer p_slot) -> std::size_t
+    {
+      const auto address_of_slot = reinterpret_cast<std::uintptr_t>(p_slot);                  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      const auto address_of_base = reinterpret_cast<std::uintptr_t>(slot_array_memory.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+      // Pointers that do not belong to the slot memory map
+      // to an out-of-range index and are thereby ignored.
+      return
+        (address_of_slot < address_of_base)
+          ? slot_count
+          : static_cast<std::size_t>(static_cast<std::uintptr_t>(address_of_slot - address_of_base) / sizeof(slot_array_type));
+    }
+  };
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_array_memory_type n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_array_memory; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_array_links_type n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_links; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  typename n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_array_flags_type n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_flags; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::atomic<std::uint64_t> n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_free_head { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::atomic<std::size_t> n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_fresh_index { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::atomic<std::size_t> n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_max_index { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::atomic<std::size_t> n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_used_count { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  std::atomic<std::size_t> n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>::slot_failed_allocations { }; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables,hicpp-uppercase-literal-suffix,readability-uppercase-literal-suffix)
+
+  // Global comparison operators (required by the standard).
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  auto operator==(const n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>& left,
+                  const n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>& right) -> bool
+  {
+    static_cast<void>(left.max_size());
+    static_cast<void>(right.max_size());
+
+    return true;
+  }
+
+  template<typename T,
+           const std::uint_fast32_t SlotWidth,
+           const std::size_t SlotCount>
+  auto operator!=(const n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>& left,
+                  const n_slot_array_allocator_atomic<T, SlotWidth, SlotCount>& right) -> bool
+  {
+    static_cast<void>(left.max_size());
+    static_cast<void>(right.max_size());
+
+    return false;
+  }
+
+  } // namespace util
+
+#endif // UTIL_N_SLOT_ARRAY_ALLOCATOR_ATOMIC_2026_10_19_H
@@ -0,0 +1,403 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_TRACKING_ALLOCATOR_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define UTIL_TRACKING_ALLOCATOR_2026_10_19_H
+
+  #include <array>
+  #include <cstddef>
+  #include <cstdint>
+  #include <iomanip>
+  #include <map>
+  #include <memory>
+  #include <mutex>
+  #include <ostream>
+  #include <string>
+  #include <type_traits>
+  #include <utility>
+  #include <vector>
+
+  namespace util {
+
+  // Size bucket k counts the allocations of [2^k, 2^(k+1)) bytes.
+  constexpr auto allocation_size_bucket_count() -> std::size_t { return static_cast<std::size_t>(UINT8_C(48)); }
+
+  inline auto allocation_size_bucket(const std::size_t bytes) -> std::size_t
+  {
+    auto bucket = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto n = bytes; (n > static_cast<std::size_t>(UINT8_C(1))) && (bucket < allocation_size_bucket_count() - 1U); n >>= 1U)
+    {
+      ++bucket;
+    }
+
+    return bucket;
+  }
+
+  // The statistics of the allocations made through tracking_allocator,
+  // in total or within the allocation scopes of one operation.
+  // The peak is the largest number of bytes that were allocated
+  // and not yet deallocated. For an operation, it is counted from
+  // the entry into its scope on and only for the allocations of the
+  // thread of the scope, so it is the memory that the operation needs
+  // in addition to what existed before, whatever other threads do.
+  struct allocation_statistics
+  {
+    std::uint64_t allocations         { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t scratch_allocations { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t bytes_allocated     { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t scratch_bytes       { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    std::uint64_t peak_bytes          { }; // NOLINT(misc-non-private-member-variables-in-classes)
+
+    std::array<std::uint64_t, allocation_size_bucket_count()> allocations_by_size { }; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  // All allocations and deallocations of tracking_allocator,
+  // of all value types and threads, are recorded here.
+  class allocation_tracker
+  {
+  public:
+    allocation_tracker() = default;
+
+    allocation_tracker(const allocation_tracker&) = delete;
+    allocation_tracker(allocation_tracker&&) noexcept = delete;
+
+    ~allocation_tracker() = default;
+
+    auto operator=(const allocation_tracker&) -> allocation_tracker& = delete;
+    auto operator=(allocation_tracker&&) noexcept -> allocation_tracker& = delete;
+
+    static auto instance() -> allocation_tracker&
+    {
+      static allocation_tracker my_tracker { };
+
+      return my_tracker;
+    }
+
+    auto record_allocation(const std::size_t bytes, const bool is_scratch) -> void;
+
+    auto record_deallocation(const std::size_t bytes) -> void
+    {
+      thread_live_bytes() -= static_cast<std::int64_t>(bytes);
+
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      my_live_bytes -= static_cast<std::uint64_t>(bytes);
+
+      ++my_deallocations;
+    }
+
+    auto live_bytes() const -> std::uint64_t
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      return my_live_bytes;
+    }
+
+    // The bytes allocated and not yet deallocated by the calling thread.
+    // Memory that is handed over to and released by another thread
+    // makes it negative here and positive there.
+    static auto thread_live_bytes() -> std::int64_t&
+    {
+      thread_local std::int64_t my_thread_live_bytes { };
+
+      return my_thread_live_bytes;
+    }
+
+    auto deallocations() const -> std::uint64_t
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      return my_deallocations;
+    }
+
+    auto totals() const -> allocation_statistics
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      return my_totals;
+    }
+
+    // The statistics of each operation that has allocated,
+    // sorted by the name of the operation.
+    auto operations() const -> std::vector<std::pair<std::string, allocation_statistics>>
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      return std::vector<std::pair<std::string, allocation_statistics>>(my_operations.cbegin(), my_operations.cend());
+    }
+
+    auto operation(const std::string& name) const -> allocation_statistics
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      const auto it = my_operations.find(name);
+
+      return ((it != my_operations.cend()) ? it->second : allocation_statistics { });
+    }
+
+    // Clear the statistics. Allocations that are still live
+    // remain so, and the peaks start again from them.
+    auto reset() -> void
+    {
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      my_totals = allocation_statistics { };
+
+      my_totals.peak_bytes = my_live_bytes;
+
+      my_deallocations = static_cast<std::uint64_t>(UINT8_C(0));
+
+      my_operations.clear();
+    }
+
+    // Print one line for all allocations and one per operation, with
+    // the allocations, the bytes, the peak and the allocations per size.
+    auto report(std::ostream& os) const -> void
+    {
+      const auto print_line =
+        [&os](const std::string& name, const allocation_statistics& s) // NOLINT(modernize-use-trailing-return-type)
+        {
+          os << std::left  << std::setw(20) << name
+             << std::right << std::setw(12) << s.allocations
+             << std::setw(12) << s.scratch_allocations
+             << std::setw(16) << s.bytes_allocated
+             << std::setw(16) << s.peak_bytes
+             << " ";
+
+          for(auto b = static_cast<std::size_t>(UINT8_C(0)); b < allocation_size_bucket_count(); ++b)
+          {
+            if(s.allocations_by_size[b] != static_cast<std::uint64_t>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            {
+              os << " [" << (static_cast<std::uint64_t>(UINT8_C(1)) << b) << ".." << ((static_cast<std::uint64_t>(UINT8_C(1)) << (b + 1U)) - 1U) << "]:" << s.allocations_by_size[b]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+            }
+          }
+
+          os << '\n';
+        };
+
+      os << std::left  << std::setw(20) << "operation"
+         << std::right << std::setw(12) << "allocations"
+         << std::setw(12) << "scratch"
+         << std::setw(16) << "bytes"
+         << std::setw(16) << "peak_bytes"
+         << "  allocations by bytes\n";
+
+      print_line("(all)", totals());
+
+      for(const auto& op : operations())
+      {
+        print_line(op.first, op.second);
+      }
+    }
+
+  private:
+    mutable std::mutex                           my_mutex         { };
+    std::uint64_t                                my_live_bytes    { };
+    std::uint64_t                                my_deallocations { };
+    allocation_statistics                        my_totals        { };
+    std::map<std::string, allocation_statistics> my_operations    { };
+  };
+
+  // The allocations made by this thread within the lifetime of an
+  // allocation scope are counted for the operation of that name,
+  // as well as in the totals. An inner scope takes the place of
+  // the outer one until it ends.
+  // A scope that is opened as outermost only takes effect if no other
+  // scope is active in this thread. decwide_t opens such a scope on the
+  // entry into its multiplication, division, inverse, roots and
+  // elementary functions, so that each of them counts the allocations
+  // of the operations it calls, and a scope of the caller counts all.
+  class allocation_scope
+  {
+  public:
+    explicit allocation_scope(const char* name, const bool is_outermost_only = false)
+      : my_name     (name),
+        my_previous (current()),
+        my_is_active((!is_outermost_only) || (my_previous == nullptr)),
+        my_base     (allocation_tracker::thread_live_bytes())
+    {
+      if(my_is_active)
+      {
+        current() = this;
+      }
+    }
+
+    allocation_scope() = delete;
+
+    allocation_scope(const allocation_scope&) = delete;
+    allocation_scope(allocation_scope&&) noexcept = delete;
+
+    ~allocation_scope()
+    {
+      if(my_is_active)
+      {
+        current() = my_previous;
+      }
+    }
+
+    auto operator=(const allocation_scope&) -> allocation_scope& = delete;
+    auto operator=(allocation_scope&&) noexcept -> allocation_scope& = delete;
+
+    static auto current() -> allocation_scope*&
+    {
+      thread_local allocation_scope* p_current { nullptr };
+
+      return p_current;
+    }
+
+    auto name() const -> const char* { return my_name; }
+
+    auto is_active() const -> bool { return my_is_active; }
+
+    // The live bytes of this thread at the entry into this scope.
+    auto base() const -> std::int64_t { return my_base; }
+
+  private:
+    const char*       my_name;
+    allocation_scope* my_previous;
+    bool              my_is_active;
+    std::int64_t      my_base;
+  };
+
+  inline auto allocation_tracker::record_allocation(const std::size_t bytes, const bool is_scratch) -> void
+  {
+    const allocation_scope* p_scope = allocation_scope::current();
+
+    const auto thread_live = (thread_live_bytes() += static_cast<std::int64_t>(bytes));
+
+    const std::lock_guard<std::mutex> lock(my_mutex);
+
+    my_live_bytes += static_cast<std::uint64_t>(bytes);
+
+    const auto add_to =
+      [bytes, is_scratch](allocation_statistics& s, const std::uint64_t peak) // NOLINT(modernize-use-trailing-return-type,google-runtime-references)
+      {
+        ++s.allocations;
+
+        s.bytes_allocated += static_cast<std::uint64_t>(bytes);
+
+        if(is_scratch)
+        {
+          ++s.scratch_allocations;
+
+          s.scratch_bytes += static_cast<std::uint64_t>(bytes);
+        }
+
+        ++s.allocations_by_size[allocation_size_bucket(bytes)]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+        if(peak > s.peak_bytes) { s.peak_bytes = peak; }
+      };
+
+    add_to(my_totals, my_live_bytes);
+
+    if(p_scope != nullptr)
+    {
+      const auto peak_in_scope =
+        ((thread_live > p_scope->base()) ? static_cast<std::uint64_t>(thread_live - p_scope->base())
+                                         : static_cast<std::uint64_t>(UINT8_C(0)));
+
+      add_to(my_operations[p_scope->name()], peak_in_scope);
+    }
+  }
+
+  // An allocator adapter that records its allocations in the
+  // allocation_tracker and takes the memory from a rebound copy
+  // of BaseAllocatorType. Use it as the AllocatorType of decwide_t
+  // in order to measure the memory of a computation, for instance
+  // decwide_t<100001, std::uint32_t, util::tracking_allocator<void>>.
+  // The scratch storage of the multiplication is then also taken
+  // through a tracking_allocator, and counted as scratch.
+  template<typename T,
+           typename BaseAllocatorType = std::allocator<void>>
+  class tracking_allocator
+  {
+  public:
+    using base_allocator_type = typename std::allocator_traits<BaseAllocatorType>::template rebind_alloc<T>;
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using scope_type = allocation_scope;
+
+    using propagate_on_container_copy_assignment = typename std::allocator_traits<base_allocator_type>::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename std::allocator_traits<base_allocator_type>::propagate_on_container_move_assignment;
+    using propagate_on_container_swap            = typename std::allocator_traits<base_allocator_type>::propagate_on_container_swap;
+
+    template<typename RebindType>
+    struct rebind
+    {
+      using other = tracking_allocator<RebindType, BaseAllocatorType>;
+    };
+
+    tracking_allocator() = default;
+
+    explicit tracking_allocator(const base_allocator_type& a, const bool is_scratch = false)
+      : my_base      (a),
+        my_is_scratch(is_scratch) { }
+
+    tracking_allocator(const tracking_allocator&) = default;
+    tracking_allocator(tracking_allocator&&) noexcept = default;
+
+    template<typename OtherValueType>
+    tracking_allocator(const tracking_allocator<OtherValueType, BaseAllocatorType>& other) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+      : my_base      (other.base()),
+        my_is_scratch(other.is_scratch()) { }
+
+    ~tracking_allocator() = default;
+
+    auto operator=(const tracking_allocator&) -> tracking_allocator& = default;
+    auto operator=(tracking_allocator&&) noexcept -> tracking_allocator& = default;
+
+    auto allocate(const size_type count) -> value_type*
+    {
+      value_type* p = std::allocator_traits<base_allocator_type>::allocate(my_base, count);
+
+      if(p != nullptr)
+      {
+        allocation_tracker::instance().record_allocation(static_cast<std::size_t>(count * sizeof(value_type)), my_is_scratch);
+      }
+
+      return p;
+    }
+
+    auto deallocate(value_type* p, const size_type count) -> void
+    {
+      // A moved-from container may hand back a null range.
+      if(p != nullptr)
+      {
+        allocation_tracker::instance().record_deallocation(static_cast<std::size_t>(count * sizeof(value_type)));
+      }
+
+      std::allocator_traits<base_allocator_type>::deallocate(my_base, p, count);
+    }
+
+    auto base() const -> const base_allocator_type& { return my_base; }
+
+    auto is_scratch() const -> bool { return my_is_scratch; }
+
+  private:
+    base_allocator_type my_base       { };
+    bool                my_is_scratch { false };
+  };
+
+  template<typename T, typename U, typename BaseAllocatorType>
+  auto operator==(const tracking_allocator<T, BaseAllocatorType>& a, const tracking_allocator<U, BaseAllocatorType>& b) -> bool
+  {
+    return (a.base() == typename tracking_allocator<T, BaseAllocatorType>::base_allocator_type(b.base()));
+  }
+
+  template<typename T, typename U, typename BaseAllocatorType>
+  auto operator!=(const tracking_allocator<T, BaseAllocatorType>& a, const tracking_allocator<U, BaseAllocatorType>& b) -> bool
+  {
+    return (!(a == b));
+  }
+
+  } // namespace util
+
+#endif // UTIL_TRACKING_ALLOCATOR_2026_10_19_H
@@ -14,6 +14,7 @@
   #include <initializer_list>
   #include <iterator>
   #include <memory>
+  #include <type_traits>
   #include <utility>
 
   namespace util {
@@ -24,11 +25,16 @@
            typename DiffType      = std::ptrdiff_t>
   class dynamic_array;
 
+  // The allocator is held as a (private) base class, so that stateful
+  // allocators such as std::pmr::polymorphic_allocator are carried along
+  // with the storage that they allocated, whereas stateless allocators
+  // take up no space thanks to the empty base optimization.
+
   template<typename ValueType,
            typename AllocatorType,
            typename SizeType,
            typename DiffType>
-  class dynamic_array
+  class dynamic_array : private std::allocator_traits<AllocatorType>::template rebind_alloc<ValueType>
   {
   public:
     // Type definitions.
@@ -49,11 +55,12 @@
     explicit constexpr dynamic_array(      size_type       count = static_cast<size_type>(UINT8_C(0)),
                                            const_reference v     = value_type(),
                                      const allocator_type& a     = allocator_type())
-      : elem_count(count)
+      : allocator_type(a),
+        elem_count(count)
     {
       if(elem_count > static_cast<size_type>(UINT8_C(0)))
       {
-        allocator_type my_a(a);
+        allocator_type& my_a = get_allocator_ref();
 
         elems = std::allocator_traits<allocator_type>::allocate(my_a, elem_count);
 
@@ -69,9 +76,10 @@
     }
 
     constexpr dynamic_array(const dynamic_array& other)
-      : elem_count(other.size())
+      : allocator_type(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.get_allocator_ref())),
+        elem_count(other.size())
     {
-      allocator_type my_a;
+      allocator_type& my_a = get_allocator_ref();
 
       if(elem_count > static_cast<size_type>(UINT8_C(0)))
       {
@@ -85,9 +93,10 @@
     constexpr dynamic_array(input_iterator first,
                             input_iterator last,
                             const allocator_type& a = allocator_type())
-      : elem_count(static_cast<size_type>(std::distance(first, last)))
+      : allocator_type(a),
+        elem_count(static_cast<size_type>(std::distance(first, last)))
     {
-      allocator_type my_a(a);
+      allocator_type& my_a = get_allocator_ref();
 
       if(elem_count > static_cast<size_type>(UINT8_C(0)))
       {
@@ -99,9 +108,10 @@
 
     constexpr dynamic_array(std::initializer_list<value_type> lst,
                             const allocator_type& a = allocator_type())
-      : elem_count(lst.size())
+      : allocator_type(a),
+        elem_count(lst.size())
     {
-      allocator_type my_a(a);
+      allocator_type& my_a = get_allocator_ref();
 
       if(elem_count > static_cast<size_type>(UINT8_C(0)))
       {
@@ -112,7 +122,8 @@
     }
 
     // Move constructor.
-    constexpr dynamic_array(dynamic_array&& other) noexcept : elem_count(other.elem_count),
+    constexpr dynamic_array(dynamic_array&& other) noexcept : allocator_type(static_cast<allocator_type&&>(other.get_allocator_ref())),
+                                                              elem_count(other.elem_count),
                                                               elems     (other.elems)
     {
       other.elem_count = static_cast<size_type>(UINT8_C(0));
@@ -124,10 +135,8 @@
     {
       using local_allocator_traits_type = std::allocator_traits<allocator_type>;
 
-      allocator_type my_a;
-
       // Destroy the elements and deallocate the range.
-      local_allocator_traits_type::deallocate(my_a, elems, elem_count);
+      local_allocator_traits_type::deallocate(get_allocator_ref(), elems, elem_count);
     }
 
     // Assignment operator.
@@ -143,15 +152,21 @@
       return *this;
     }
 
-    // Move assignment operator.
-    constexpr auto operator=(dynamic_array&& other) noexcept -> dynamic_array&
+    // Move assignment operator. This only allocates (and is therefore
+    // not noexcept) when the allocator does not propagate on move
+    // assignment, as is the case for std::pmr::polymorphic_allocator.
+    constexpr auto operator=(dynamic_array&& other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value) -> dynamic_array&
     {
-      std::swap(elem_count, other.elem_count);
-      std::swap(elems,      other.elems);
+      if(this != &other)
+      {
+        move_assign(other, typename std::allocator_traits<allocator_type>::propagate_on_container_move_assignment());
+      }
 
       return *this;
     }
 
+    constexpr auto get_allocator() const -> allocator_type { return get_allocator_ref(); }
+
     // Iterator members:
     constexpr auto begin  ()       noexcept -> iterator               { return elems; }
     constexpr auto end    ()       noexcept -> iterator               { return elems + elem_count; }
@@ -194,24 +209,73 @@
       std::fill(begin(), begin() + elem_count, v);
     }
 
+    // Swap the storage. The allocators are swapped along with it when
+    // they propagate on swap. Otherwise, as with std::vector, they must
+    // compare equal, and the behavior is undefined if they do not.
     constexpr auto swap(dynamic_array& other) noexcept -> void
     {
       if(this != &other)
       {
+        swap_allocator(other, typename std::allocator_traits<allocator_type>::propagate_on_container_swap());
+
         std::swap(elems,      other.elems);
         std::swap(elem_count, other.elem_count);
       }
     }
 
-    constexpr auto swap(dynamic_array&& other) noexcept -> void
-    {
-      elems      = std::move(other.elems);
-      elem_count = std::move(other.elem_count);
-    }
-
   private:
     size_type elem_count;        // NOLINT(readability-identifier-naming)
     pointer   elems { nullptr }; // NOLINT(readability-identifier-naming,altera-id-dependent-backward-branch)
+
+    constexpr auto get_allocator_ref()       noexcept ->       allocator_type& { return static_cast<      allocator_type&>(*this); }
+    constexpr auto get_allocator_ref() const noexcept -> const allocator_type& { return static_cast<const allocator_type&>(*this); }
+
+    constexpr auto move_assign(dynamic_array& other, std::true_type) noexcept -> void
+    {
+      // The allocator propagates, so release our own storage
+      // and adopt both the allocator and the storage of other.
+      std::allocator_traits<allocator_type>::deallocate(get_allocator_ref(), elems, elem_count);
+
+      get_allocator_ref() = std::move(other.get_allocator_ref());
+
+      elem_count = other.elem_count;
+      elems      = other.elems;
+
+      other.elem_count = static_cast<size_type>(UINT8_C(0));
+      other.elems      = nullptr;
+    }
+
+    constexpr auto move_assign(dynamic_array& other, std::false_type) -> void
+    {
+      if(get_allocator_ref() == other.get_allocator_ref())
+      {
+        std::swap(elem_count, other.elem_count);
+        std::swap(elems,      other.elems);
+      }
+      else
+      {
+        // Storage obtained from an unequal (stateful) allocator
+        // can not be adopted. Copy the elements into storage
+        // from our own allocator instead.
+        dynamic_array tmp(other.cbegin(), other.cend(), get_allocator_ref());
+
+        std::swap(elem_count, tmp.elem_count);
+        std::swap(elems,      tmp.elems);
+      }
+    }
+
+    constexpr auto swap_allocator(dynamic_array& other, std::true_type) noexcept -> void
+    {
+      using std::swap;
+
+      swap(get_allocator_ref(), other.get_allocator_ref());
+    }
+
+    constexpr auto swap_allocator(dynamic_array& other, std::false_type) const noexcept -> void
+    {
+      // The allocators stay in place (see the precondition of swap()).
+      static_cast<void>(other);
+    }
   };
 
   template<typename ValueType, typename AllocatorType>
@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_MEMORY_MAPPED_FILE_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define UTIL_MEMORY_MAPPED_FILE_2026_10_19_H
+
+  #include <util/utility/util_noncopyable.h>
+
+  #include <cstddef>
+  #include <cstdint>
+  #include <cstdio>
+  #include <vector>
+
+  #if (defined(__unix__) || defined(__APPLE__))
+  #define UTIL_MEMORY_MAPPED_FILE_HAS_MMAP
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #endif
+
+  namespace util {
+
+  // Provide read-only access to the contents of a file as one
+  // contiguous range of bytes. Where POSIX mmap() is available,
+  // the file is memory-mapped and its pages are loaded on demand.
+  // Otherwise the file is read into memory as a whole.
+  // The data begin on a page boundary when the file is mapped,
+  // and on the alignment of operator new otherwise.
+
+  class memory_mapped_file : private util::noncopyable
+  {
+  public:
+    explicit memory_mapped_file(const char* filename)
+    {
+      #if defined(UTIL_MEMORY_MAPPED_FILE_HAS_MMAP)
+      const int fd { ::open(filename, O_RDONLY) }; // NOLINT(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+
+      if(fd >= 0)
+      {
+        struct ::stat file_status { };
+
+        if((::fstat(fd, &file_status) == 0) && (file_status.st_size > static_cast<::off_t>(INT8_C(0))))
+        {
+          void* p_map = ::mmap(nullptr, static_cast<std::size_t>(file_status.st_size), PROT_READ, MAP_PRIVATE, fd, static_cast<::off_t>(INT8_C(0)));
+
+          if(p_map != MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+          {
+            my_data = static_cast<const std::uint8_t*>(p_map);
+            my_size = static_cast<std::size_t>(file_status.st_size);
+          }
+        }
+
+        static_cast<void>(::close(fd));
+      }
+      #else
+      std::FILE* p_file = std::fopen(filename, "rb"); // NOLINT(cppcoreguidelines-owning-memory)
+
+      if(p_file != nullptr)
+      {
+        constexpr auto chunk_size = static_cast<std::size_t>(UINT16_C(4096));
+
+        std::size_t count_read { };
+
+        do
+        {
+          const auto count_before = my_buffer.size();
+
+          my_buffer.resize(count_before + chunk_size);
+
+          count_read = std::fread(my_buffer.data() + count_before, static_cast<std::size_t>(UINT8_C(1)), chunk_size, p_file); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          my_buffer.resize(count_before + count_read);
+        }
+        while(count_read == chunk_size);
+
+        static_cast<void>(std::fclose(p_file)); // NOLINT(cppcoreguidelines-owning-memory)
+
+        my_data = my_buffer.data();
+        my_size = my_buffer.size();
+      }
+      #endif
+    }
+
+    memory_mapped_file() = delete;
+
+    ~memory_mapped_file()
+    {
+      #if defined(UTIL_MEMORY_MAPPED_FILE_HAS_MMAP)
+      if(my_data != nullptr)
+      {
+        static_cast<void>(::munmap(const_cast<std::uint8_t*>(my_data), my_size)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+      }
+      #endif
+    }
+
+    auto is_open() const noexcept -> bool { return (my_data != nullptr); }
+
+    auto data () const noexcept -> const std::uint8_t* { return my_data; }
+    auto size () const noexcept -> std::size_t         { return my_size; }
+
+    auto begin() const noexcept -> const std::uint8_t* { return my_data; }
+    auto end  () const noexcept -> const std::uint8_t* { return my_data + my_size; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  private:
+    const std::uint8_t* my_data { nullptr };
+    std::size_t         my_size { };
+
+    #if !defined(UTIL_MEMORY_MAPPED_FILE_HAS_MMAP)
+    std::vector<std::uint8_t> my_buffer { };
+    #endif
+  };
+
+  } // namespace util
+
+#endif // UTIL_MEMORY_MAPPED_FILE_2026_10_19_H
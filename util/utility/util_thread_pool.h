@@ -0,0 +1,478 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.
+//  Distributed under the Boost Software License,
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef UTIL_THREAD_POOL_2026_10_19_H // NOLINT(llvm-header-guard)
+  #define UTIL_THREAD_POOL_2026_10_19_H
+
+  #include <util/utility/util_noncopyable.h>
+
+  #include <algorithm>
+  #include <atomic>
+  #include <condition_variable>
+  #include <cstddef>
+  #include <cstdint>
+  #include <deque>
+  #include <exception>
+  #include <functional>
+  #include <map>
+  #include <memory>
+  #include <mutex>
+  #include <thread>
+  #include <utility>
+  #include <vector>
+
+  #if (defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND))
+  #define UTIL_THREAD_POOL_HAS_EXCEPTIONS
+  #endif
+
+  namespace util {
+
+  // A pool of worker threads with one task queue per worker.
+  // A worker runs the tasks at the front of its own queue and,
+  // when that is empty, steals tasks from the back of the others.
+  // The parallel loops split their range into chunks, which are
+  // spread over the queues, so that the chunks are scheduled
+  // dynamically. A worker that waits for a loop (as in a nested
+  // parallel_for) runs pending tasks in the meantime. Other threads
+  // wait for the loop without running any of its chunks.
+  class thread_pool : private util::noncopyable
+  {
+  public:
+    explicit thread_pool(const unsigned number_of_workers = default_number_of_workers())
+    {
+      const auto workers = (std::max)(number_of_workers, static_cast<unsigned>(UINT8_C(1)));
+
+      my_queues.reserve(static_cast<std::size_t>(workers));
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < workers; ++i)
+      {
+        my_queues.emplace_back(new worker_queue { });
+      }
+
+      my_workers.reserve(static_cast<std::size_t>(workers));
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < workers; ++i)
+      {
+        my_workers.emplace_back(&thread_pool::work, this, i);
+      }
+    }
+
+    ~thread_pool()
+    {
+      {
+        const std::lock_guard<std::mutex> lock(my_wake_mutex);
+
+        my_stop = true;
+      }
+
+      my_wake.notify_all();
+
+      for(auto& worker : my_workers)
+      {
+        worker.join();
+      }
+    }
+
+    static auto default_number_of_workers() -> unsigned
+    {
+      const auto number_of_threads_hint = static_cast<unsigned>(std::thread::hardware_concurrency());
+
+      return ((number_of_threads_hint == static_cast<unsigned>(UINT8_C(0))) ? static_cast<unsigned>(UINT8_C(4)) : number_of_threads_hint);
+    }
+
+    // The pool used by the free functions parallel_for and parallel_reduce.
+    static auto global() -> thread_pool&
+    {
+      static thread_pool pool { };
+
+      return pool;
+    }
+
+    auto size() const -> unsigned { return static_cast<unsigned>(my_workers.size()); }
+
+    // The index of the calling worker of this pool in [0, size()),
+    // or size() for a thread that does not belong to this pool.
+    auto worker_index() const -> unsigned
+    {
+      const auto& identity = this_worker();
+
+      return ((identity.pool == this) ? identity.index : size());
+    }
+
+    // Call function(i) for each i in [first, last). A grain of zero
+    // makes about four chunks per worker. An exception thrown by the
+    // function is rethrown here once all chunks have finished
+    // (when exceptions are enabled).
+    template<typename IndexType,
+             typename FunctionType>
+    auto parallel_for(const IndexType first, const IndexType last, FunctionType function, const IndexType grain = IndexType { }) -> void
+    {
+      for_each_chunk
+      (
+        first,
+        last,
+        grain,
+        [&function](const IndexType chunk_first, const IndexType chunk_last, const std::size_t)
+        {
+          for(auto i = chunk_first; i < chunk_last; ++i) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            function(i);
+          }
+        }
+      );
+    }
+
+    // Reduce map(i) for each i in [first, last) with the associative
+    // function reduce. Each chunk is reduced starting from identity,
+    // and the chunks are then reduced in order, so the result does
+    // not depend on the scheduling.
+    template<typename IndexType,
+             typename ValueType,
+             typename MapFunctionType,
+             typename ReduceFunctionType>
+    auto parallel_reduce(const IndexType first, const IndexType last, const ValueType& identity, MapFunctionType map, ReduceFunctionType reduce, const IndexType grain = IndexType { }) -> ValueType
+    {
+      std::vector<ValueType> partial(number_of_chunks(first, last, grain), identity);
+
+      for_each_chunk
+      (
+        first,
+        last,
+        grain,
+        [&partial, &map, &reduce](const IndexType chunk_first, const IndexType chunk_last, const std::size_t chunk)
+        {
+          for(auto i = chunk_first; i < chunk_last; ++i) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            partial[chunk] = reduce(partial[chunk], map(i));
+          }
+        }
+      );
+
+      auto result = identity;
+
+      for(const auto& value : partial)
+      {
+        result = reduce(result, value);
+      }
+
+      return result;
+    }
+
+  private:
+    using task_type = std::function<void()>;
+
+    struct worker_queue
+    {
+      std::mutex            mtx;   // NOLINT(misc-non-private-member-variables-in-classes)
+      std::deque<task_type> tasks; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    struct worker_identity
+    {
+      const thread_pool* pool;  // NOLINT(misc-non-private-member-variables-in-classes)
+      unsigned           index; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    // The state of one parallel loop, shared by its chunks.
+    struct loop_state
+    {
+      std::atomic<std::size_t> remaining { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      std::mutex               mtx { };       // NOLINT(misc-non-private-member-variables-in-classes)
+      std::condition_variable  done { };      // NOLINT(misc-non-private-member-variables-in-classes)
+      std::exception_ptr       error { };     // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    std::vector<std::unique_ptr<worker_queue>> my_queues { };
+    std::vector<std::thread>                   my_workers { };
+    std::mutex                               my_wake_mutex { };
+    std::condition_variable                    my_wake { };
+    std::atomic<std::size_t>                   my_pending { };
+    std::atomic<unsigned>                      my_next_queue { };
+    bool                                       my_stop { };
+
+    static auto this_worker() -> worker_identity&
+    {
+      thread_local worker_identity identity { nullptr, static_cast<unsigned>(UINT8_C(0)) };
+
+      return identity;
+    }
+
+    template<typename IndexType>
+    static auto chunk_size(const IndexType first, const IndexType last, const IndexType grain, const unsigned workers) -> IndexType
+    {
+      const auto n = static_cast<IndexType>(last - first);
+
+      return
+        (grain > IndexType { })
+          ? grain
+          : (std::max)(static_cast<IndexType>(n / static_cast<IndexType>(workers * 4U)), static_cast<IndexType>(1));
+    }
+
+    template<typename IndexType>
+    auto number_of_chunks(const IndexType first, const IndexType last, const IndexType grain) const -> std::size_t
+    {
+      if(!(first < last))
+      {
+        return static_cast<std::size_t>(UINT8_C(0));
+      }
+
+      const auto n     = static_cast<IndexType>(last - first);
+      const auto chunk = chunk_size(first, last, grain, size());
+
+      return static_cast<std::size_t>(static_cast<std::size_t>(n / chunk) + (((n % chunk) != IndexType { }) ? 1U : 0U));
+    }
+
+    // Call body(chunk_first, chunk_last, chunk) for the chunks
+    // of [first, last) on the workers and wait for all of them.
+    template<typename IndexType,
+             typename ChunkFunctionType>
+    auto for_each_chunk(const IndexType first, const IndexType last, const IndexType grain, ChunkFunctionType body) -> void
+    {
+      const auto chunks = number_of_chunks(first, last, grain);
+
+      if(chunks == static_cast<std::size_t>(UINT8_C(0)))
+      {
+        return;
+      }
+
+      const auto chunk = chunk_size(first, last, grain, size());
+
+      const auto state = std::make_shared<loop_state>();
+
+      state->remaining.store(chunks);
+
+      auto chunk_first = first;
+
+      for(auto index = static_cast<std::size_t>(UINT8_C(0)); index < chunks; ++index)
+      {
+        const auto chunk_last = (std::min)(static_cast<IndexType>(chunk_first + chunk), last);
+
+        submit
+        (
+          [state, &body, chunk_first, chunk_last, index]()
+          {
+            #if defined(UTIL_THREAD_POOL_HAS_EXCEPTIONS)
+            try
+            {
+            #endif
+              body(chunk_first, chunk_last, index);
+            #if defined(UTIL_THREAD_POOL_HAS_EXCEPTIONS)
+            }
+            catch(...)
+            {
+              const std::lock_guard<std::mutex> lock(state->mtx);
+
+              if(!state->error) { state->error = std::current_exception(); }
+            }
+            #endif
+
+            if(state->remaining.fetch_sub(static_cast<std::size_t>(UINT8_C(1))) == static_cast<std::size_t>(UINT8_C(1)))
+            {
+              const std::lock_guard<std::mutex> lock(state->mtx);
+
+              state->done.notify_all();
+            }
+          }
+        );
+
+        chunk_first = chunk_last;
+      }
+
+      const auto index_of_this_worker = worker_index();
+
+      if(index_of_this_worker < size())
+      {
+        while(state->remaining.load() != static_cast<std::size_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          if(!try_run_one(index_of_this_worker))
+          {
+            std::this_thread::yield();
+          }
+        }
+      }
+
+      std::exception_ptr error { };
+
+      {
+        std::unique_lock<std::mutex> lock(state->mtx);
+
+        state->done.wait(lock, [&state]() { return (state->remaining.load() == static_cast<std::size_t>(UINT8_C(0))); });
+
+        // Take the exception out of the state, which the last
+        // task to finish might release on another thread.
+        std::swap(error, state->error);
+      }
+
+      #if defined(UTIL_THREAD_POOL_HAS_EXCEPTIONS)
+      if(error)
+      {
+        std::rethrow_exception(error);
+      }
+      #endif
+    }
+
+    auto submit(task_type task) -> void
+    {
+      const auto queue_index = static_cast<std::size_t>(my_next_queue.fetch_add(static_cast<unsigned>(UINT8_C(1))) % size());
+
+      {
+        const std::lock_guard<std::mutex> lock(my_queues[queue_index]->mtx);
+
+        my_queues[queue_index]->tasks.push_back(std::move(task));
+      }
+
+      {
+        const std::lock_guard<std::mutex> lock(my_wake_mutex);
+
+        my_pending.fetch_add(static_cast<std::size_t>(UINT8_C(1)));
+      }
+
+      my_wake.notify_one();
+    }
+
+    // Run one task of the worker's own queue or one stolen from another.
+    auto try_run_one(const unsigned own_index) -> bool
+    {
+      task_type task { };
+
+      for(auto k = static_cast<std::size_t>(UINT8_C(0)); ((k < my_queues.size()) && (!task)); ++k)
+      {
+        const auto queue_index = static_cast<std::size_t>(static_cast<std::size_t>(own_index + k) % my_queues.size());
+
+        worker_queue& queue = *my_queues[queue_index];
+
+        const std::lock_guard<std::mutex> lock(queue.mtx);
+
+        if(!queue.tasks.empty())
+        {
+          if(k == static_cast<std::size_t>(UINT8_C(0)))
+          {
+            task = std::move(queue.tasks.front());
+
+            queue.tasks.pop_front();
+          }
+          else
+          {
+            task = std::move(queue.tasks.back());
+
+            queue.tasks.pop_back();
+          }
+        }
+      }
+
+      if(task)
+      {
+        my_pending.fetch_sub(static_cast<std::size_t>(UINT8_C(1)));
+
+        task();
+      }
+
+      return static_cast<bool>(task);
+    }
+
+    auto work(const unsigned index) -> void
+    {
+      this_worker() = worker_identity { this, index };
+
+      for(;;)
+      {
+        if(try_run_one(index))
+        {
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(my_wake_mutex);
+
+        my_wake.wait(lock, [this]() { return (my_stop || (my_pending.load() != static_cast<std::size_t>(UINT8_C(0)))); });
+
+        if(my_stop && (my_pending.load() == static_cast<std::size_t>(UINT8_C(0))))
+        {
+          break;
+        }
+      }
+    }
+  };
+
+  // One value per worker of a pool, plus one for each thread that does
+  // not belong to it, such as random engines that the chunks of a loop
+  // use without locking. The factory is called with the index of each
+  // value. The values of the workers have the indices [0, size()) and
+  // are made up front. The value of a thread outside the pool is made
+  // at its first call of local(), which locks for the lookup.
+  template<typename ValueType>
+  class per_worker : private util::noncopyable
+  {
+  public:
+    template<typename FactoryType>
+    per_worker(const thread_pool& pool, FactoryType factory) : my_pool(pool), my_factory(factory)
+    {
+      my_worker_values.reserve(static_cast<std::size_t>(pool.size()));
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < pool.size(); ++i)
+      {
+        my_values.emplace_back(my_factory(i));
+
+        my_worker_values.push_back(&my_values.back());
+      }
+    }
+
+    auto local() -> ValueType&
+    {
+      const auto index = my_pool.worker_index();
+
+      if(index < my_pool.size())
+      {
+        return *my_worker_values[static_cast<std::size_t>(index)];
+      }
+
+      const std::lock_guard<std::mutex> lock(my_mutex);
+
+      auto it = my_outside_values.find(std::this_thread::get_id());
+
+      if(it == my_outside_values.end())
+      {
+        // Appending to the deque keeps the references to its values.
+        my_values.emplace_back(my_factory(static_cast<unsigned>(my_values.size())));
+
+        it = my_outside_values.emplace(std::this_thread::get_id(), &my_values.back()).first;
+      }
+
+      return *it->second;
+    }
+
+    // All of the values, for instance to combine them after a loop.
+    auto begin() const -> typename std::deque<ValueType>::const_iterator { return my_values.cbegin(); }
+    auto end  () const -> typename std::deque<ValueType>::const_iterator { return my_values.cend(); }
+
+  private:
+    const thread_pool&                       my_pool;
+    std::function<ValueType(const unsigned)> my_factory;
+    std::deque<ValueType>                    my_values { };
+    std::vector<ValueType*>                  my_worker_values { };
+    std::map<std::thread::id, ValueType*>    my_outside_values { };
+    std::mutex                               my_mutex { };
+  };
+
+  template<typename IndexType,
+           typename FunctionType>
+  auto parallel_for(const IndexType first, const IndexType last, FunctionType function) -> void
+  {
+    thread_pool::global().parallel_for(first, last, function);
+  }
+
+  template<typename IndexType,
+           typename ValueType,
+           typename MapFunctionType,
+           typename ReduceFunctionType>
+  auto parallel_reduce(const IndexType first, const IndexType last, const ValueType& identity, MapFunctionType map, ReduceFunctionType reduce) -> ValueType
+  {
+    return thread_pool::global().parallel_reduce(first, last, identity, map, reduce);
+  }
+
+  } // namespace util
+
+#endif // UTIL_THREAD_POOL_2026_10_19_H